@@ -39,6 +39,7 @@ GENERIC_FEATURES = \
     KEYCODE_STRING \
     KEY_LOCK \
     KEY_OVERRIDE \
+    LATENCY_TRACE \
     LAYER_LOCK \
     LEADER \
     MAGIC \
@@ -53,6 +54,7 @@ GENERIC_FEATURES = \
     SPACE_CADET \
     SWAP_HANDS \
     TAP_DANCE \
+    TASK_PROFILING \
     TRI_LAYER \
     VIA \
     VIRTSER \
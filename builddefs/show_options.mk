@@ -45,6 +45,8 @@ OTHER_OPTION_NAMES = \
   STENO_ENABLE \
   STENO_PROTOCOL \
   TAP_DANCE_ENABLE \
+  TASK_PROFILING_ENABLE \
+  LATENCY_TRACE_ENABLE \
   VIRTSER_ENABLE \
   OLED_ENABLE \
   OLED_DRIVER \
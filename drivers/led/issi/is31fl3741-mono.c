@@ -27,6 +27,15 @@
 #define IS31FL3741_SCALING_0_REGISTER_COUNT 180
 #define IS31FL3741_SCALING_1_REGISTER_COUNT 171
 
+// Changes to the PWM registers are tracked, and sent, in chunks of this many registers.
+// Page 0 chunks take the low bits of the dirty mask, followed by those of page 1.
+#define IS31FL3741_PWM_0_CHUNK_SIZE 30
+#define IS31FL3741_PWM_0_CHUNK_COUNT (IS31FL3741_PWM_0_REGISTER_COUNT / IS31FL3741_PWM_0_CHUNK_SIZE)
+#define IS31FL3741_PWM_0_CHUNK(reg) (1 << ((reg) / IS31FL3741_PWM_0_CHUNK_SIZE))
+#define IS31FL3741_PWM_1_CHUNK_SIZE 19
+#define IS31FL3741_PWM_1_CHUNK_COUNT (IS31FL3741_PWM_1_REGISTER_COUNT / IS31FL3741_PWM_1_CHUNK_SIZE)
+#define IS31FL3741_PWM_1_CHUNK(reg) (1 << (IS31FL3741_PWM_0_CHUNK_COUNT + (reg) / IS31FL3741_PWM_1_CHUNK_SIZE))
+
 #ifndef IS31FL3741_I2C_TIMEOUT
 #    define IS31FL3741_I2C_TIMEOUT 100
 #endif
@@ -35,6 +44,10 @@
 #    define IS31FL3741_I2C_PERSISTENCE 0
 #endif
 
+#ifndef IS31FL3741_I2C_TRANSFER_SIZE
+#    define IS31FL3741_I2C_TRANSFER_SIZE IS31FL3741_PWM_0_CHUNK_SIZE
+#endif
+
 #ifndef IS31FL3741_CONFIGURATION
 #    define IS31FL3741_CONFIGURATION 0x01
 #endif
@@ -75,18 +88,18 @@ const uint8_t i2c_addresses[IS31FL3741_DRIVER_COUNT] = {
 // buffers and the transfers in is31fl3741_write_pwm_buffer() but it's
 // probably not worth the extra complexity.
 typedef struct is31fl3741_driver_t {
-    uint8_t pwm_buffer_0[IS31FL3741_PWM_0_REGISTER_COUNT];
-    uint8_t pwm_buffer_1[IS31FL3741_PWM_1_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
-    uint8_t scaling_buffer_0[IS31FL3741_SCALING_0_REGISTER_COUNT];
-    uint8_t scaling_buffer_1[IS31FL3741_SCALING_1_REGISTER_COUNT];
-    bool    scaling_buffer_dirty;
+    uint8_t  pwm_buffer_0[IS31FL3741_PWM_0_REGISTER_COUNT];
+    uint8_t  pwm_buffer_1[IS31FL3741_PWM_1_REGISTER_COUNT];
+    uint16_t pwm_buffer_dirty;
+    uint8_t  scaling_buffer_0[IS31FL3741_SCALING_0_REGISTER_COUNT];
+    uint8_t  scaling_buffer_1[IS31FL3741_SCALING_1_REGISTER_COUNT];
+    bool     scaling_buffer_dirty;
 } PACKED is31fl3741_driver_t;
 
 is31fl3741_driver_t driver_buffers[IS31FL3741_DRIVER_COUNT] = {{
     .pwm_buffer_0         = {0},
     .pwm_buffer_1         = {0},
-    .pwm_buffer_dirty     = false,
+    .pwm_buffer_dirty     = 0,
     .scaling_buffer_0     = {0},
     .scaling_buffer_1     = {0},
     .scaling_buffer_dirty = false,
@@ -107,38 +120,47 @@ void is31fl3741_select_page(uint8_t index, uint8_t page) {
     is31fl3741_write_register(index, IS31FL3741_REG_COMMAND, page);
 }
 
-void is31fl3741_write_pwm_buffer(uint8_t index) {
-    is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_0);
+static void is31fl3741_write_pwm_page(uint8_t index, uint8_t page, const uint8_t *buffer, uint8_t chunk_size, uint8_t chunk_count, uint16_t dirty) {
+    dirty &= (1 << chunk_count) - 1;
+    if (!dirty) {
+        return;
+    }
 
-    // Transmit PWM0 registers in 6 transfers of 30 bytes.
+    is31fl3741_select_page(index, page);
 
-    // Iterate over the pwm_buffer_0 contents at 30 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3741_PWM_0_REGISTER_COUNT; i += 30) {
-#if IS31FL3741_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3741_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+    uint8_t chunk = 0;
+    while (chunk < chunk_count) {
+        if (!(dirty & (1 << chunk))) {
+            chunk++;
+            continue;
         }
-#else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT);
-#endif
-    }
 
-    is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_1);
+        uint8_t  reg    = chunk * chunk_size;
+        uint16_t length = 0;
+        do {
+            length += chunk_size;
+            chunk++;
+        } while (chunk < chunk_count && (dirty & (1 << chunk)) && length + chunk_size <= IS31FL3741_I2C_TRANSFER_SIZE);
 
-    // Transmit PWM1 registers in 9 transfers of 19 bytes.
-
-    // Iterate over the pwm_buffer_1 contents at 19 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3741_PWM_1_REGISTER_COUNT; i += 19) {
 #if IS31FL3741_I2C_PERSISTENCE > 0
         for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+            if (i2c_write_register(i2c_addresses[index] << 1, reg, buffer + reg, length, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
         }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT);
+        i2c_write_register(i2c_addresses[index] << 1, reg, buffer + reg, length, IS31FL3741_I2C_TIMEOUT);
 #endif
     }
 }
 
+void is31fl3741_write_pwm_buffer(uint8_t index) {
+    // Transmit the PWM registers that have changed since the last update, skipping pages
+    // with no changes and merging neighbouring chunks into transfers of up to IS31FL3741_I2C_TRANSFER_SIZE bytes.
+    uint16_t dirty = driver_buffers[index].pwm_buffer_dirty;
+
+    is31fl3741_write_pwm_page(index, IS31FL3741_COMMAND_PWM_0, driver_buffers[index].pwm_buffer_0, IS31FL3741_PWM_0_CHUNK_SIZE, IS31FL3741_PWM_0_CHUNK_COUNT, dirty);
+    is31fl3741_write_pwm_page(index, IS31FL3741_COMMAND_PWM_1, driver_buffers[index].pwm_buffer_1, IS31FL3741_PWM_1_CHUNK_SIZE, IS31FL3741_PWM_1_CHUNK_COUNT, dirty >> IS31FL3741_PWM_0_CHUNK_COUNT);
+}
+
 void is31fl3741_init_drivers(void) {
     i2c_init();
 
@@ -196,8 +218,10 @@ uint8_t get_pwm_value(uint8_t driver, uint16_t reg) {
 void set_pwm_value(uint8_t driver, uint16_t reg, uint8_t value) {
     if (reg & 0x100) {
         driver_buffers[driver].pwm_buffer_1[reg & 0xFF] = value;
+        driver_buffers[driver].pwm_buffer_dirty |= IS31FL3741_PWM_1_CHUNK(reg & 0xFF);
     } else {
         driver_buffers[driver].pwm_buffer_0[reg] = value;
+        driver_buffers[driver].pwm_buffer_dirty |= IS31FL3741_PWM_0_CHUNK(reg);
     }
 }
 
@@ -212,7 +236,6 @@ void is31fl3741_set_value(int index, uint8_t value) {
         }
 
         set_pwm_value(led.driver, led.v, value);
-        driver_buffers[led.driver].pwm_buffer_dirty = true;
     }
 }
 
@@ -243,13 +266,12 @@ void is31fl3741_update_pwm_buffers(uint8_t index) {
     if (driver_buffers[index].pwm_buffer_dirty) {
         is31fl3741_write_pwm_buffer(index);
 
-        driver_buffers[index].pwm_buffer_dirty = false;
+        driver_buffers[index].pwm_buffer_dirty = 0;
     }
 }
 
 void is31fl3741_set_pwm_buffer(const is31fl3741_led_t *pled, uint8_t value) {
     set_pwm_value(pled->driver, pled->v, value);
-    driver_buffers[pled->driver].pwm_buffer_dirty = true;
 }
 
 void is31fl3741_update_led_control_registers(uint8_t index) {
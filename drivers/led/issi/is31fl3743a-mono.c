@@ -26,6 +26,11 @@
 #define IS31FL3743A_PWM_REGISTER_COUNT 198
 #define IS31FL3743A_SCALING_REGISTER_COUNT 198
 
+// Changes to the PWM registers are tracked, and sent, in chunks of this many registers
+#define IS31FL3743A_PWM_CHUNK_SIZE 18
+#define IS31FL3743A_PWM_CHUNK_COUNT (IS31FL3743A_PWM_REGISTER_COUNT / IS31FL3743A_PWM_CHUNK_SIZE)
+#define IS31FL3743A_PWM_CHUNK(reg) (1 << ((reg) / IS31FL3743A_PWM_CHUNK_SIZE))
+
 #ifndef IS31FL3743A_I2C_TIMEOUT
 #    define IS31FL3743A_I2C_TIMEOUT 100
 #endif
@@ -34,6 +39,10 @@
 #    define IS31FL3743A_I2C_PERSISTENCE 0
 #endif
 
+#ifndef IS31FL3743A_I2C_TRANSFER_SIZE
+#    define IS31FL3743A_I2C_TRANSFER_SIZE IS31FL3743A_PWM_CHUNK_SIZE
+#endif
+
 #ifndef IS31FL3743A_CONFIGURATION
 #    define IS31FL3743A_CONFIGURATION 0x01
 #endif
@@ -90,15 +99,15 @@ const uint8_t driver_sync[IS31FL3743A_DRIVER_COUNT] = {
 };
 
 typedef struct is31fl3743a_driver_t {
-    uint8_t pwm_buffer[IS31FL3743A_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
-    uint8_t scaling_buffer[IS31FL3743A_SCALING_REGISTER_COUNT];
-    bool    scaling_buffer_dirty;
+    uint8_t  pwm_buffer[IS31FL3743A_PWM_REGISTER_COUNT];
+    uint16_t pwm_buffer_dirty;
+    uint8_t  scaling_buffer[IS31FL3743A_SCALING_REGISTER_COUNT];
+    bool     scaling_buffer_dirty;
 } PACKED is31fl3743a_driver_t;
 
 is31fl3743a_driver_t driver_buffers[IS31FL3743A_DRIVER_COUNT] = {{
     .pwm_buffer           = {0},
-    .pwm_buffer_dirty     = false,
+    .pwm_buffer_dirty     = 0,
     .scaling_buffer       = {0},
     .scaling_buffer_dirty = false,
 }};
@@ -120,16 +129,30 @@ void is31fl3743a_select_page(uint8_t index, uint8_t page) {
 
 void is31fl3743a_write_pwm_buffer(uint8_t index) {
     // Assumes page 0 is already selected.
-    // Transmit PWM registers in 11 transfers of 18 bytes.
+    // Transmit the PWM registers that have changed since the last update,
+    // merging neighbouring chunks into transfers of up to IS31FL3743A_I2C_TRANSFER_SIZE bytes.
+    uint16_t dirty = driver_buffers[index].pwm_buffer_dirty;
+    uint8_t  chunk = 0;
+
+    while (chunk < IS31FL3743A_PWM_CHUNK_COUNT) {
+        if (!(dirty & (1 << chunk))) {
+            chunk++;
+            continue;
+        }
+
+        uint8_t  reg    = chunk * IS31FL3743A_PWM_CHUNK_SIZE;
+        uint16_t length = 0;
+        do {
+            length += IS31FL3743A_PWM_CHUNK_SIZE;
+            chunk++;
+        } while (chunk < IS31FL3743A_PWM_CHUNK_COUNT && (dirty & (1 << chunk)) && length + IS31FL3743A_PWM_CHUNK_SIZE <= IS31FL3743A_I2C_TRANSFER_SIZE);
 
-    // Iterate over the pwm_buffer contents at 18 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3743A_PWM_REGISTER_COUNT; i += 18) {
 #if IS31FL3743A_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3743A_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i + 1, driver_buffers[index].pwm_buffer + i, 18, IS31FL3743A_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+        for (uint8_t i = 0; i < IS31FL3743A_I2C_PERSISTENCE; i++) {
+            if (i2c_write_register(i2c_addresses[index] << 1, reg + 1, driver_buffers[index].pwm_buffer + reg, length, IS31FL3743A_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
         }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, i + 1, driver_buffers[index].pwm_buffer + i, 18, IS31FL3743A_I2C_TIMEOUT);
+        i2c_write_register(i2c_addresses[index] << 1, reg + 1, driver_buffers[index].pwm_buffer + reg, length, IS31FL3743A_I2C_TIMEOUT);
 #endif
     }
 }
@@ -198,7 +221,7 @@ void is31fl3743a_set_value(int index, uint8_t value) {
         }
 
         driver_buffers[led.driver].pwm_buffer[led.v] = value;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        driver_buffers[led.driver].pwm_buffer_dirty |= IS31FL3743A_PWM_CHUNK(led.v);
     }
 }
 
@@ -222,7 +245,7 @@ void is31fl3743a_update_pwm_buffers(uint8_t index) {
 
         is31fl3743a_write_pwm_buffer(index);
 
-        driver_buffers[index].pwm_buffer_dirty = false;
+        driver_buffers[index].pwm_buffer_dirty = 0;
     }
 }
 
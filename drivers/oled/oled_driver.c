@@ -148,6 +148,11 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 uint8_t         oled_buffer[OLED_MATRIX_SIZE];
 uint8_t *       oled_cursor;
 OLED_BLOCK_TYPE oled_dirty          = 0;
+#ifdef OLED_SKIP_UNCHANGED_BLOCKS
+// Hash of each block as it was last sent, valid only for the blocks set in oled_hashed
+static uint16_t        oled_block_hashes[OLED_BLOCK_COUNT];
+static OLED_BLOCK_TYPE oled_hashed = 0;
+#endif
 bool            oled_initialized    = false;
 bool            oled_active         = false;
 bool            oled_scrolling      = false;
@@ -206,6 +211,9 @@ __attribute__((weak)) bool oled_send_cmd(const uint8_t *data, uint16_t size) {
     i2c_status_t status = i2c_transmit((OLED_DISPLAY_ADDRESS << 1), data, size, OLED_I2C_TIMEOUT);
 
     return (status == I2C_STATUS_SUCCESS);
+#else
+    // Custom transports provide their own implementation
+    return false;
 #endif
 }
 
@@ -252,6 +260,8 @@ __attribute__((weak)) bool oled_send_data(const uint8_t *data, uint16_t size) {
 #elif defined(OLED_TRANSPORT_I2C)
     i2c_status_t status = i2c_write_register((OLED_DISPLAY_ADDRESS << 1), I2C_DATA, data, size, OLED_I2C_TIMEOUT);
     return (status == I2C_STATUS_SUCCESS);
+#else
+    return false;
 #endif
 }
 
@@ -365,6 +375,10 @@ bool oled_init(oled_rotation_t rotation) {
 #endif
 
     oled_clear();
+#ifdef OLED_SKIP_UNCHANGED_BLOCKS
+    // Nothing is known about what the display holds yet
+    oled_hashed = 0;
+#endif
     oled_initialized = true;
     oled_active      = true;
     oled_scrolling   = false;
@@ -384,25 +398,6 @@ void oled_clear(void) {
     oled_dirty  = OLED_ALL_BLOCKS_MASK;
 }
 
-static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
-    // Calculate commands to set memory addressing bounds.
-    uint8_t start_page   = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_WIDTH;
-    uint8_t start_column = OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_WIDTH;
-#if !OLED_IC_HAS_HORIZONTAL_MODE
-    // Commands for Page Addressing Mode. Sets starting page and column; has no end bound.
-    // Column value must be split into high and low nybble and sent as two commands.
-    cmd_array[0] = PAM_PAGE_ADDR | start_page;
-    cmd_array[1] = PAM_SETCOLUMN_LSB | ((OLED_COLUMN_OFFSET + start_column) & 0x0f);
-    cmd_array[2] = PAM_SETCOLUMN_MSB | ((OLED_COLUMN_OFFSET + start_column) >> 4 & 0x0f);
-#else
-    // Commands for use in Horizontal Addressing mode.
-    cmd_array[1] = start_column + OLED_COLUMN_OFFSET;
-    cmd_array[4] = start_page;
-    cmd_array[2] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) % OLED_DISPLAY_WIDTH + cmd_array[1];
-    cmd_array[5] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) / OLED_DISPLAY_WIDTH - 1 + cmd_array[4];
-#endif
-}
-
 static void calc_bounds_90(uint8_t update_start, uint8_t *cmd_array) {
     // Block numbering starts from the bottom left corner, going up and then to
     // the right.  The controller needs the page and column numbers for the top
@@ -448,6 +443,120 @@ static void rotate_90(const uint8_t *src, uint8_t *dest) {
     }
 }
 
+#ifdef OLED_SKIP_UNCHANGED_BLOCKS
+static uint16_t oled_hash_block(uint8_t block) {
+    // Fletcher-style checksum: cheap, and position dependent so moved content still shows up
+    const uint8_t *data = &oled_buffer[OLED_BLOCK_SIZE * block];
+    uint8_t        sum1 = 0;
+    uint8_t        sum2 = 0;
+    for (uint16_t i = 0; i < OLED_BLOCK_SIZE; ++i) {
+        sum1 += data[i];
+        sum2 += sum1;
+    }
+    return (uint16_t)sum2 << 8 | sum1;
+}
+#endif
+
+// Sends a run of consecutive blocks in the unrotated layout, where they are also
+// consecutive in display memory. Each page of the display needs its own window
+// unless horizontal addressing can wrap from one page onto the start of the next.
+static bool render_blocks(uint8_t first_block, uint8_t block_count) {
+    uint16_t start = OLED_BLOCK_SIZE * first_block;
+    uint16_t end   = start + OLED_BLOCK_SIZE * block_count;
+
+    while (start < end) {
+        uint8_t  page   = start / OLED_DISPLAY_WIDTH;
+        uint8_t  column = start % OLED_DISPLAY_WIDTH;
+        uint16_t length = end - start;
+#if OLED_IC_HAS_HORIZONTAL_MODE
+        // Wrapping goes back to the first column of the window, so only a window
+        // starting at column 0 can span more than one page
+        if (column > 0 && length > OLED_DISPLAY_WIDTH - column) {
+            length = OLED_DISPLAY_WIDTH - column;
+        }
+        uint8_t last_column     = length < OLED_DISPLAY_WIDTH ? column + length - 1 : OLED_DISPLAY_WIDTH - 1;
+        uint8_t last_page       = (start + length - 1) / OLED_DISPLAY_WIDTH;
+        uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, column + OLED_COLUMN_OFFSET, last_column + OLED_COLUMN_OFFSET, PAGE_ADDR, page, last_page};
+#else
+        // Page Addressing Mode sets the starting page and column, and has no end bound.
+        // Column value must be split into high and low nybble and sent as two commands.
+        if (length > OLED_DISPLAY_WIDTH - column) {
+            length = OLED_DISPLAY_WIDTH - column;
+        }
+        uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR | page, PAM_SETCOLUMN_LSB | ((OLED_COLUMN_OFFSET + column) & 0x0f), PAM_SETCOLUMN_MSB | ((OLED_COLUMN_OFFSET + column) >> 4 & 0x0f)};
+#endif
+
+        // Send column & page position
+        if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
+            print("oled_render offset command failed\n");
+            return false;
+        }
+
+        // Send render data chunk as is
+        if (!oled_send_data(&oled_buffer[start], length)) {
+            print("oled_render data failed\n");
+            return false;
+        }
+
+        start += length;
+    }
+    return true;
+}
+
+static bool render_block_90(uint8_t update_start) {
+    // Set column & page position
+#if OLED_IC_HAS_HORIZONTAL_MODE
+    static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
+#else
+    static uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
+#endif
+    calc_bounds_90(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
+
+    // Send column & page position
+    if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
+        print("oled_render offset command failed\n");
+        return false;
+    }
+
+    // Rotate the render chunks
+    const static uint8_t source_map[] = OLED_SOURCE_MAP;
+    const static uint8_t target_map[] = OLED_TARGET_MAP;
+
+    static uint8_t temp_buffer[OLED_BLOCK_SIZE];
+    memset(temp_buffer, 0, sizeof(temp_buffer));
+    for (uint8_t i = 0; i < sizeof(source_map); ++i) {
+        rotate_90(&oled_buffer[OLED_BLOCK_SIZE * update_start + source_map[i]], &temp_buffer[target_map[i]]);
+    }
+
+#if OLED_IC_HAS_HORIZONTAL_MODE
+    // Send render data chunk after rotating
+    if (!oled_send_data(&temp_buffer[0], OLED_BLOCK_SIZE)) {
+        print("oled_render90 data failed\n");
+        return false;
+    }
+#else
+    // For SH1106 or SH1107 the data chunk must be split into separate pieces for each page
+    const uint8_t columns_in_block = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) / OLED_DISPLAY_HEIGHT * 8;
+    const uint8_t num_pages        = OLED_BLOCK_SIZE / columns_in_block;
+    for (uint8_t i = 0; i < num_pages; ++i) {
+        // Send column & page position for all pages except the first one
+        if (i > 0) {
+            display_start[1]++;
+            if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
+                print("oled_render offset command failed\n");
+                return false;
+            }
+        }
+        // Send data for the page
+        if (!oled_send_data(&temp_buffer[columns_in_block * i], columns_in_block)) {
+            print("oled_render90 data failed\n");
+            return false;
+        }
+    }
+#endif
+    return true;
+}
+
 void oled_render_dirty(bool all) {
     // Do we have work to do?
     oled_dirty &= OLED_ALL_BLOCKS_MASK;
@@ -455,82 +564,66 @@ void oled_render_dirty(bool all) {
         return;
     }
 
+#ifdef OLED_SKIP_UNCHANGED_BLOCKS
+    // Drop blocks that were rewritten with what the display already shows
+    for (uint8_t i = 0; i < OLED_BLOCK_COUNT; ++i) {
+        OLED_BLOCK_TYPE block = (OLED_BLOCK_TYPE)1 << i;
+        if ((oled_dirty & oled_hashed & block) && oled_block_hashes[i] == oled_hash_block(i)) {
+            oled_dirty &= ~block;
+        }
+    }
+    if (!oled_dirty) {
+        return;
+    }
+#endif
+
     // Turn on display if it is off
     oled_on();
 
     uint8_t update_start  = 0;
     uint8_t num_processed = 0;
-    while (oled_dirty && (num_processed++ < OLED_UPDATE_PROCESS_LIMIT || all)) { // render all dirty blocks (up to the configured limit)
+    while (oled_dirty && (num_processed < OLED_UPDATE_PROCESS_LIMIT || all)) { // render all dirty blocks (up to the configured number of updates)
         // Find next dirty block
         while (!(oled_dirty & ((OLED_BLOCK_TYPE)1 << update_start))) {
             ++update_start;
         }
 
-        // Set column & page position
-#if OLED_IC_HAS_HORIZONTAL_MODE
-        static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
-#else
-        static uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
-#endif
+        // Unrotated, neighbouring dirty blocks are neighbours on the display as well and go out together
+        uint8_t block_count = 1;
         if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            calc_bounds(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
-        } else {
-            calc_bounds_90(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
+            while (update_start + block_count < OLED_BLOCK_COUNT && (oled_dirty & ((OLED_BLOCK_TYPE)1 << (update_start + block_count))) && block_count < OLED_UPDATE_MERGE_LIMIT) {
+                ++block_count;
+            }
         }
 
-        // Send column & page position
-        if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
-            print("oled_render offset command failed\n");
-            return;
-        }
+#ifdef OLED_SKIP_UNCHANGED_BLOCKS
+        // What the display holds is unknown until the transfer succeeds
+        OLED_BLOCK_TYPE blocks = (((OLED_BLOCK_TYPE)1 << (block_count - 1) << 1) - 1) << update_start;
+        oled_hashed &= ~blocks;
+#endif
 
         if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            // Send render data chunk as is
-            if (!oled_send_data(&oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE)) {
-                print("oled_render data failed\n");
+            if (!render_blocks(update_start, block_count)) {
                 return;
             }
         } else {
-            // Rotate the render chunks
-            const static uint8_t source_map[] = OLED_SOURCE_MAP;
-            const static uint8_t target_map[] = OLED_TARGET_MAP;
-
-            static uint8_t temp_buffer[OLED_BLOCK_SIZE];
-            memset(temp_buffer, 0, sizeof(temp_buffer));
-            for (uint8_t i = 0; i < sizeof(source_map); ++i) {
-                rotate_90(&oled_buffer[OLED_BLOCK_SIZE * update_start + source_map[i]], &temp_buffer[target_map[i]]);
-            }
-
-#if OLED_IC_HAS_HORIZONTAL_MODE
-            // Send render data chunk after rotating
-            if (!oled_send_data(&temp_buffer[0], OLED_BLOCK_SIZE)) {
-                print("oled_render90 data failed\n");
+            if (!render_block_90(update_start)) {
                 return;
             }
-#else
-            // For SH1106 or SH1107 the data chunk must be split into separate pieces for each page
-            const uint8_t columns_in_block = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) / OLED_DISPLAY_HEIGHT * 8;
-            const uint8_t num_pages        = OLED_BLOCK_SIZE / columns_in_block;
-            for (uint8_t i = 0; i < num_pages; ++i) {
-                // Send column & page position for all pages except the first one
-                if (i > 0) {
-                    display_start[1]++;
-                    if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
-                        print("oled_render offset command failed\n");
-                        return;
-                    }
-                }
-                // Send data for the page
-                if (!oled_send_data(&temp_buffer[columns_in_block * i], columns_in_block)) {
-                    print("oled_render90 data failed\n");
-                    return;
-                }
-            }
-#endif
         }
 
-        // Clear dirty flag of just rendered block
-        oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+        // Clear dirty flag of just rendered blocks
+        for (uint8_t i = 0; i < block_count; ++i, ++update_start) {
+            oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+#ifdef OLED_SKIP_UNCHANGED_BLOCKS
+            oled_block_hashes[update_start] = oled_hash_block(update_start);
+#endif
+        }
+#ifdef OLED_SKIP_UNCHANGED_BLOCKS
+        oled_hashed |= blocks;
+#endif
+        // A merged run counts as a single update, so merging isn't held back by the process limit
+        ++num_processed;
     }
 }
 
@@ -880,6 +973,10 @@ bool oled_scroll_off(void) {
         }
         oled_scrolling = false;
         oled_dirty     = OLED_ALL_BLOCKS_MASK;
+#ifdef OLED_SKIP_UNCHANGED_BLOCKS
+        // Scrolling has moved the display contents around
+        oled_hashed = 0;
+#endif
     }
     return !oled_scrolling;
 }
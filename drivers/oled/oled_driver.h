@@ -321,6 +321,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define OLED_UPDATE_PROCESS_LIMIT 1
 #endif
 
+#if !defined(OLED_UPDATE_MERGE_LIMIT)
+#    define OLED_UPDATE_MERGE_LIMIT 4
+#endif
+
 typedef struct __attribute__((__packed__)) {
     uint8_t *current_element;
     uint16_t remaining_element_count;
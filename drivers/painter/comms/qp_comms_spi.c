@@ -45,6 +45,26 @@ uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint3
     return byte_count - bytes_remaining;
 }
 
+#    if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+uint32_t qp_comms_spi_send_data_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    uint32_t       bytes_remaining = byte_count;
+    const uint8_t *p               = (const uint8_t *)data;
+    const uint32_t max_msg_length  = 1024;
+
+    // Each chunk waits for the one before it, only the last is still in flight on return
+    while (bytes_remaining > 0) {
+        uint32_t bytes_this_loop = QP_MIN(bytes_remaining, max_msg_length);
+        if (spi_transmit_async(p, bytes_this_loop) != SPI_STATUS_SUCCESS) {
+            break;
+        }
+        p += bytes_this_loop;
+        bytes_remaining -= bytes_this_loop;
+    }
+
+    return byte_count - bytes_remaining;
+}
+#    endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+
 void qp_comms_spi_stop(painter_device_t device) {
     painter_driver_t *     driver       = (painter_driver_t *)device;
     qp_comms_spi_config_t *comms_config = (qp_comms_spi_config_t *)driver->comms_config;
@@ -57,6 +77,9 @@ const painter_comms_vtable_t spi_comms_vtable = {
     .comms_start = qp_comms_spi_start,
     .comms_send  = qp_comms_spi_send_data,
     .comms_stop  = qp_comms_spi_stop,
+#    if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+    .comms_send_async = qp_comms_spi_send_data_async,
+#    endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -97,9 +120,20 @@ uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void *da
     return qp_comms_spi_send_data(device, data, byte_count);
 }
 
+#        if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+uint32_t qp_comms_spi_dc_reset_send_data_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    painter_driver_t *              driver       = (painter_driver_t *)device;
+    qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+    gpio_write_pin_high(comms_config->dc_pin);
+    return qp_comms_spi_send_data_async(device, data, byte_count);
+}
+#        endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+
 void qp_comms_spi_dc_reset_send_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t *              driver       = (painter_driver_t *)device;
     qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+    // Pixel data may still be going out in the background, and needs to finish before D/C changes
+    spi_transmit_wait();
     gpio_write_pin_low(comms_config->dc_pin);
     spi_write(cmd);
 }
@@ -135,6 +169,9 @@ const painter_comms_with_command_vtable_t spi_comms_with_dc_vtable = {
             .comms_start = qp_comms_spi_start,
             .comms_send  = qp_comms_spi_dc_reset_send_data,
             .comms_stop  = qp_comms_spi_stop,
+#        if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+            .comms_send_async = qp_comms_spi_dc_reset_send_data_async,
+#        endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
         },
     .send_command          = qp_comms_spi_dc_reset_send_command,
     .bulk_command_sequence = qp_comms_spi_dc_reset_bulk_command_sequence,
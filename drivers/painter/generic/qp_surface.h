@@ -21,6 +21,22 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_DIRTY_TILE_SIZE
+/**
+ * @def The edge length, in pixels, of the tiles used to track which parts of a surface have changed. Must be a power of
+ *      two. Changes in separate tiles are sent to the target as separate rectangles instead of one bounding box.
+ */
+#    define SURFACE_DIRTY_TILE_SIZE 16
+#endif
+
+#ifndef SURFACE_DIRTY_MAX_TILES
+/**
+ * @def The maximum number of dirty tiles tracked for each surface, costing one bit of RAM each. Larger panels use larger
+ *      tiles to fit. Setting this to 1 tracks a single dirty bounding box.
+ */
+#    define SURFACE_DIRTY_MAX_TILES 256
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
@@ -49,6 +49,75 @@ void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y
     }
 }
 
+static inline bool dirty_tile_is_set(const surface_dirty_tiles_t *tiles, uint16_t tile) {
+    return (tiles->bits[tile / 8] & (1 << (tile % 8))) ? true : false;
+}
+
+static void init_dirty_tiles(surface_dirty_tiles_t *tiles, uint16_t width, uint16_t height) {
+    // Grow the tiles until the whole surface fits in the bitmap
+    tiles->shift = __builtin_ctz(SURFACE_DIRTY_TILE_SIZE);
+    while (true) {
+        tiles->columns = ((width - 1) >> tiles->shift) + 1;
+        tiles->rows    = ((height - 1) >> tiles->shift) + 1;
+        if ((uint32_t)tiles->columns * tiles->rows <= SURFACE_DIRTY_MAX_TILES) {
+            break;
+        }
+        tiles->shift++;
+    }
+}
+
+void qp_surface_update_dirty_tiles(surface_dirty_tiles_t *tiles, uint16_t x, uint16_t y) {
+    uint16_t tile = (y >> tiles->shift) * tiles->columns + (x >> tiles->shift);
+    tiles->bits[tile / 8] |= (1 << (tile % 8));
+}
+
+bool qp_surface_next_dirty_rect(const surface_dirty_data_t *dirty, surface_dirty_tiles_t *pending, surface_dirty_data_t *rect) {
+    uint16_t tile_count = pending->columns * pending->rows;
+    for (uint16_t tile = 0; tile < tile_count; ++tile) {
+        if (!dirty_tile_is_set(pending, tile)) {
+            continue;
+        }
+
+        // Merge the run of dirty tiles to the right
+        uint16_t l = tile % pending->columns;
+        uint16_t t = tile / pending->columns;
+        uint16_t r = l;
+        while (r + 1 < pending->columns && dirty_tile_is_set(pending, t * pending->columns + r + 1)) {
+            r++;
+        }
+
+        // Extend it downwards while the row below is dirty across the same span
+        uint16_t b = t;
+        while (b + 1 < pending->rows) {
+            bool whole_span = true;
+            for (uint16_t x = l; x <= r && whole_span; ++x) {
+                whole_span = dirty_tile_is_set(pending, (b + 1) * pending->columns + x);
+            }
+            if (!whole_span) {
+                break;
+            }
+            b++;
+        }
+
+        // Take the tiles out of the pending set
+        for (uint16_t y = t; y <= b; ++y) {
+            for (uint16_t x = l; x <= r; ++x) {
+                uint16_t taken = y * pending->columns + x;
+                pending->bits[taken / 8] &= ~(1 << (taken % 8));
+            }
+        }
+
+        // Every dirty tile holds a dirty pixel, so the tiles always overlap the dirty bounding box
+        rect->l        = MAX(l << pending->shift, dirty->l);
+        rect->t        = MAX(t << pending->shift, dirty->t);
+        rect->r        = MIN(((r + 1) << pending->shift) - 1, dirty->r);
+        rect->b        = MIN(((b + 1) << pending->shift) - 1, dirty->b);
+        rect->is_dirty = true;
+        return true;
+    }
+    return false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Driver vtable
 
@@ -63,6 +132,14 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     surface->dirty.b        = surface->base.panel_height - 1;
     surface->dirty.is_dirty = true;
 
+    init_dirty_tiles(&surface->dirty_tiles, surface->base.panel_width, surface->base.panel_height);
+    uint16_t tile_count = surface->dirty_tiles.columns * surface->dirty_tiles.rows;
+    memset(surface->dirty_tiles.bits, 0, sizeof(surface->dirty_tiles.bits));
+    memset(surface->dirty_tiles.bits, 0xFF, tile_count / 8);
+    if (tile_count % 8) {
+        surface->dirty_tiles.bits[tile_count / 8] = (1 << (tile_count % 8)) - 1;
+    }
+
     return true;
 }
 
@@ -83,6 +160,7 @@ bool qp_surface_flush(painter_device_t device) {
     surface->dirty.l = surface->dirty.t = UINT16_MAX;
     surface->dirty.r = surface->dirty.b = 0;
     surface->dirty.is_dirty             = false;
+    memset(surface->dirty_tiles.bits, 0, sizeof(surface->dirty_tiles.bits));
     return true;
 }
 
@@ -24,6 +24,13 @@ typedef struct surface_dirty_data_t {
     uint16_t b;
 } surface_dirty_data_t;
 
+typedef struct surface_dirty_tiles_t {
+    uint8_t  shift;   // log2 of the tile edge length
+    uint16_t columns; // tiles across the surface
+    uint16_t rows;    // tiles down the surface
+    uint8_t  bits[(SURFACE_DIRTY_MAX_TILES + 7) / 8];
+} surface_dirty_tiles_t;
+
 typedef struct surface_viewport_data_t {
     // Manually manage the viewport for streaming pixel data to the display
     uint16_t viewport_l;
@@ -52,6 +59,9 @@ typedef struct surface_painter_device_t {
 
     // Maintain a dirty region so we can stream only what we need
     surface_dirty_data_t dirty;
+
+    // Which tiles within the dirty region actually changed
+    surface_dirty_tiles_t dirty_tiles;
 } surface_painter_device_t;
 
 /**
@@ -89,6 +99,20 @@ bool qp_surface_flush(painter_device_t device);
 bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
 void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport);
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y);
+void qp_surface_update_dirty_tiles(surface_dirty_tiles_t *tiles, uint16_t x, uint16_t y);
+
+/**
+ * Takes the next rectangle of dirty tiles out of `pending`, which starts as a copy of the surface's `dirty_tiles`.
+ *
+ * Horizontally adjacent tiles are merged, then the run is extended downwards while the rows below are dirty across its
+ * whole width. The rectangle is clipped to the dirty bounding box.
+ *
+ * @param dirty[in] the dirty bounding box of the surface
+ * @param pending[in,out] the tiles still to be sent
+ * @param rect[out] the next region to send
+ * @return whether there was another region to send
+ */
+bool qp_surface_next_dirty_rect(const surface_dirty_data_t *dirty, surface_dirty_tiles_t *pending, surface_dirty_data_t *rect);
 
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
 
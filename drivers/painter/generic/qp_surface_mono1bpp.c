@@ -30,6 +30,7 @@ static inline void setpixel_mono1bpp(surface_painter_device_t *surface, uint16_t
     if (curr_val != mono_pixel) {
         // Update the dirty region
         qp_surface_update_dirty(&surface->dirty, x, y);
+        qp_surface_update_dirty_tiles(&surface->dirty_tiles, x, y);
 
         // Update the pixel data in the buffer
         if (mono_pixel) {
@@ -84,8 +85,73 @@ static bool qp_surface_append_pixels_mono1bpp(painter_device_t device, uint8_t *
     return true;
 }
 
+static bool mono1bpp_target_pixdata_transfer_rect(surface_painter_device_t *surface_handle, painter_driver_t *target_driver, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    // Set the target drawing area
+    bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
+    if (!ok) {
+        qp_dprintf("mono1bpp_target_pixdata_transfer: fail (could not set target viewport)\n");
+        return false;
+    }
+
+    // Housekeeping of the amount of pixels to transfer
+    uint32_t total_pixel_count = 8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE;
+    uint32_t pixel_counter     = 0;
+    uint8_t *target_buffer     = qp_internal_global_pixdata_buffer;
+
+    // Repack the region into the global pixdata area, in the same bit order as the surface
+    for (uint16_t y = t; y <= b; ++y) {
+        for (uint16_t x = l; x <= r; ++x) {
+            uint32_t pixel_num = y * surface_handle->base.panel_width + x;
+            if (pixel_counter % 8 == 0) {
+                target_buffer[pixel_counter / 8] = 0;
+            }
+            if (surface_handle->u8buffer[pixel_num / 8] & (1 << (pixel_num % 8))) {
+                target_buffer[pixel_counter / 8] |= (1 << (pixel_counter % 8));
+            }
+            pixel_counter++;
+
+            // If we've accumulated enough data, send it
+            if (pixel_counter == total_pixel_count) {
+                ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
+                if (!ok) {
+                    qp_dprintf("mono1bpp_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
+                    return false;
+                }
+                // Reset the counter
+                pixel_counter = 0;
+            }
+        }
+    }
+
+    // If there's any leftover data, send it
+    if (pixel_counter > 0) {
+        ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
+        if (!ok) {
+            qp_dprintf("mono1bpp_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
+            return false;
+        }
+    }
+
+    return true;
+}
+
 static bool mono1bpp_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
-    return false; // Not yet supported.
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+
+    if (entire_surface) {
+        return mono1bpp_target_pixdata_transfer_rect(surface_handle, target_driver, x, y, 0, 0, surface_handle->base.panel_width - 1, surface_handle->base.panel_height - 1);
+    }
+
+    // Send each changed region on its own, rather than everything in between
+    surface_dirty_tiles_t pending = surface_handle->dirty_tiles;
+    surface_dirty_data_t  rect;
+    while (qp_surface_next_dirty_rect(&surface_handle->dirty, &pending, &rect)) {
+        if (!mono1bpp_target_pixdata_transfer_rect(surface_handle, target_driver, x, y, rect.l, rect.t, rect.r, rect.b)) {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 static bool qp_surface_append_pixdata_mono1bpp(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
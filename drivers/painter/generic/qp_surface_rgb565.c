@@ -24,6 +24,7 @@ static inline void setpixel_rgb565(surface_painter_device_t *surface, uint16_t x
     if (surface->u16buffer[y * w + x] != rgb565) {
         // Update the dirty region
         qp_surface_update_dirty(&surface->dirty, x, y);
+        qp_surface_update_dirty_tiles(&surface->dirty_tiles, x, y);
 
         // Update the pixel data in the buffer
         surface->u16buffer[y * w + x] = rgb565;
@@ -68,14 +69,7 @@ static bool qp_surface_append_pixels_rgb565(painter_device_t device, uint8_t *ta
     return true;
 }
 
-static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
-    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
-
-    uint16_t l = entire_surface ? 0 : surface_handle->dirty.l;
-    uint16_t t = entire_surface ? 0 : surface_handle->dirty.t;
-    uint16_t r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r;
-    uint16_t b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b;
-
+static bool rgb565_target_pixdata_transfer_rect(surface_painter_device_t *surface_handle, painter_driver_t *target_driver, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
     // Set the target drawing area
     bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
     if (!ok) {
@@ -84,7 +78,7 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
     }
 
     // Housekeeping of the amount of pixels to transfer
-    uint32_t  total_pixel_count = (8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE) / surface_driver->native_bits_per_pixel;
+    uint32_t  total_pixel_count = (8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE) / surface_handle->base.native_bits_per_pixel;
     uint32_t  pixel_counter     = 0;
     uint16_t *target_buffer     = (uint16_t *)qp_internal_global_pixdata_buffer;
 
@@ -119,6 +113,25 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
     return true;
 }
 
+static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+
+    if (entire_surface) {
+        return rgb565_target_pixdata_transfer_rect(surface_handle, target_driver, x, y, 0, 0, surface_handle->base.panel_width - 1, surface_handle->base.panel_height - 1);
+    }
+
+    // Send each changed region on its own, rather than everything in between
+    surface_dirty_tiles_t pending = surface_handle->dirty_tiles;
+    surface_dirty_data_t  rect;
+    while (qp_surface_next_dirty_rect(&surface_handle->dirty, &pending, &rect)) {
+        if (!rgb565_target_pixdata_transfer_rect(surface_handle, target_driver, x, y, rect.l, rect.t, rect.r, rect.b)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 static bool qp_surface_append_pixdata_rgb565(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
     target_buffer[pixdata_offset] = pixdata_byte;
     return true;
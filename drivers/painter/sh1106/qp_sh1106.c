@@ -83,20 +83,25 @@ bool qp_sh1106_flush(painter_device_t device) {
         return true;
     }
 
-    switch (driver->oled.base.rotation) {
-        default:
-        case QP_ROTATION_0:
-            qp_oled_panel_page_column_flush_rot0(device, &driver->oled.surface.dirty, driver->framebuffer);
-            break;
-        case QP_ROTATION_90:
-            qp_oled_panel_page_column_flush_rot90(device, &driver->oled.surface.dirty, driver->framebuffer);
-            break;
-        case QP_ROTATION_180:
-            qp_oled_panel_page_column_flush_rot180(device, &driver->oled.surface.dirty, driver->framebuffer);
-            break;
-        case QP_ROTATION_270:
-            qp_oled_panel_page_column_flush_rot270(device, &driver->oled.surface.dirty, driver->framebuffer);
-            break;
+    // Only send the regions that changed
+    surface_dirty_tiles_t pending = driver->oled.surface.dirty_tiles;
+    surface_dirty_data_t  rect;
+    while (qp_surface_next_dirty_rect(&driver->oled.surface.dirty, &pending, &rect)) {
+        switch (driver->oled.base.rotation) {
+            default:
+            case QP_ROTATION_0:
+                qp_oled_panel_page_column_flush_rot0(device, &rect, driver->framebuffer);
+                break;
+            case QP_ROTATION_90:
+                qp_oled_panel_page_column_flush_rot90(device, &rect, driver->framebuffer);
+                break;
+            case QP_ROTATION_180:
+                qp_oled_panel_page_column_flush_rot180(device, &rect, driver->framebuffer);
+                break;
+            case QP_ROTATION_270:
+                qp_oled_panel_page_column_flush_rot270(device, &rect, driver->framebuffer);
+                break;
+        }
     }
 
     // Clear the dirty area
@@ -28,6 +28,19 @@ void soft_serial_target_init(void);
 
 bool soft_serial_transaction(int sstd_index);
 
+#ifdef SPLIT_TRANSPORT_ASYNC
+typedef enum {
+    SOFT_SERIAL_TRANSACTION_PENDING,
+    SOFT_SERIAL_TRANSACTION_SUCCESS,
+    SOFT_SERIAL_TRANSACTION_FAILED,
+} soft_serial_transaction_status_t;
+
+// starts a transaction in the background, returns false if one is already in flight
+bool soft_serial_transaction_start(int sstd_index);
+// status of the last started transaction
+soft_serial_transaction_status_t soft_serial_transaction_poll(void);
+#endif
+
 #ifdef SERIAL_DEBUG
 #    include <debug.h>
 #    include <print.h>
@@ -93,6 +93,23 @@ spi_status_t spi_read(void);
  */
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
 
+/**
+ * \brief Start sending multiple bytes to the selected SPI device, returning before the transfer completes.
+ *
+ * Any transfer already in progress is waited on first. The contents of `data` must be left untouched until the transfer has completed, which is guaranteed once `spi_transmit_wait()` or any other SPI function has been called. Platforms without DMA send the data before returning.
+ *
+ * \param data A pointer to the data to write from.
+ * \param length The number of bytes to write. Take care not to overrun the length of `data`.
+ *
+ * \return `SPI_STATUS_ERROR` if the transfer could not be started, otherwise `SPI_STATUS_SUCCESS`.
+ */
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length);
+
+/**
+ * \brief Wait for a transfer started by `spi_transmit_async()` to complete.
+ */
+void spi_transmit_wait(void);
+
 /**
  * \brief Receive multiple bytes from the selected SPI device.
  *
@@ -83,6 +83,7 @@ subcommands = [
     'qmk.cli.painter',
     'qmk.cli.pytest',
     'qmk.cli.resolve_alias',
+    'qmk.cli.test.bench',
     'qmk.cli.test.c',
     'qmk.cli.userspace.add',
     'qmk.cli.userspace.compile',
@@ -204,6 +204,10 @@ def generate_config_h(cli):
     if 'rgb_matrix' in kb_info_json:
         generate_led_animations_config('rgb_matrix', kb_info_json['rgb_matrix'], config_h_lines, 'ENABLE_RGB_MATRIX_', 'RGB_MATRIX_')
 
+        # generate-keyboard-c emits g_rgb_matrix_led_geometry alongside g_led_config
+        if 'layout' in kb_info_json['rgb_matrix'] and not cli.args.filename:
+            config_h_lines.append(generate_define('RGB_MATRIX_LED_GEOMETRY_TABLE'))
+
     if 'rgblight' in kb_info_json:
         generate_led_animations_config('rgblight', kb_info_json['rgblight'], config_h_lines, 'RGBLIGHT_EFFECT_', 'RGBLIGHT_MODE_')
 
@@ -25,6 +25,76 @@ def _gen_led_configs(info_data):
     return lines
 
 
+def _c_div(a, b):
+    """Integer division truncating towards zero, as in C.
+    """
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b >= 0) else -q
+
+
+def _sqrt16(x):
+    """Port of lib8tion's sqrt16(), including its truncation of the argument to uint16_t.
+    """
+    x &= 0xFFFF
+    if x <= 1:
+        return x
+
+    low = 1
+    hi = 255 if x > 7904 else (x >> 5) + 8
+    while hi >= low:
+        mid = (low + hi) >> 1
+        if (mid * mid) & 0xFFFF > x:
+            hi = mid - 1
+        else:
+            if mid == 255:
+                return 255
+            low = mid + 1
+
+    return low - 1
+
+
+def _atan2_8(dy, dx):
+    """Port of lib8tion's atan2_8().
+    """
+    if dy == 0:
+        return 0 if dx >= 0 else 128
+
+    abs_y = abs(dy)
+    if dx >= 0:
+        a = 32 - _c_div(32 * (dx - abs_y), dx + abs_y)
+    else:
+        a = 96 - _c_div(32 * (dx + abs_y), abs_y - dx)
+
+    # int8_t a, returned as uint8_t
+    a = (a + 128) % 256 - 128
+    if dy < 0:
+        a = -a
+    return a & 0xFF
+
+
+def _gen_led_geometry(info_data, config_type):
+    """Precompute the distance and angle of every LED from the center, as used by the effect runners
+    """
+    center_x, center_y = info_data[config_type].get('center_point', [112, 32])
+
+    geometry = []
+    for led_data in info_data[config_type]['layout']:
+        dx = led_data.get('x', 0) - center_x
+        dy = led_data.get('y', 0) - center_y
+        geometry.append(f'{{{dx}, {dy}, {_sqrt16(dx * dx + dy * dy)}, {_atan2_8(dy, dx)}}}')
+
+    lines = []
+    # A LED count overridden in config.h leaves rgb_matrix.c with its weak, unused table
+    lines.append(f'#if defined(RGB_MATRIX_LED_GEOMETRY_TABLE) && RGB_MATRIX_LED_COUNT == {len(geometry)}')
+    lines.append('const led_geometry_t g_rgb_matrix_led_geometry[RGB_MATRIX_LED_COUNT] PROGMEM = {')
+    for index in range(0, len(geometry), 8):
+        lines.append(f'  {", ".join(geometry[index:index + 8])},')
+    lines.append('};')
+    lines.append('#endif')
+
+    return lines
+
+
 def _gen_led_config(info_data, config_type):
     """Convert info.json content to g_led_config
     """
@@ -60,6 +130,8 @@ def _gen_led_config(info_data, config_type):
     lines.append(f'  {{ {", ".join(pos)} }},')
     lines.append(f'  {{ {", ".join(flags)} }},')
     lines.append('};')
+    if config_type == 'rgb_matrix':
+        lines.extend(_gen_led_geometry(info_data, config_type))
     lines.append('#endif')
     lines.append('')
 
@@ -0,0 +1,151 @@
+"""Build and run the C benchmarks, and collect their results as JSON.
+"""
+import fnmatch
+import json
+import os
+import re
+from pathlib import Path
+from subprocess import DEVNULL
+
+from milc import cli
+
+import qmk.path
+from qmk.commands import find_make, get_make_parallel_args, build_environment
+from qmk.constants import BUILD_DIR
+from qmk.git import git_get_qmk_hash
+
+BENCH_PREFIX = 'bench/'
+BENCH_RESULTS_DIR = Path(BUILD_DIR) / 'bench'
+
+
+def _collect_results(results_dir):
+    """Gathers the benchmark figures recorded in googletest's JSON output files.
+    """
+    benchmarks = {}
+
+    for results_file in sorted(results_dir.glob('*.elf.json')):
+        target = BENCH_PREFIX + results_file.name.split('.', 1)[0][len('bench_'):]
+        results = json.loads(results_file.read_text(encoding='utf-8'))
+
+        for suite in results.get('testsuites', []):
+            for test in suite.get('testsuite', []):
+                if 'ns_per_op' not in test:
+                    continue
+
+                benchmark = {
+                    'target': target,
+                    'iterations': int(test['iterations']),
+                    'ns_per_op': float(test['ns_per_op']),
+                }
+                if 'cycles_per_op' in test:
+                    benchmark['cycles_per_op'] = float(test['cycles_per_op'])
+
+                benchmarks[f'{test["classname"]}.{test["name"]}'] = benchmark
+
+    return benchmarks
+
+
+def _compare_results(baseline, benchmarks, threshold):
+    """Logs the change against a baseline for each benchmark, returning the names of those that slowed down by more than `threshold` percent.
+    """
+    regressions = []
+
+    for name, benchmark in benchmarks.items():
+        if name not in baseline:
+            cli.log.info('{fg_cyan}%s{fg_reset}: %.1f ns/op (new)', name, benchmark['ns_per_op'])
+            continue
+
+        before = baseline[name]['ns_per_op']
+        change = (benchmark['ns_per_op'] - before) / before * 100 if before else 0
+
+        if change > threshold:
+            regressions.append(name)
+            cli.log.error('{fg_cyan}%s{fg_reset}: %.1f ns/op, {fg_red}%+.1f%%{fg_reset} against %.1f ns/op', name, benchmark['ns_per_op'], change, before)
+        else:
+            cli.log.info('{fg_cyan}%s{fg_reset}: %.1f ns/op, %+.1f%% against %.1f ns/op', name, benchmark['ns_per_op'], change, before)
+
+    return regressions
+
+
+@cli.argument('-j', '--parallel', type=int, default=1, help="Set the number of parallel make jobs; 0 means unlimited.")
+@cli.argument('-e', '--env', arg_only=True, action='append', default=[], help="Set a variable to be passed to make. May be passed multiple times.")
+@cli.argument('-c', '--clean', arg_only=True, action='store_true', help="Remove object files before compiling.")
+@cli.argument('-l', '--list', arg_only=True, action='store_true', help='List available benchmarks.')
+@cli.argument('-t', '--test', arg_only=True, action='append', default=[], help="Benchmark to run from the available list. Supports wildcard globs. May be passed multiple times.")
+@cli.argument('-s', '--scale', type=int, default=100, help="Multiply the iteration count of every benchmark by this much.")
+@cli.argument('-o', '--output', arg_only=True, type=qmk.path.normpath, help=f"File to write the results to. Defaults to {BENCH_RESULTS_DIR / 'results.json'}.")
+@cli.argument('-b', '--baseline', arg_only=True, type=qmk.path.normpath, help="Results of an earlier run to compare against. Slower benchmarks are reported as failures.")
+@cli.argument('--threshold', type=float, default=10.0, help="Slowdown, in percent, that counts as a regression when comparing against a baseline.")
+@cli.subcommand("QMK C Benchmarks.", hidden=False if cli.config.user.developer else True)
+def test_bench(cli):
+    """Run the host-side benchmarks under tests/bench and write their results as JSON.
+    """
+    list_tests = cli.run([find_make(), 'list-tests', 'SILENT=true'])
+    available_benchmarks = sorted(test for test in list_tests.stdout.strip().split() if test.startswith(BENCH_PREFIX))
+
+    if cli.args.list:
+        return print("\n".join(available_benchmarks))
+
+    # expand any wildcards, with or without the leading "bench/"
+    filtered_benchmarks = set()
+    for test in cli.args.test:
+        regex = re.compile(fnmatch.translate(test))
+        filtered_benchmarks |= set(filter(lambda x: regex.match(x) or regex.match(x[len(BENCH_PREFIX):]), available_benchmarks))
+
+    if cli.args.test and not filtered_benchmarks:
+        cli.log.error('No benchmarks match: %s', ', '.join(cli.args.test))
+        return False
+
+    # convert benchmark names to build targets
+    targets = list(map(lambda x: f'test:{x}', sorted(filtered_benchmarks or available_benchmarks)))
+
+    if cli.args.clean:
+        targets.insert(0, 'clean')
+
+    # Add in the environment vars
+    for key, value in build_environment(cli.args.env).items():
+        targets.append(f'{key}={value}')
+
+    # Read this up front, as it may well be the output of the last run
+    baseline = None
+    if cli.args.baseline:
+        if not cli.args.baseline.exists():
+            cli.log.error('Baseline results not found: {fg_cyan}%s', cli.args.baseline)
+            return False
+
+        baseline = json.loads(cli.args.baseline.read_text(encoding='utf-8'))
+
+    # Results from a previous run must not be mixed in with this one
+    BENCH_RESULTS_DIR.mkdir(parents=True, exist_ok=True)
+    for results_file in BENCH_RESULTS_DIR.glob('*.elf.json'):
+        results_file.unlink()
+
+    env = os.environ.copy()
+    env['GTEST_OUTPUT'] = f'json:{BENCH_RESULTS_DIR.resolve().as_posix()}/'
+    env['QMK_BENCH_SCALE'] = str(cli.config.test_bench.scale)
+
+    command = [find_make(), *get_make_parallel_args(cli.config.test_bench.parallel), *targets]
+
+    cli.log.info('Compiling benchmarks with {fg_cyan}%s', ' '.join(command))
+    returncode = cli.run(command, capture_output=False, stdin=DEVNULL, env=env).returncode
+    if returncode != 0:
+        return returncode
+
+    results = {
+        'commit': git_get_qmk_hash(),
+        'scale': cli.config.test_bench.scale,
+        'benchmarks': _collect_results(BENCH_RESULTS_DIR),
+    }
+
+    output = cli.args.output or BENCH_RESULTS_DIR / 'results.json'
+    output.parent.mkdir(parents=True, exist_ok=True)
+    output.write_text(json.dumps(results, indent=4, sort_keys=True) + '\n', encoding='utf-8')
+    cli.log.info('Wrote %d benchmark results to {fg_cyan}%s', len(results['benchmarks']), output)
+
+    if baseline:
+        regressions = _compare_results(baseline.get('benchmarks', {}), results['benchmarks'], cli.config.test_bench.threshold)
+        if regressions:
+            cli.log.error('%d benchmark(s) slowed down by more than %.1f%%', len(regressions), cli.config.test_bench.threshold)
+            return False
+
+    return True
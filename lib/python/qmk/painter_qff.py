@@ -136,6 +136,7 @@ class QFFUnicodeGlyphTableV1:
         self.header.length = len(self.glyphs.keys()) * 6
         self.header.write(fp)
 
+        # Firmware binary searches this table, so it must stay in ascending code point order
         for n in sorted(self.glyphs.keys()):
             self.glyphs[n].write(fp, True)
 
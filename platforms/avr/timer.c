@@ -125,6 +125,14 @@ inline uint32_t timer_read32(void) {
     return t;
 }
 
+uint32_t timer_read_fine(void) {
+    return timer_read32();
+}
+
+uint32_t timer_fine_to_us(uint32_t fine) {
+    return fine * 1000;
+}
+
 // excecuted once per 1ms.(excess for just timer count?)
 #ifndef __AVR_ATmega32A__
 #    define TIMER_INTERRUPT_VECTOR TIMER0_COMPA_vect
@@ -10,6 +10,20 @@
 static inline bool initiate_transaction(uint8_t transaction_id);
 static inline bool react_to_transaction(void);
 
+/**
+ * @brief Receives a transaction buffer. Of framed buffers only the used part
+ * is transferred, which is given by their first byte.
+ */
+static inline bool receive_transaction_buffer(uint8_t* buffer, size_t size, bool framed) {
+    if (framed) {
+        if (unlikely(!serial_transport_receive(buffer, 1) || (size_t)buffer[0] + 1 > size)) {
+            return false;
+        }
+        return buffer[0] == 0 || serial_transport_receive(buffer + 1, buffer[0]);
+    }
+    return serial_transport_receive(buffer, size);
+}
+
 /**
  * @brief This thread runs on the slave and responds to transactions initiated
  * by the master.
@@ -38,11 +52,38 @@ void soft_serial_target_init(void) {
     chThdCreateStatic(waSlaveThread, sizeof(waSlaveThread), HIGHPRIO, SlaveThread, NULL);
 }
 
+#ifdef SPLIT_TRANSPORT_ASYNC
+static BSEMAPHORE_DECL(async_start, true);
+static volatile int                              async_index  = 0;
+static volatile soft_serial_transaction_status_t async_status = SOFT_SERIAL_TRANSACTION_FAILED;
+
+/**
+ * @brief This thread runs on the master and carries out the transactions
+ * started by soft_serial_transaction_start(), so that the main loop doesn't
+ * wait for the other half.
+ */
+static THD_WORKING_AREA(waMasterThread, 512);
+static THD_FUNCTION(MasterThread, arg) {
+    (void)arg;
+    chRegSetThreadName("split_protocol_async");
+
+    while (true) {
+        chBSemWait(&async_start);
+        async_status = soft_serial_transaction(async_index) ? SOFT_SERIAL_TRANSACTION_SUCCESS : SOFT_SERIAL_TRANSACTION_FAILED;
+    }
+}
+#endif // SPLIT_TRANSPORT_ASYNC
+
 /**
  * @brief Master specific initializations.
  */
 void soft_serial_initiator_init(void) {
     serial_transport_driver_master_init();
+
+#ifdef SPLIT_TRANSPORT_ASYNC
+    /* Start transport thread, above the main loop so that it resumes as soon as the driver has data. */
+    chThdCreateStatic(waMasterThread, sizeof(waMasterThread), NORMALPRIO + 1, MasterThread, NULL);
+#endif // SPLIT_TRANSPORT_ASYNC
 }
 
 /**
@@ -73,7 +114,7 @@ static inline bool react_to_transaction(void) {
 
     /* Receive transaction buffer from the master. If this transaction requires it.*/
     if (transaction->initiator2target_buffer_size) {
-        if (unlikely(!serial_transport_receive(split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
+        if (unlikely(!receive_transaction_buffer(split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size, transaction->flags & SPLIT_TRANS_FRAMED_INITIATOR2TARGET))) {
             return false;
         }
     }
@@ -85,7 +126,7 @@ static inline bool react_to_transaction(void) {
 
     /* Send transaction buffer to the master. If this transaction requires it. */
     if (transaction->target2initiator_buffer_size) {
-        if (unlikely(!serial_transport_send(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
+        if (unlikely(!serial_transport_send(split_trans_target2initiator_buffer(transaction), split_trans_target2initiator_length(transaction)))) {
             return false;
         }
     }
@@ -107,6 +148,32 @@ bool soft_serial_transaction(int index) {
     return initiate_transaction((uint8_t)index);
 }
 
+#ifdef SPLIT_TRANSPORT_ASYNC
+/**
+ * @brief Start transaction from the master half to the slave half, without
+ * waiting for it to complete.
+ *
+ * @param index Transaction Table index of the transaction to start.
+ * @return bool False if a transaction is still in flight.
+ */
+bool soft_serial_transaction_start(int index) {
+    if (async_status == SOFT_SERIAL_TRANSACTION_PENDING) {
+        return false;
+    }
+    async_index  = index;
+    async_status = SOFT_SERIAL_TRANSACTION_PENDING;
+    chBSemSignal(&async_start);
+    return true;
+}
+
+/**
+ * @brief Status of the transaction started by soft_serial_transaction_start().
+ */
+soft_serial_transaction_status_t soft_serial_transaction_poll(void) {
+    return async_status;
+}
+#endif // SPLIT_TRANSPORT_ASYNC
+
 /**
  * @brief Initiate transaction to slave half.
  */
@@ -140,7 +207,7 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
 
     /* Send transaction buffer to the slave. If this transaction requires it. */
     if (transaction->initiator2target_buffer_size) {
-        if (unlikely(!serial_transport_send(split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
+        if (unlikely(!serial_transport_send(split_trans_initiator2target_buffer(transaction), split_trans_initiator2target_length(transaction)))) {
             serial_dprintf("SPLIT: sending buffer failed\n");
             return false;
         }
@@ -148,7 +215,7 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
 
     /* Receive transaction buffer from the slave. If this transaction requires it. */
     if (transaction->target2initiator_buffer_size) {
-        if (unlikely(!serial_transport_receive(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
+        if (unlikely(!receive_transaction_buffer(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size, transaction->flags & SPLIT_TRANS_FRAMED_TARGET2INITIATOR))) {
             serial_dprintf("SPLIT: receiving buffer failed\n");
             return false;
         }
@@ -436,7 +436,19 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
     return spi_start_extended(&start_config);
 }
 
+// The driver state is changed from the DMA completion interrupt, so it has to be re-read on every check
+static inline spistate_t spi_state(void) {
+    return *(volatile spistate_t *)&SPI_DRIVER.state;
+}
+
+// Transfers started by spi_transmit_async() have to finish before the bus is used for anything else
+static inline void spi_wait_idle(void) {
+    while (spi_state() == SPI_ACTIVE) {
+    }
+}
+
 spi_status_t spi_write(uint8_t data) {
+    spi_wait_idle();
     uint8_t rxData;
     spiExchange(&SPI_DRIVER, 1, &data, &rxData);
 
@@ -444,6 +456,7 @@ spi_status_t spi_write(uint8_t data) {
 }
 
 spi_status_t spi_read(void) {
+    spi_wait_idle();
     uint8_t data = 0;
     spiReceive(&SPI_DRIVER, 1, &data);
 
@@ -451,17 +464,33 @@ spi_status_t spi_read(void) {
 }
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    spi_wait_idle();
     spiSend(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    spi_wait_idle();
+    if (spi_state() != SPI_READY) {
+        return SPI_STATUS_ERROR;
+    }
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
+void spi_transmit_wait(void) {
+    spi_wait_idle();
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    spi_wait_idle();
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
 void spi_stop(void) {
     if (spiStarted) {
+        spi_wait_idle();
         spi_unselect();
         spiStop(&SPI_DRIVER);
         spiStarted = false;
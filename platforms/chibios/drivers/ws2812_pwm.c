@@ -1,3 +1,5 @@
+#include <string.h>
+
 #include "ws2812.h"
 #include "gpio.h"
 #include "chibios_config.h"
@@ -292,6 +294,30 @@ typedef uint8_t ws2812_buffer_t;
 
 static ws2812_buffer_t ws2812_frame_buffer[WS2812_BIT_N + 1]; /**< Buffer for a frame */
 
+/**
+ * @brief   Duty cycles for each nibble of colour data, most significant bit first
+ *
+ * Lets a colour byte be written as two four-entry copies instead of eight separate bit tests.
+ */
+#define WS2812_DUTYCYCLE(set) ((set) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0)
+#define WS2812_NIBBLE(n) \
+    { WS2812_DUTYCYCLE((n)&8), WS2812_DUTYCYCLE((n)&4), WS2812_DUTYCYCLE((n)&2), WS2812_DUTYCYCLE((n)&1) }
+
+static const ws2812_buffer_t ws2812_nibble_duty_cycles[16][4] = {
+    WS2812_NIBBLE(0),  WS2812_NIBBLE(1),  WS2812_NIBBLE(2),  WS2812_NIBBLE(3),  //
+    WS2812_NIBBLE(4),  WS2812_NIBBLE(5),  WS2812_NIBBLE(6),  WS2812_NIBBLE(7),  //
+    WS2812_NIBBLE(8),  WS2812_NIBBLE(9),  WS2812_NIBBLE(10), WS2812_NIBBLE(11), //
+    WS2812_NIBBLE(12), WS2812_NIBBLE(13), WS2812_NIBBLE(14), WS2812_NIBBLE(15), //
+};
+
+/**
+ * @brief   Write the duty cycles for one colour byte, starting at its most significant bit
+ */
+static inline void ws2812_write_byte(ws2812_buffer_t *dst, uint8_t value) {
+    memcpy(dst, ws2812_nibble_duty_cycles[value >> 4], sizeof(ws2812_nibble_duty_cycles[0]));
+    memcpy(dst + 4, ws2812_nibble_duty_cycles[value & 0x0F], sizeof(ws2812_nibble_duty_cycles[0]));
+}
+
 /* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
 /*
  * Gedanke: Double-buffer type transactions: double buffer transfers using two memory pointers for
@@ -374,22 +400,18 @@ void ws2812_init(void) {
 
 void ws2812_write_led(uint16_t led_number, uint8_t r, uint8_t g, uint8_t b) {
     // Write color to frame buffer
-    for (uint8_t bit = 0; bit < 8; bit++) {
-        ws2812_frame_buffer[WS2812_RED_BIT(led_number, bit)]   = ((r >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_GREEN_BIT(led_number, bit)] = ((g >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_BLUE_BIT(led_number, bit)]  = ((b >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-    }
+    ws2812_write_byte(&ws2812_frame_buffer[WS2812_RED_BIT(led_number, 7)], r);
+    ws2812_write_byte(&ws2812_frame_buffer[WS2812_GREEN_BIT(led_number, 7)], g);
+    ws2812_write_byte(&ws2812_frame_buffer[WS2812_BLUE_BIT(led_number, 7)], b);
 }
 void ws2812_write_led_rgbw(uint16_t led_number, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
     // Write color to frame buffer
-    for (uint8_t bit = 0; bit < 8; bit++) {
-        ws2812_frame_buffer[WS2812_RED_BIT(led_number, bit)]   = ((r >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_GREEN_BIT(led_number, bit)] = ((g >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_BLUE_BIT(led_number, bit)]  = ((b >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+    ws2812_write_byte(&ws2812_frame_buffer[WS2812_RED_BIT(led_number, 7)], r);
+    ws2812_write_byte(&ws2812_frame_buffer[WS2812_GREEN_BIT(led_number, 7)], g);
+    ws2812_write_byte(&ws2812_frame_buffer[WS2812_BLUE_BIT(led_number, 7)], b);
 #ifdef WS2812_RGBW
-        ws2812_frame_buffer[WS2812_WHITE_BIT(led_number, bit)] = ((w >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+    ws2812_write_byte(&ws2812_frame_buffer[WS2812_WHITE_BIT(led_number, 7)], w);
 #endif
-    }
 }
 
 ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
@@ -0,0 +1,39 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+#    error "The WS2812 SPI encoding assumes a little-endian target"
+#endif
+
+/*
+ * As the trick here is to use the SPI to send a huge pattern of 0 and 1 to
+ * the ws2812b protocol, every data bit goes out as four SPI bits - 0b1110 for
+ * a one, 0b1000 for a zero - so each colour byte becomes four bytes on the wire,
+ * most significant bit first.
+ *
+ * The patterns are worked out ahead of time, one table entry per nibble of
+ * colour data, holding the two bytes it expands to in memory order.
+ */
+#define WS2812_SPI_BIT(set) ((set) ? 0xE : 0x8)
+#define WS2812_SPI_NIBBLE(n) ((WS2812_SPI_BIT((n)&8) << 4) | WS2812_SPI_BIT((n)&4) | (WS2812_SPI_BIT((n)&2) << 12) | (WS2812_SPI_BIT((n)&1) << 8))
+
+static const uint16_t ws2812_spi_nibbles[16] = {
+    WS2812_SPI_NIBBLE(0),  WS2812_SPI_NIBBLE(1),  WS2812_SPI_NIBBLE(2),  WS2812_SPI_NIBBLE(3),  //
+    WS2812_SPI_NIBBLE(4),  WS2812_SPI_NIBBLE(5),  WS2812_SPI_NIBBLE(6),  WS2812_SPI_NIBBLE(7),  //
+    WS2812_SPI_NIBBLE(8),  WS2812_SPI_NIBBLE(9),  WS2812_SPI_NIBBLE(10), WS2812_SPI_NIBBLE(11), //
+    WS2812_SPI_NIBBLE(12), WS2812_SPI_NIBBLE(13), WS2812_SPI_NIBBLE(14), WS2812_SPI_NIBBLE(15), //
+};
+
+/**
+ * \brief Expand one colour byte into the four bytes the SPI peripheral sends for it.
+ *
+ * The result is meant to be stored as a single word; its bytes are in
+ * transmission order on a little-endian target.
+ */
+static inline uint32_t ws2812_spi_encode(uint8_t data) {
+    return ws2812_spi_nibbles[data >> 4] | ((uint32_t)ws2812_spi_nibbles[data & 0x0F] << 16);
+}
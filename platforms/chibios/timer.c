@@ -1,6 +1,7 @@
 #include <ch.h>
 
 #include "timer.h"
+#include "chibios_config.h"
 
 static uint32_t ticks_offset = 0;
 static uint32_t last_ticks   = 0;
@@ -118,3 +119,29 @@ uint32_t timer_read32(void) {
 
     return (uint32_t)TIME_I2MS(ticks) + ms_offset_copy;
 }
+
+uint32_t timer_read_fine(void) {
+#if PORT_SUPPORTS_RT == TRUE
+    return chSysGetRealtimeCounterX();
+#else
+    // Cores without a cycle counter (Cortex-M0/M0+) fall back to system ticks
+    syssts_t sts   = chSysGetStatusAndLockX();
+    uint32_t ticks = get_system_time_ticks();
+    chSysRestoreStatusX(sts);
+    return ticks;
+#endif
+}
+
+uint32_t timer_fine_to_us(uint32_t fine) {
+#if PORT_SUPPORTS_RT == TRUE
+    if (REALTIME_COUNTER_CLOCK % 1000000 == 0) {
+        return fine / (REALTIME_COUNTER_CLOCK / 1000000);
+    }
+    return (uint32_t)(((uint64_t)fine * 1000000) / REALTIME_COUNTER_CLOCK);
+#else
+    if (1000000 % CH_CFG_ST_FREQUENCY == 0) {
+        return fine * (1000000 / CH_CFG_ST_FREQUENCY);
+    }
+    return (uint32_t)(((uint64_t)fine * 1000000) / CH_CFG_ST_FREQUENCY);
+#endif
+}
@@ -23,3 +23,17 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+ws2812_spi_DEFS := -DWS2812_LED_COUNT=5 -DWS2812_DI_PIN=0
+ws2812_spi_INC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/ws2812_spi_mock/ \
+	$(PLATFORM_PATH)/chibios/drivers/ \
+	$(TOP_DIR)/drivers/led/
+ws2812_spi_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/ws2812_spi_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/ws2812_spi_mock.c \
+	$(PLATFORM_PATH)/chibios/drivers/ws2812_spi.c \
+	$(TOP_DIR)/drivers/led/ws2812.c
+ws2812_spi_rgbw_DEFS := $(ws2812_spi_DEFS) -DWS2812_RGBW -DWS2812_BYTE_ORDER=WS2812_BYTE_ORDER_RGB
+ws2812_spi_rgbw_INC := $(ws2812_spi_INC)
+ws2812_spi_rgbw_SRC := $(ws2812_spi_SRC)
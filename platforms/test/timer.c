@@ -20,6 +20,7 @@
 static atomic_uint_least32_t current_time      = 0;
 static atomic_uint_least32_t async_tick_amount = 0;
 static atomic_uint_least32_t access_counter    = 0;
+static atomic_uint_least32_t fine_offset       = 0; // microseconds added by advance_time_us()
 
 void simulate_async_tick(uint32_t t) {
     async_tick_amount = t;
@@ -70,6 +71,19 @@ void advance_time(uint32_t ms) {
     access_counter = 0;
 }
 
+// Moves the fine timer on without moving the millisecond timer, to simulate time spent within a task
+void advance_time_us(uint32_t us) {
+    fine_offset += us;
+}
+
+uint32_t timer_read_fine(void) {
+    return current_time * 1000 + fine_offset;
+}
+
+uint32_t timer_fine_to_us(uint32_t fine) {
+    return fine;
+}
+
 void wait_ms(uint32_t ms) {
     advance_time(ms);
 }
@@ -0,0 +1,27 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gpio.h"
+#include "chibios_config.h"
+
+SPIDriver SPID1;
+
+const uint8_t *ws2812_spi_mock_txbuf  = NULL;
+size_t         ws2812_spi_mock_length = 0;
+
+void spiAcquireBus(SPIDriver *spip) {}
+
+void spiStart(SPIDriver *spip, const SPIConfig *config) {
+    spip->config = config;
+}
+
+void spiSelect(SPIDriver *spip) {}
+
+void spiStartSend(SPIDriver *spip, size_t n, const void *txbuf) {
+    ws2812_spi_mock_txbuf  = txbuf;
+    ws2812_spi_mock_length = n;
+}
+
+void spiSend(SPIDriver *spip, size_t n, const void *txbuf) {
+    spiStartSend(spip, n, txbuf);
+}
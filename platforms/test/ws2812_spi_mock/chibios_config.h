@@ -0,0 +1,43 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Just enough of the ChibiOS SPI driver for ws2812_spi.c to build on the host; see ws2812_spi_mock.c
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef TRUE
+#    define TRUE 1
+#    define FALSE 0
+#endif
+
+#define SPI_SUPPORTS_CIRCULAR FALSE
+#define SPI_CR1_BR_0 (1 << 3)
+#define SPI_CR1_BR_1 (1 << 4)
+#define SPI_CR1_BR_2 (1 << 5)
+
+typedef struct {
+    void      *end_cb;
+    ioportid_t ssport;
+    uint8_t    sspad;
+    uint16_t   cr1;
+    uint16_t   cr2;
+} SPIConfig;
+
+typedef struct {
+    const SPIConfig *config;
+} SPIDriver;
+
+extern SPIDriver SPID1;
+
+void spiAcquireBus(SPIDriver *spip);
+void spiStart(SPIDriver *spip, const SPIConfig *config);
+void spiSelect(SPIDriver *spip);
+void spiStartSend(SPIDriver *spip, size_t n, const void *txbuf);
+void spiSend(SPIDriver *spip, size_t n, const void *txbuf);
+
+// The last transfer handed to the driver
+extern const uint8_t *ws2812_spi_mock_txbuf;
+extern size_t         ws2812_spi_mock_length;
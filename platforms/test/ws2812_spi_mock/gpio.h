@@ -0,0 +1,21 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Just enough of the ChibiOS PAL for ws2812_spi.c to build on the host
+
+#include <stdint.h>
+
+typedef uint32_t pin_t;
+typedef uint32_t ioportid_t;
+
+#define PAL_PORT(line) ((ioportid_t)(line))
+#define PAL_PAD(line) ((uint8_t)(line))
+#define PAL_MODE_ALTERNATE(n) (n)
+#define PAL_OUTPUT_TYPE_PUSHPULL 0
+#define PAL_OUTPUT_TYPE_OPENDRAIN 0
+
+#define palSetLineMode(line, mode) \
+    do {                           \
+    } while (0)
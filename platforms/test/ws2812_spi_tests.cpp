@@ -0,0 +1,140 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "ws2812.h"
+#include "ws2812_spi.h"
+#include "gpio.h"
+#include "chibios_config.h"
+
+extern ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
+}
+
+// The bit-at-a-time encoding the lookup table replaced
+static uint8_t get_protocol_eq(uint8_t data, int pos) {
+    uint8_t eq = 0;
+    if (data & (1 << (2 * (3 - pos))))
+        eq = 0b1110;
+    else
+        eq = 0b1000;
+    if (data & (2 << (2 * (3 - pos))))
+        eq += 0b11100000;
+    else
+        eq += 0b10000000;
+    return eq;
+}
+
+TEST(WS2812SPI, EncodingMatchesBitPatterns) {
+    for (int data = 0; data < 256; data++) {
+        uint32_t word = ws2812_spi_encode(data);
+        uint8_t  bytes[4];
+        memcpy(bytes, &word, sizeof(bytes));
+        for (int pos = 0; pos < 4; pos++) {
+            EXPECT_EQ(bytes[pos], get_protocol_eq(data, pos)) << "data " << data << ", byte " << pos;
+        }
+    }
+}
+
+TEST(WS2812SPI, EncodingIsMostSignificantBitFirst) {
+    uint32_t word = ws2812_spi_encode(0x80);
+    uint8_t  bytes[4];
+    memcpy(bytes, &word, sizeof(bytes));
+    EXPECT_EQ(bytes[0], 0xE8);
+    EXPECT_EQ(bytes[1], 0x88);
+    EXPECT_EQ(bytes[2], 0x88);
+    EXPECT_EQ(bytes[3], 0x88);
+}
+
+// The transmit buffer as the byte-at-a-time driver laid it out
+static std::vector<uint8_t> reference_txbuf(void) {
+    const int BYTES_FOR_LED_BYTE = 4;
+#ifdef WS2812_RGBW
+    const int WS2812_CHANNELS = 4;
+#else
+    const int WS2812_CHANNELS = 3;
+#endif
+    const int BYTES_FOR_LED = BYTES_FOR_LED_BYTE * WS2812_CHANNELS;
+    const int DATA_SIZE     = BYTES_FOR_LED * WS2812_LED_COUNT;
+    const int RESET_SIZE    = 1000 * WS2812_TRST_US / (2 * WS2812_TIMING);
+    const int PREAMBLE_SIZE = 4;
+
+    std::vector<uint8_t> txbuf(PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE, 0);
+    uint8_t             *tx_start = &txbuf[PREAMBLE_SIZE];
+    for (int pos = 0; pos < WS2812_LED_COUNT; pos++) {
+        ws2812_led_t color = ws2812_leds[pos];
+#if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
+        for (int j = 0; j < 4; j++)
+            tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.g, j);
+        for (int j = 0; j < 4; j++)
+            tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.r, j);
+        for (int j = 0; j < 4; j++)
+            tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
+#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
+        for (int j = 0; j < 4; j++)
+            tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.r, j);
+        for (int j = 0; j < 4; j++)
+            tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
+        for (int j = 0; j < 4; j++)
+            tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
+#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
+        for (int j = 0; j < 4; j++)
+            tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.b, j);
+        for (int j = 0; j < 4; j++)
+            tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
+        for (int j = 0; j < 4; j++)
+            tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.r, j);
+#endif
+#ifdef WS2812_RGBW
+        for (int j = 0; j < 4; j++)
+            tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 3 + j] = get_protocol_eq(color.w, j);
+#endif
+    }
+    return txbuf;
+}
+
+TEST(WS2812SPI, FlushMatchesByteAtATimeBuffer) {
+    ws2812_init();
+    for (int i = 0; i < WS2812_LED_COUNT; i++) {
+        // Distinct values per channel and LED, with a white component to split off for RGBW
+        ws2812_set_color(i, 0x40 + i, 0x80 + 3 * i, 0xC0 - 5 * i);
+    }
+    ws2812_flush();
+
+    std::vector<uint8_t> expected = reference_txbuf();
+    ASSERT_NE(ws2812_spi_mock_txbuf, nullptr);
+    ASSERT_EQ(ws2812_spi_mock_length, expected.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(ws2812_spi_mock_txbuf[i], expected[i]) << "byte " << i;
+    }
+}
+
+TEST(WS2812SPI, FlushLaysOutChannelsInWireOrder) {
+    ws2812_init();
+    ws2812_set_color_all(0, 0, 0);
+    ws2812_set_color(1, 0x30, 0x20, 0x10);
+    ws2812_flush();
+
+    const uint8_t *led = &ws2812_spi_mock_txbuf[4 + 1 * 4 * sizeof(ws2812_led_t)];
+    uint32_t       channels[4];
+    memcpy(channels, led, sizeof(ws2812_led_t) * 4);
+#if defined(WS2812_RGBW) && (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
+    // The white channel takes the common 0x10, and goes out last
+    EXPECT_EQ(channels[0], ws2812_spi_encode(0x20));
+    EXPECT_EQ(channels[1], ws2812_spi_encode(0x10));
+    EXPECT_EQ(channels[2], ws2812_spi_encode(0x00));
+    EXPECT_EQ(channels[3], ws2812_spi_encode(0x10));
+#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
+    EXPECT_EQ(channels[0], ws2812_spi_encode(0x20));
+    EXPECT_EQ(channels[1], ws2812_spi_encode(0x30));
+    EXPECT_EQ(channels[2], ws2812_spi_encode(0x10));
+#endif
+
+    // The LEDs either side are off
+    EXPECT_EQ(led[-1], get_protocol_eq(0, 3));
+    EXPECT_EQ(led[sizeof(ws2812_led_t) * 4], get_protocol_eq(0, 0));
+}
@@ -44,6 +44,11 @@ uint32_t timer_read32(void);
 uint16_t timer_elapsed(uint16_t last);
 uint32_t timer_elapsed32(uint32_t last);
 
+// Free running counter at the finest resolution the platform offers, for timing short intervals. Only the difference
+// between two readings is meaningful; timer_fine_to_us() converts it to microseconds.
+uint32_t timer_read_fine(void);
+uint32_t timer_fine_to_us(uint32_t fine);
+
 // Utility functions to check if a future time has expired & autmatically handle time wrapping if checked / reset frequently (half of max value)
 #define timer_expired(current, future) ((uint16_t)(current - future) < UINT16_MAX / 2)
 #define timer_expired32(current, future) ((uint32_t)(current - future) < UINT32_MAX / 2)
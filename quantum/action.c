@@ -31,6 +31,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "keycode_config.h"
 #include "debug.h"
 #include "quantum.h"
+#include "latency_trace.h"
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -284,6 +285,7 @@ void process_record(keyrecord_t *record) {
 #ifdef FLOW_TAP_TERM
     flow_tap_update_last_event(record);
 #endif // FLOW_TAP_TERM
+    LATENCY_TRACE_RECORD(&record->event, LATENCY_TRACE_PROCESS);
 
     if (!process_record_quantum(record)) {
 #ifndef NO_ACTION_ONESHOT
@@ -291,11 +293,13 @@ void process_record(keyrecord_t *record) {
             clear_oneshot_layer_state(ONESHOT_OTHER_KEY_PRESSED);
         }
 #endif
+        LATENCY_TRACE_RECORD(&record->event, LATENCY_TRACE_HANDLED);
         return;
     }
 
     process_record_handler(record);
     post_process_record_quantum(record);
+    LATENCY_TRACE_RECORD(&record->event, LATENCY_TRACE_HANDLED);
 }
 
 void process_record_handler(keyrecord_t *record) {
@@ -1,11 +1,13 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
 #include "encoder.h"
 #include "util.h"
 #include "action_layer.h"
+#include "matrix.h"
 
 /** \brief Default Layer State
  */
@@ -335,11 +337,41 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
-/** \brief Layer switch get layer
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_RESOLUTION_CACHE)
+/** \brief resolved layer cache
  *
- * Gets the layer based on key info
+ * Holds the topmost non-transparent layer for each matrix position, valid for
+ * the combined layer state in `resolved_layers_state`. Entries are filled in
+ * lazily by `layer_switch_get_layer()`.
  */
-uint8_t layer_switch_get_layer(keypos_t key) {
+static uint8_t       resolved_layer_cache[MATRIX_ROWS][MATRIX_COLS];
+static matrix_row_t  resolved_layer_valid[MATRIX_ROWS];
+static layer_state_t resolved_layers_state = 0;
+
+/** \brief resolved layer cache invalidate
+ *
+ * Drops every cached entry, forcing the next lookup for each key to walk the layer stack.
+ */
+void layer_resolution_cache_invalidate(void) {
+    memset(resolved_layer_valid, 0, sizeof(resolved_layer_valid));
+}
+
+/** \brief resolved layer cache invalidate key
+ *
+ * Drops the cached entry for a single key, e.g. after its keycode was changed.
+ */
+void layer_resolution_cache_invalidate_key(keypos_t key) {
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        resolved_layer_valid[key.row] &= ~((matrix_row_t)1 << key.col);
+    }
+}
+#endif
+
+/** \brief Layer switch resolve layer
+ *
+ * Walks the active layer stack from the top, returning the first layer where the key is not transparent
+ */
+static uint8_t layer_switch_resolve_layer(keypos_t key) {
 #ifndef NO_ACTION_LAYER
     action_t action;
     action.code = ACTION_TRANSPARENT;
@@ -361,6 +393,31 @@ uint8_t layer_switch_get_layer(keypos_t key) {
 #endif
 }
 
+/** \brief Layer switch get layer
+ *
+ * Gets the layer based on key info
+ */
+uint8_t layer_switch_get_layer(keypos_t key) {
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_RESOLUTION_CACHE)
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        layer_state_t layers = layer_state | default_layer_state;
+        if (layers != resolved_layers_state) {
+            // layer_state can also be written directly (e.g. split sync), so compare rather than hook the setters
+            layer_resolution_cache_invalidate();
+            resolved_layers_state = layers;
+        }
+
+        const matrix_row_t col_mask = (matrix_row_t)1 << key.col;
+        if (!(resolved_layer_valid[key.row] & col_mask)) {
+            resolved_layer_cache[key.row][key.col] = layer_switch_resolve_layer(key);
+            resolved_layer_valid[key.row] |= col_mask;
+        }
+        return resolved_layer_cache[key.row][key.col];
+    }
+#endif
+    return layer_switch_resolve_layer(key);
+}
+
 /** \brief Layer switch get layer
  *
  * Gets action code based on key position
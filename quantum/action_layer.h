@@ -166,6 +166,15 @@ uint8_t read_source_layers_cache(keypos_t key);
 #endif
 action_t store_or_get_action(bool pressed, keypos_t key);
 
+/* resolved layer cache */
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_RESOLUTION_CACHE)
+void layer_resolution_cache_invalidate(void);
+void layer_resolution_cache_invalidate_key(keypos_t key);
+#else
+#    define layer_resolution_cache_invalidate()
+#    define layer_resolution_cache_invalidate_key(key) ((void)(key))
+#endif
+
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
@@ -19,82 +19,62 @@
 #include "progmem.h"
 #include "util.h"
 
-rgb_t hsv_to_rgb_impl(hsv_t hsv, bool use_cie) {
-    rgb_t    rgb;
-    uint8_t  region, remainder, p, q, t;
-    uint16_t h, s, v;
+// Channel order of each hue region, as 2-bit indexes into {v, p, q, t} for red, green and blue
+static const uint8_t hsv_region_channels[7] = {
+    0 | (3 << 2) | (1 << 4), // v, t, p
+    2 | (0 << 2) | (1 << 4), // q, v, p
+    1 | (0 << 2) | (3 << 4), // p, v, t
+    1 | (2 << 2) | (0 << 4), // p, q, v
+    3 | (1 << 2) | (0 << 4), // t, p, v
+    0 | (1 << 2) | (2 << 4), // v, p, q
+    0 | (3 << 2) | (1 << 4), // hue 255 wraps around to the first region
+};
+
+static inline rgb_t hsv_to_rgb_kernel(uint8_t h, uint8_t s, uint8_t v) {
+    // h * 6 / 255, without the division
+    uint16_t h6        = h * 6;
+    uint8_t  region    = (h6 + 1 + (h6 >> 8)) >> 8;
+    uint8_t  remainder = (h * 2 - region * 85) * 3;
+
+    uint8_t channels[4];
+    channels[0] = v;
+    channels[1] = (v * (255 - s)) >> 8;
+    channels[2] = (v * (255 - ((s * remainder) >> 8))) >> 8;
+    channels[3] = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+    // Without saturation every channel is v
+    uint8_t order = s ? hsv_region_channels[region] : 0;
+
+    rgb_t rgb;
+    rgb.r = channels[order & 3];
+    rgb.g = channels[(order >> 2) & 3];
+    rgb.b = channels[order >> 4];
+    return rgb;
+}
 
-    if (hsv.s == 0) {
+rgb_t hsv_to_rgb_impl(hsv_t hsv, bool use_cie) {
 #ifdef USE_CIE1931_CURVE
-        if (use_cie) {
-            rgb.r = rgb.g = rgb.b = pgm_read_byte(&CIE1931_CURVE[hsv.v]);
-        } else {
-            rgb.r = hsv.v;
-            rgb.g = hsv.v;
-            rgb.b = hsv.v;
-        }
-#else
-        rgb.r = hsv.v;
-        rgb.g = hsv.v;
-        rgb.b = hsv.v;
-#endif
-        return rgb;
+    if (use_cie) {
+        return hsv_to_rgb_kernel(hsv.h, hsv.s, pgm_read_byte(&CIE1931_CURVE[hsv.v]));
     }
+#endif
+    return hsv_to_rgb_kernel(hsv.h, hsv.s, hsv.v);
+}
 
-    h = hsv.h;
-    s = hsv.s;
+static void hsv_to_rgb_batch_impl(const hsv_t *hsv, rgb_t *rgb, uint16_t count, bool use_cie) {
 #ifdef USE_CIE1931_CURVE
     if (use_cie) {
-        v = pgm_read_byte(&CIE1931_CURVE[hsv.v]);
-    } else {
-        v = hsv.v;
+        for (uint16_t i = 0; i < count; i++) {
+            hsv_t in = hsv[i];
+            rgb[i]   = hsv_to_rgb_kernel(in.h, in.s, pgm_read_byte(&CIE1931_CURVE[in.v]));
+        }
+        return;
     }
-#else
-    v = hsv.v;
 #endif
-
-    region    = h * 6 / 255;
-    remainder = (h * 2 - region * 85) * 3;
-
-    p = (v * (255 - s)) >> 8;
-    q = (v * (255 - ((s * remainder) >> 8))) >> 8;
-    t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
-
-    switch (region) {
-        case 6:
-        case 0:
-            rgb.r = v;
-            rgb.g = t;
-            rgb.b = p;
-            break;
-        case 1:
-            rgb.r = q;
-            rgb.g = v;
-            rgb.b = p;
-            break;
-        case 2:
-            rgb.r = p;
-            rgb.g = v;
-            rgb.b = t;
-            break;
-        case 3:
-            rgb.r = p;
-            rgb.g = q;
-            rgb.b = v;
-            break;
-        case 4:
-            rgb.r = t;
-            rgb.g = p;
-            rgb.b = v;
-            break;
-        default:
-            rgb.r = v;
-            rgb.g = p;
-            rgb.b = q;
-            break;
+    for (uint16_t i = 0; i < count; i++) {
+        hsv_t in = hsv[i];
+        rgb[i]   = hsv_to_rgb_kernel(in.h, in.s, in.v);
     }
-
-    return rgb;
 }
 
 rgb_t hsv_to_rgb(hsv_t hsv) {
@@ -108,3 +88,15 @@ rgb_t hsv_to_rgb(hsv_t hsv) {
 rgb_t hsv_to_rgb_nocie(hsv_t hsv) {
     return hsv_to_rgb_impl(hsv, false);
 }
+
+void hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint16_t count) {
+#ifdef USE_CIE1931_CURVE
+    hsv_to_rgb_batch_impl(hsv, rgb, count, true);
+#else
+    hsv_to_rgb_batch_impl(hsv, rgb, count, false);
+#endif
+}
+
+void hsv_to_rgb_batch_nocie(const hsv_t *hsv, rgb_t *rgb, uint16_t count) {
+    hsv_to_rgb_batch_impl(hsv, rgb, count, false);
+}
@@ -95,3 +95,11 @@ typedef hsv_t HSV;
 
 rgb_t hsv_to_rgb(hsv_t hsv);
 rgb_t hsv_to_rgb_nocie(hsv_t hsv);
+
+/**
+ * @brief Converts `count` colors from `hsv` into `rgb`, like hsv_to_rgb() does for one.
+ *
+ * `hsv` and `rgb` may point to the same array, converting it in place.
+ */
+void hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint16_t count);
+void hsv_to_rgb_batch_nocie(const hsv_t *hsv, rgb_t *rgb, uint16_t count);
@@ -0,0 +1,180 @@
+/*
+Copyright 2025 QMK
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Basic symmetric per-key algorithm, behaving identically to sym_defer_pk.
+Instead of one 8-bit counter per key, the counters are stored as bit-planes ("vertical counters"):
+plane N of a row holds bit N of the counter for every column in that row. Counting down a whole row
+is then a handful of word-wide operations per bit, rather than a loop over every key, and no heap
+allocation is required.
+When no state changes have occured for DEBOUNCE milliseconds, we push the state.
+*/
+
+#include "debounce.h"
+#include "timer.h"
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+// Number of bit-planes needed to hold DEBOUNCE
+#if DEBOUNCE < 2
+#    define DEBOUNCE_BITS 1
+#elif DEBOUNCE < 4
+#    define DEBOUNCE_BITS 2
+#elif DEBOUNCE < 8
+#    define DEBOUNCE_BITS 3
+#elif DEBOUNCE < 16
+#    define DEBOUNCE_BITS 4
+#elif DEBOUNCE < 32
+#    define DEBOUNCE_BITS 5
+#elif DEBOUNCE < 64
+#    define DEBOUNCE_BITS 6
+#elif DEBOUNCE < 128
+#    define DEBOUNCE_BITS 7
+#else
+#    define DEBOUNCE_BITS 8
+#endif
+
+#if DEBOUNCE > 0
+// A zero counter means the debounce time for that key has elapsed (or was never started)
+static matrix_row_t counter_planes[MATRIX_ROWS][DEBOUNCE_BITS];
+static fast_timer_t last_time;
+static bool         counters_need_update;
+static bool         cooked_changed;
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t bit = 0; bit < DEBOUNCE_BITS; bit++) {
+            counter_planes[row][bit] = 0;
+        }
+    }
+    counters_need_update = false;
+}
+
+void debounce_free(void) {}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool updated_last = false;
+    cooked_changed    = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        if (elapsed_time > UINT8_MAX) {
+            elapsed_time = UINT8_MAX;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, num_rows, elapsed_time);
+        }
+    }
+
+    if (changed) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        start_debounce_counters(raw, cooked, num_rows);
+    }
+
+    return cooked_changed;
+}
+
+static inline matrix_row_t active_counters(const matrix_row_t planes[]) {
+    matrix_row_t active = 0;
+    for (uint8_t bit = 0; bit < DEBOUNCE_BITS; bit++) {
+        active |= planes[bit];
+    }
+    return active;
+}
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
+    counters_need_update = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t *planes = counter_planes[row];
+        matrix_row_t  active = active_counters(planes);
+        if (!active) {
+            continue;
+        }
+
+        matrix_row_t expired;
+        if (elapsed_time >= DEBOUNCE) {
+            // Every counter is at most DEBOUNCE, so all of them have run out
+            expired = active;
+        } else {
+            // Subtract elapsed_time from every counter in the row at once, rippling the borrow through the planes
+            matrix_row_t borrow    = 0;
+            matrix_row_t remaining = 0;
+            for (uint8_t bit = 0; bit < DEBOUNCE_BITS; bit++) {
+                matrix_row_t a = planes[bit];
+                matrix_row_t b = (elapsed_time & (1 << bit)) ? ~(matrix_row_t)0 : 0;
+                // Idle counters stay at zero rather than wrapping around
+                planes[bit] = (a ^ b ^ borrow) & active;
+                borrow      = (~a & (b | borrow)) | (a & b & borrow);
+                remaining |= planes[bit];
+            }
+            // A counter expires when it was no larger than the elapsed time
+            expired = active & (borrow | ~remaining);
+        }
+
+        if (expired) {
+            for (uint8_t bit = 0; bit < DEBOUNCE_BITS; bit++) {
+                planes[bit] &= ~expired;
+            }
+            matrix_row_t cooked_next = (cooked[row] & ~expired) | (raw[row] & expired);
+            cooked_changed |= cooked[row] ^ cooked_next;
+            cooked[row] = cooked_next;
+        }
+
+        if (active & ~expired) {
+            counters_need_update = true;
+        }
+    }
+}
+
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t *planes = counter_planes[row];
+        matrix_row_t  delta  = raw[row] ^ cooked[row];
+        // Only keys without a running counter get a fresh one; keys matching cooked are reset
+        matrix_row_t start = delta & ~active_counters(planes);
+        for (uint8_t bit = 0; bit < DEBOUNCE_BITS; bit++) {
+            planes[bit] &= delta;
+            if (DEBOUNCE & (1 << bit)) {
+                planes[bit] |= start;
+            }
+        }
+        if (start) {
+            counters_need_update = true;
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
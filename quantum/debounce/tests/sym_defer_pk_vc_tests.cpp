@@ -0,0 +1,161 @@
+/* Copyright 2025 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+
+#include "debounce_test_common.h"
+
+#include <cstring>
+#include <random>
+
+extern "C" {
+#include "debounce.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+TEST_F(DebounceTest, WholeRowVertical) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 0, DOWN}, {0, 1, DOWN}, {0, 2, DOWN}, {0, 3, DOWN}, {0, 4, DOWN}, {0, 5, DOWN}, {0, 6, DOWN}, {0, 7, DOWN}, {0, 8, DOWN}, {0, 9, DOWN}}, {}},
+        {5, {}, {{0, 0, DOWN}, {0, 1, DOWN}, {0, 2, DOWN}, {0, 3, DOWN}, {0, 4, DOWN}, {0, 5, DOWN}, {0, 6, DOWN}, {0, 7, DOWN}, {0, 8, DOWN}, {0, 9, DOWN}}},
+        /* Release half the row, with a bounce on one key */
+        {10, {{0, 0, UP}, {0, 2, UP}, {0, 4, UP}, {0, 6, UP}, {0, 8, UP}}, {}},
+        {12, {{0, 4, DOWN}}, {}},
+        {13, {{0, 4, UP}}, {}},
+        {15, {}, {{0, 0, UP}, {0, 2, UP}, {0, 6, UP}, {0, 8, UP}}},
+        {18, {}, {{0, 4, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, StaggeredCountersInOneRow) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{1, 0, DOWN}}, {}},
+        {1, {{1, 1, DOWN}}, {}},
+        {3, {{1, 2, DOWN}}, {}},
+        {5, {}, {{1, 0, DOWN}}},
+        {6, {}, {{1, 1, DOWN}}},
+        {8, {}, {{1, 2, DOWN}}},
+    });
+    runEvents();
+}
+
+/* Reference per-key model, equivalent to sym_defer_pk with 8-bit counters */
+class ReferenceDebounce {
+   public:
+    void init() {
+        std::memset(counters_, 0, sizeof(counters_));
+        need_update_ = false;
+    }
+
+    bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint32_t now, bool changed) {
+        bool updated_last = false;
+        bool cooked_changed = false;
+
+        if (need_update_) {
+            uint32_t elapsed = now - last_time_;
+            last_time_       = now;
+            updated_last     = true;
+            if (elapsed > UINT8_MAX) elapsed = UINT8_MAX;
+            if (elapsed > 0) {
+                need_update_ = false;
+                for (int row = 0; row < MATRIX_ROWS; row++) {
+                    for (int col = 0; col < MATRIX_COLS; col++) {
+                        uint8_t &counter = counters_[row][col];
+                        if (counter == 0) continue;
+                        if (counter <= elapsed) {
+                            counter                  = 0;
+                            matrix_row_t mask        = (matrix_row_t)1 << col;
+                            matrix_row_t cooked_next = (cooked[row] & ~mask) | (raw[row] & mask);
+                            cooked_changed |= cooked[row] != cooked_next;
+                            cooked[row] = cooked_next;
+                        } else {
+                            counter -= elapsed;
+                            need_update_ = true;
+                        }
+                    }
+                }
+            }
+        }
+
+        if (changed) {
+            if (!updated_last) last_time_ = now;
+            for (int row = 0; row < MATRIX_ROWS; row++) {
+                matrix_row_t delta = raw[row] ^ cooked[row];
+                for (int col = 0; col < MATRIX_COLS; col++) {
+                    uint8_t &counter = counters_[row][col];
+                    if (delta & ((matrix_row_t)1 << col)) {
+                        if (counter == 0) {
+                            counter      = DEBOUNCE;
+                            need_update_ = true;
+                        }
+                    } else {
+                        counter = 0;
+                    }
+                }
+            }
+        }
+
+        return cooked_changed;
+    }
+
+   private:
+    uint8_t  counters_[MATRIX_ROWS][MATRIX_COLS];
+    uint32_t last_time_;
+    bool     need_update_;
+};
+
+TEST(DebounceVerticalCounters, TimingMatchesPerKeyCounters) {
+    std::mt19937 rng(12345);
+    uint32_t     now = 7777;
+
+    ReferenceDebounce reference;
+    matrix_row_t      raw[MATRIX_ROWS]        = {0};
+    matrix_row_t      cooked[MATRIX_ROWS]     = {0};
+    matrix_row_t      ref_cooked[MATRIX_ROWS] = {0};
+
+    set_time(now);
+    debounce_init(MATRIX_ROWS);
+    reference.init();
+
+    for (int step = 0; step < 20000; step++) {
+        /* Mostly 1ms scans, with occasional stalls long enough to expire every counter */
+        uint32_t advance = rng() % 16 == 0 ? rng() % 300 : rng() % 2;
+        now += advance;
+        set_time(now);
+
+        bool changed = false;
+        if (rng() % 3 == 0) {
+            int row = rng() % MATRIX_ROWS;
+            int col = rng() % MATRIX_COLS;
+            raw[row] ^= (matrix_row_t)1 << col;
+            changed = true;
+        }
+
+        bool actual   = debounce(raw, cooked, MATRIX_ROWS, changed);
+        bool expected = reference.debounce(raw, ref_cooked, now, changed);
+
+        ASSERT_EQ(actual, expected) << "step " << step;
+        for (int row = 0; row < MATRIX_ROWS; row++) {
+            ASSERT_EQ(cooked[row], ref_cooked[row]) << "step " << step << " row " << row;
+        }
+    }
+
+    debounce_free();
+}
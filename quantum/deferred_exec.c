@@ -9,36 +9,209 @@
 #    define MAX_DEFERRED_EXECUTORS 8
 #endif
 
+// Entry indices and tokens are 8-bit, so any entries past this are left unused
+#define DEFERRED_EXEC_MAX_TABLE_COUNT 255
+
 //------------------------------------
 // Helpers
 //
+// Each table is kept as a binary min-heap of its scheduled entries ordered by trigger time, so the task only needs to
+// look at the top of the heap to know whether anything is due, and only touches entries that are. Entries themselves
+// never move -- the heap is an array of entry indices spread across the `heap_slot` fields of the table, and each entry
+// knows its own position in it through `heap_index`. Both are stored XOR'ed with the index of the entry holding them,
+// so that a zeroed table already describes the identity permutation without any initialisation.
+//
+// The heap array is split into three runs:
+//     [0, scheduled)                   the heap itself
+//     [scheduled, scheduled + pending) entries that ran during the current pass and are still due, held back until it ends
+//     [scheduled + pending, count)     free entries
+// so claiming a free entry is just taking the first position after the other two. `scheduled` is kept in the first
+// entry of the table. `pending` is only ever non-zero while the table's task is running, so it's kept alongside that
+// pass on the stack; callbacks may run other tables' tasks, so there can be one pass per table underway at once.
+//
+// Tokens encode the index of their entry as `(token - 1) % count`, so they can be looked up without searching. Each time
+// an entry is reused its token moves on by the table size, so tokens from earlier uses no longer match.
+//
 
-static deferred_token current_token = 0;
+typedef struct deferred_exec_pass_t {
+    deferred_executor_t *        table;
+    uint8_t                      pending;
+    struct deferred_exec_pass_t *outer;
+} deferred_exec_pass_t;
 
-static inline bool token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
-    if (token == INVALID_DEFERRED_TOKEN) {
-        return false;
+// Innermost pass underway, linking out to the passes of any tables whose callbacks led to it
+static deferred_exec_pass_t *current_pass = NULL;
+
+static inline uint8_t usable_count(size_t table_count) {
+    return table_count > DEFERRED_EXEC_MAX_TABLE_COUNT ? DEFERRED_EXEC_MAX_TABLE_COUNT : table_count;
+}
+
+static inline deferred_exec_pass_t *find_pass(deferred_executor_t *table) {
+    for (deferred_exec_pass_t *pass = current_pass; pass; pass = pass->outer) {
+        if (pass->table == table) {
+            return pass;
+        }
     }
-    for (int i = 0; i < table_count; ++i) {
-        if (table[i].token == token) {
-            return false;
+    return NULL;
+}
+
+static inline uint8_t pending_count(deferred_executor_t *table) {
+    deferred_exec_pass_t *pass = find_pass(table);
+    return pass ? pass->pending : 0;
+}
+
+static inline uint8_t heap_slot(deferred_executor_t *table, uint8_t pos) {
+    return table[pos].heap_slot ^ pos;
+}
+
+static inline uint8_t heap_index(deferred_executor_t *table, uint8_t slot) {
+    return table[slot].heap_index ^ slot;
+}
+
+static inline void heap_place(deferred_executor_t *table, uint8_t pos, uint8_t slot) {
+    table[pos].heap_slot   = slot ^ pos;
+    table[slot].heap_index = pos ^ slot;
+}
+
+static inline void heap_swap(deferred_executor_t *table, uint8_t a, uint8_t b) {
+    uint8_t slot_a = heap_slot(table, a);
+    heap_place(table, a, heap_slot(table, b));
+    heap_place(table, b, slot_a);
+}
+
+static inline bool heap_before(deferred_executor_t *table, uint8_t a, uint8_t b) {
+    return ((int32_t)TIMER_DIFF_32(table[heap_slot(table, a)].trigger_time, table[heap_slot(table, b)].trigger_time)) < 0;
+}
+
+static void heap_sift_up(deferred_executor_t *table, uint8_t pos) {
+    while (pos > 0) {
+        uint8_t parent = (pos - 1) / 2;
+        if (!heap_before(table, pos, parent)) {
+            break;
         }
+        heap_swap(table, pos, parent);
+        pos = parent;
     }
-    return true;
 }
 
-static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count) {
-    deferred_token first = ++current_token;
-    while (!token_can_be_used(table, table_count, current_token)) {
-        ++current_token;
-        if (current_token == first) {
-            // If we've looped back around to the first, everything is already allocated (yikes!). Need to exit with a failure.
-            return INVALID_DEFERRED_TOKEN;
+static void heap_sift_down(deferred_executor_t *table, uint8_t pos) {
+    uint8_t scheduled = table[0].scheduled;
+    while (true) {
+        uint16_t child = 2 * (uint16_t)pos + 1;
+        if (child >= scheduled) {
+            break;
+        }
+        if (child + 1 < scheduled && heap_before(table, child + 1, child)) {
+            ++child;
         }
+        if (!heap_before(table, child, pos)) {
+            break;
+        }
+        heap_swap(table, pos, child);
+        pos = child;
     }
-    return current_token;
+}
+
+// Restores the heap order around an entry whose trigger time has changed
+static void heap_update(deferred_executor_t *table, uint8_t slot) {
+    heap_sift_up(table, heap_index(table, slot));
+    heap_sift_down(table, heap_index(table, slot));
+}
+
+// Takes an entry out of the heap, leaving it at the position just after the heap
+static void heap_remove(deferred_executor_t *table, uint8_t slot) {
+    uint8_t pos  = heap_index(table, slot);
+    uint8_t last = --table[0].scheduled;
+    heap_swap(table, pos, last);
+    if (pos < last) {
+        heap_update(table, heap_slot(table, pos));
+    }
+}
+
+static inline bool is_scheduled(deferred_executor_t *table, uint8_t slot) {
+    return heap_index(table, slot) < table[0].scheduled;
+}
+
+static inline deferred_token next_token(deferred_executor_t *entry, uint8_t slot, uint8_t count) {
+    uint16_t token = (uint16_t)entry->token + count;
+    if (entry->token == INVALID_DEFERRED_TOKEN || token > UINT8_MAX) {
+        token = slot + 1;
+    }
+    return token;
+}
+
+static inline deferred_executor_t *find_entry(deferred_executor_t *table, uint8_t count, deferred_token token) {
+    deferred_executor_t *entry = &table[(uint8_t)(token - 1) % count];
+    return (entry->callback && entry->token == token) ? entry : NULL;
+}
+
+// Moves an entry, whether scheduled or held back, to the front of the free run and clears it
+static void release_entry(deferred_executor_t *table, uint8_t slot) {
+    deferred_exec_pass_t *pass    = find_pass(table);
+    uint8_t               pending = pass ? pass->pending : 0;
+    if (is_scheduled(table, slot)) {
+        heap_remove(table, slot);
+        heap_swap(table, table[0].scheduled, table[0].scheduled + pending);
+    } else {
+        // Only entries of a table whose pass is underway are ever held back
+        heap_swap(table, heap_index(table, slot), table[0].scheduled + pending - 1);
+        --pass->pending;
+    }
+
+    deferred_executor_t *entry = &table[slot];
+    entry->trigger_time        = 0;
+    entry->callback            = NULL;
+    entry->cb_arg              = NULL;
 }
 
+//------------------------------------
+// Statistics
+//
+
+#ifdef DEFERRED_EXEC_STATS
+
+static deferred_exec_stats_t deferred_exec_stats = {0};
+
+void deferred_exec_get_stats(deferred_exec_stats_t *stats) {
+    *stats = deferred_exec_stats;
+}
+
+void deferred_exec_reset_stats(void) {
+    deferred_exec_stats = (deferred_exec_stats_t){0};
+}
+
+__attribute__((weak)) void deferred_exec_overrun_user(deferred_exec_callback callback, void *cb_arg, uint32_t lateness_ms, uint32_t duration_ms) {}
+
+__attribute__((weak)) void deferred_exec_overrun_kb(deferred_exec_callback callback, void *cb_arg, uint32_t lateness_ms, uint32_t duration_ms) {
+    deferred_exec_overrun_user(callback, cb_arg, lateness_ms, duration_ms);
+}
+
+static void deferred_exec_record(deferred_exec_callback callback, void *cb_arg, uint32_t trigger_time, uint32_t start, uint32_t delay_ms) {
+    uint32_t lateness_ms = TIMER_DIFF_32(start, trigger_time);
+    uint32_t duration_ms = TIMER_DIFF_32(timer_read32(), start);
+    bool     overrun     = delay_ms > 0 && duration_ms >= delay_ms;
+
+    ++deferred_exec_stats.executions;
+    if (lateness_ms > 0) {
+        ++deferred_exec_stats.late;
+    }
+    if (lateness_ms > deferred_exec_stats.max_lateness_ms) {
+        deferred_exec_stats.max_lateness_ms = lateness_ms;
+    }
+    if (overrun) {
+        ++deferred_exec_stats.overruns;
+    }
+    if (duration_ms > deferred_exec_stats.max_duration_ms) {
+        deferred_exec_stats.max_duration_ms = duration_ms;
+    }
+
+    if (lateness_ms > DEFERRED_EXEC_OVERRUN_THRESHOLD_MS || (overrun && duration_ms > DEFERRED_EXEC_OVERRUN_THRESHOLD_MS)) {
+        deferred_exec_overrun_kb(callback, cb_arg, lateness_ms, duration_ms);
+    }
+}
+
+#endif // DEFERRED_EXEC_STATS
+
 //------------------------------------
 // Advanced API: used when a custom-allocated table is used, primarily for core code.
 //
@@ -49,27 +222,25 @@ deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_coun
         return INVALID_DEFERRED_TOKEN;
     }
 
-    // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return false;
-            }
-
-            // Set up the executor table entry
-            entry->token        = current_token;
-            entry->trigger_time = timer_read32() + delay_ms;
-            entry->callback     = callback;
-            entry->cb_arg       = cb_arg;
-            return current_token;
-        }
+    // Claim the first free entry, if there is one
+    uint8_t count     = usable_count(table_count);
+    uint8_t scheduled = table[0].scheduled;
+    uint8_t free_pos  = scheduled + pending_count(table);
+    if (free_pos >= count) {
+        return INVALID_DEFERRED_TOKEN;
     }
+    uint8_t slot = heap_slot(table, free_pos);
+    heap_swap(table, scheduled, free_pos);
+    table[0].scheduled = scheduled + 1;
 
-    // None available
-    return INVALID_DEFERRED_TOKEN;
+    // Set up the executor table entry
+    deferred_executor_t *entry = &table[slot];
+    entry->token               = next_token(entry, slot, count);
+    entry->trigger_time        = timer_read32() + delay_ms;
+    entry->callback            = callback;
+    entry->cb_arg              = cb_arg;
+    heap_sift_up(table, scheduled);
+    return entry->token;
 }
 
 bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
@@ -79,17 +250,17 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    deferred_executor_t *entry = find_entry(table, usable_count(table_count), token);
+    if (!entry) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, extend the delay -- held back entries get put back into the heap once the current pass is done
+    entry->trigger_time = timer_read32() + delay_ms;
+    if (is_scheduled(table, entry - table)) {
+        heap_update(table, entry - table);
+    }
+    return true;
 }
 
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
@@ -99,20 +270,14 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    deferred_executor_t *entry = find_entry(table, usable_count(table_count), token);
+    if (!entry) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, cancel and clear the table entry
+    release_entry(table, entry - table);
+    return true;
 }
 
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
@@ -122,37 +287,70 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
     if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
         *last_execution_time = now;
 
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry      = &table[i];
+        // A callback running its own table's task again would mix up the two passes' held back entries
+        if (!table || table_count == 0 || find_pass(table)) {
+            return;
+        }
+
+        // Entries that are still due after running are held back until the end of the pass, so that each one runs at
+        // most once per pass.
+        deferred_exec_pass_t pass = {.table = table, .pending = 0, .outer = current_pass};
+        current_pass              = &pass;
+
+        // Run through each of the executors that are due, earliest first
+        while (table[0].scheduled > 0) {
+            uint8_t              slot       = heap_slot(table, 0);
+            deferred_executor_t *entry      = &table[slot];
             deferred_token       curr_token = entry->token;
 
-            // Check if we're supposed to execute this entry
-            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+            if (((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) > 0) {
+                break;
+            }
 
-                // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
-                if (entry->token != curr_token) {
-                    continue;
-                }
+            // Invoke the callback and work work out if we should be requeued
+#ifdef DEFERRED_EXEC_STATS
+            deferred_exec_callback callback     = entry->callback;
+            void *                 cb_arg       = entry->cb_arg;
+            uint32_t               trigger_time = entry->trigger_time;
+            uint32_t               start        = timer_read32();
+#endif // DEFERRED_EXEC_STATS
+            uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+#ifdef DEFERRED_EXEC_STATS
+            deferred_exec_record(callback, cb_arg, trigger_time, start, delay_ms);
+#endif // DEFERRED_EXEC_STATS
 
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
+            // If the entry is no longer in use or the token has changed, then the callback has canceled (and maybe
+            // re-queued). Skip further processing.
+            if (!entry->callback || entry->token != curr_token) {
+                continue;
+            }
+
+            // Update the trigger time if we have to repeat, otherwise clear it out
+            if (delay_ms > 0) {
+                // Intentionally add just the delay to the existing trigger time -- this ensures the next
+                // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+                // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+                // considerable length of time, then this ensures best-effort timing between invocations.
+                entry->trigger_time += delay_ms;
+                if (((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
+                    heap_remove(table, slot);
+                    ++pass.pending;
                 } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
+                    heap_update(table, slot);
                 }
+            } else {
+                // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+                release_entry(table, slot);
             }
         }
+
+        // Return the held back entries to the heap, ready for the next pass
+        while (pass.pending > 0) {
+            --pass.pending;
+            heap_sift_up(table, table[0].scheduled++);
+        }
+
+        current_pass = pass.outer;
     }
 }
 
@@ -73,9 +73,13 @@ void deferred_exec_task(void);
  * @struct Structure for containing self-hosted deferred executor tables.
  * @brief Core-side code can use this to create their own tables without impacting on the use of users' ability to add deferred execution.
  *        Code outside deferred_exec.c should not worry about internals of this struct, and should just allocate the required number in an array.
+ *        The array must start out zeroed, and only the first 255 entries are ever used.
  */
 typedef struct deferred_executor_t {
     deferred_token         token;
+    uint8_t                heap_slot;
+    uint8_t                heap_index;
+    uint8_t                scheduled;
     uint32_t               trigger_time;
     deferred_exec_callback callback;
     void *                 cb_arg;
@@ -119,3 +123,52 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
  * @param last_execution_time[in,out] the last execution time -- this will be checked first to determine if execution is needed, and updated if execution occurred
  */
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time);
+
+//------------------------------------
+// Statistics: enabled with DEFERRED_EXEC_STATS, covering every table.
+//------------------------------------
+
+#ifdef DEFERRED_EXEC_STATS
+
+// Late or overrunning callbacks are only reported to deferred_exec_overrun_kb() once they are this far out
+#    ifndef DEFERRED_EXEC_OVERRUN_THRESHOLD_MS
+#        define DEFERRED_EXEC_OVERRUN_THRESHOLD_MS 0
+#    endif
+
+/**
+ * @struct Execution statistics, accumulated across all deferred executor tables.
+ */
+typedef struct deferred_exec_stats_t {
+    uint32_t executions;      // callbacks invoked
+    uint32_t late;            // invocations that started after their trigger time
+    uint32_t max_lateness_ms; // furthest an invocation started after its trigger time
+    uint32_t overruns;        // invocations that took at least as long as the delay they requeued themselves with
+    uint32_t max_duration_ms; // longest time spent in a single callback
+} deferred_exec_stats_t;
+
+/**
+ * Copies out the statistics collected since startup, or the last reset.
+ *
+ * @param stats[out] the statistics
+ */
+void deferred_exec_get_stats(deferred_exec_stats_t *stats);
+
+/**
+ * Clears the collected statistics.
+ */
+void deferred_exec_reset_stats(void);
+
+/**
+ * Invoked after a callback that started more than DEFERRED_EXEC_OVERRUN_THRESHOLD_MS late, or overran the
+ * delay it requeued itself with and took more than DEFERRED_EXEC_OVERRUN_THRESHOLD_MS. The statistics count
+ * every late or overrunning callback regardless.
+ *
+ * @param callback[in] the callback that was invoked
+ * @param cb_arg[in] the argument it was invoked with
+ * @param lateness_ms[in] how long after its trigger time the callback was invoked
+ * @param duration_ms[in] how long the callback took to execute
+ */
+void deferred_exec_overrun_kb(deferred_exec_callback callback, void *cb_arg, uint32_t lateness_ms, uint32_t duration_ms);
+void deferred_exec_overrun_user(deferred_exec_callback callback, void *cb_arg, uint32_t lateness_ms, uint32_t duration_ms);
+
+#endif // DEFERRED_EXEC_STATS
@@ -18,6 +18,7 @@
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
+#include "action_layer.h"
 #include "send_string.h"
 #include "keycodes.h"
 #include "nvm_dynamic_keymap.h"
@@ -32,25 +33,194 @@
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+#    include <string.h>
+#    include "timer.h"
+#    include "util.h"
+
+#    ifndef DYNAMIC_KEYMAP_RAM_MIRROR_FLUSH_DELAY
+#        define DYNAMIC_KEYMAP_RAM_MIRROR_FLUSH_DELAY 1000
+#    endif
+
+#    ifndef DYNAMIC_KEYMAP_RAM_MIRROR_FLUSH_CHUNK
+#        define DYNAMIC_KEYMAP_RAM_MIRROR_FLUSH_CHUNK 32
+#    endif
+
+#    define DYNAMIC_KEYMAP_KEY_COUNT (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS)
+
+// RAM copy of the keymap (and encoder map), in native byte order.
+static uint16_t keymap_mirror[DYNAMIC_KEYMAP_LAYER_COUNT][MATRIX_ROWS][MATRIX_COLS];
+// One bit per keymap entry which still needs writing back to NVM.
+static uint8_t keymap_mirror_dirty[(DYNAMIC_KEYMAP_KEY_COUNT + 7) / 8];
+#    ifdef ENCODER_MAP_ENABLE
+static uint16_t encoder_mirror[DYNAMIC_KEYMAP_LAYER_COUNT][NUM_ENCODERS][2];
+static bool     encoder_mirror_dirty[DYNAMIC_KEYMAP_LAYER_COUNT][NUM_ENCODERS][2];
+#    endif // ENCODER_MAP_ENABLE
+static bool     mirror_loaded     = false;
+static bool     mirror_dirty      = false;
+static uint32_t mirror_last_write = 0;
+
+static void dynamic_keymap_mirror_load(void) {
+    uint8_t  buffer[DYNAMIC_KEYMAP_RAM_MIRROR_FLUSH_CHUNK];
+    uint16_t *keycodes = &keymap_mirror[0][0][0];
+
+    // Read in chunks, converting from the big-endian NVM representation
+    for (uint32_t index = 0; index < DYNAMIC_KEYMAP_KEY_COUNT;) {
+        uint32_t count = MIN(DYNAMIC_KEYMAP_KEY_COUNT - index, sizeof(buffer) / 2);
+        nvm_dynamic_keymap_read_buffer(index * 2, count * 2, buffer);
+        for (uint32_t i = 0; i < count; i++) {
+            keycodes[index + i] = (buffer[i * 2] << 8) | buffer[i * 2 + 1];
+        }
+        index += count;
+    }
+    memset(keymap_mirror_dirty, 0, sizeof(keymap_mirror_dirty));
+
+#    ifdef ENCODER_MAP_ENABLE
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (uint8_t encoder = 0; encoder < NUM_ENCODERS; encoder++) {
+            encoder_mirror[layer][encoder][0] = nvm_dynamic_keymap_read_encoder(layer, encoder, true);
+            encoder_mirror[layer][encoder][1] = nvm_dynamic_keymap_read_encoder(layer, encoder, false);
+        }
+    }
+    memset(encoder_mirror_dirty, 0, sizeof(encoder_mirror_dirty));
+#    endif // ENCODER_MAP_ENABLE
+
+    mirror_loaded = true;
+    mirror_dirty  = false;
+}
+
+static inline void dynamic_keymap_mirror_ensure_loaded(void) {
+    if (!mirror_loaded) {
+        dynamic_keymap_mirror_load();
+    }
+}
+
+static inline void dynamic_keymap_mirror_mark_dirty(void) {
+    mirror_dirty      = true;
+    mirror_last_write = timer_read32();
+}
+
+static void dynamic_keymap_mirror_set_keycode(uint32_t index, uint16_t keycode) {
+    uint16_t *keycodes = &keymap_mirror[0][0][0];
+    if (keycodes[index] != keycode) {
+        keycodes[index] = keycode;
+        keymap_mirror_dirty[index / 8] |= (1 << (index % 8));
+        dynamic_keymap_mirror_mark_dirty();
+    }
+}
+
+void dynamic_keymap_flush(void) {
+    if (!mirror_dirty) {
+        return;
+    }
+
+    // Coalesce runs of dirty keycodes into block writes
+    uint8_t   buffer[DYNAMIC_KEYMAP_RAM_MIRROR_FLUSH_CHUNK];
+    uint16_t *keycodes = &keymap_mirror[0][0][0];
+    uint32_t  start    = 0;
+    uint32_t  count    = 0;
+    for (uint32_t index = 0; index <= DYNAMIC_KEYMAP_KEY_COUNT; index++) {
+        bool dirty = index < DYNAMIC_KEYMAP_KEY_COUNT && (keymap_mirror_dirty[index / 8] & (1 << (index % 8)));
+        if (dirty) {
+            if (count == 0) {
+                start = index;
+            }
+            buffer[count * 2]     = (uint8_t)(keycodes[index] >> 8);
+            buffer[count * 2 + 1] = (uint8_t)(keycodes[index] & 0xFF);
+            count++;
+        }
+        if (count > 0 && (!dirty || count == sizeof(buffer) / 2)) {
+            nvm_dynamic_keymap_update_buffer(start * 2, count * 2, buffer);
+            count = 0;
+        }
+    }
+    memset(keymap_mirror_dirty, 0, sizeof(keymap_mirror_dirty));
+
+#    ifdef ENCODER_MAP_ENABLE
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (uint8_t encoder = 0; encoder < NUM_ENCODERS; encoder++) {
+            for (uint8_t dir = 0; dir < 2; dir++) {
+                if (encoder_mirror_dirty[layer][encoder][dir]) {
+                    nvm_dynamic_keymap_update_encoder(layer, encoder, dir == 0, encoder_mirror[layer][encoder][dir]);
+                    encoder_mirror_dirty[layer][encoder][dir] = false;
+                }
+            }
+        }
+    }
+#    endif // ENCODER_MAP_ENABLE
+
+    mirror_dirty = false;
+}
+
+bool dynamic_keymap_flush_pending(void) {
+    return mirror_dirty;
+}
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+
+void dynamic_keymap_init(void) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    dynamic_keymap_mirror_ensure_loaded();
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+}
+
+void dynamic_keymap_task(void) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    // Wait for writes to settle, so a whole VIA upload becomes a single batch of NVM writes
+    if (mirror_dirty && timer_elapsed32(mirror_last_write) >= DYNAMIC_KEYMAP_RAM_MIRROR_FLUSH_DELAY) {
+        dynamic_keymap_flush();
+    }
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+}
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
 
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+    dynamic_keymap_mirror_ensure_loaded();
+    return keymap_mirror[layer][row][column];
+#else
     return nvm_dynamic_keymap_read_keycode(layer, row, column);
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
+    dynamic_keymap_mirror_ensure_loaded();
+    dynamic_keymap_mirror_set_keycode((layer * MATRIX_ROWS * MATRIX_COLS) + (row * MATRIX_COLS) + column, keycode);
+#else
     nvm_dynamic_keymap_update_keycode(layer, row, column, keycode);
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+    layer_resolution_cache_invalidate_key(MAKE_KEYPOS(row, column));
 }
 
 #ifdef ENCODER_MAP_ENABLE
 uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
+#    ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
+    dynamic_keymap_mirror_ensure_loaded();
+    return encoder_mirror[layer][encoder_id][clockwise ? 0 : 1];
+#    else
     return nvm_dynamic_keymap_read_encoder(layer, encoder_id, clockwise);
+#    endif // DYNAMIC_KEYMAP_RAM_MIRROR
 }
 
 void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
+#    ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return;
+    dynamic_keymap_mirror_ensure_loaded();
+    uint8_t dir = clockwise ? 0 : 1;
+    if (encoder_mirror[layer][encoder_id][dir] != keycode) {
+        encoder_mirror[layer][encoder_id][dir]       = keycode;
+        encoder_mirror_dirty[layer][encoder_id][dir] = true;
+        dynamic_keymap_mirror_mark_dirty();
+    }
+#    else
     nvm_dynamic_keymap_update_encoder(layer, encoder_id, clockwise, keycode);
+#    endif // DYNAMIC_KEYMAP_RAM_MIRROR
 }
 #endif // ENCODER_MAP_ENABLE
 
@@ -58,6 +228,11 @@ void dynamic_keymap_reset(void) {
     // Erase the keymaps, if necessary.
     nvm_dynamic_keymap_erase();
 
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    // NVM may have just been erased underneath the mirror, so only entries differing from what's really stored get written back
+    dynamic_keymap_mirror_load();
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+
     // Reset the keymaps in EEPROM to what is in flash.
     for (int layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
         for (int row = 0; row < MATRIX_ROWS; row++) {
@@ -72,14 +247,51 @@ void dynamic_keymap_reset(void) {
         }
 #endif // ENCODER_MAP_ENABLE
     }
+
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    // Callers such as eeconfig_init_via() rely on the keymap having been persisted on return
+    dynamic_keymap_flush();
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
 }
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    dynamic_keymap_mirror_ensure_loaded();
+    uint16_t *keycodes = &keymap_mirror[0][0][0];
+    for (uint32_t i = 0; i < size; i++) {
+        uint32_t byte = (uint32_t)offset + i;
+        if (byte < DYNAMIC_KEYMAP_KEY_COUNT * 2) {
+            // Big endian, matching the NVM representation
+            data[i] = (byte & 1) ? (uint8_t)(keycodes[byte / 2] & 0xFF) : (uint8_t)(keycodes[byte / 2] >> 8);
+        } else {
+            data[i] = 0x00;
+        }
+    }
+#else
     nvm_dynamic_keymap_read_buffer(offset, size, data);
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
 }
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    dynamic_keymap_mirror_ensure_loaded();
+    uint16_t *keycodes = &keymap_mirror[0][0][0];
+    for (uint32_t i = 0; i < size; i++) {
+        uint32_t byte = (uint32_t)offset + i;
+        if (byte < DYNAMIC_KEYMAP_KEY_COUNT * 2) {
+            uint16_t keycode = keycodes[byte / 2];
+            if (byte & 1) {
+                keycode = (keycode & 0xFF00) | data[i];
+            } else {
+                keycode = (keycode & 0x00FF) | (data[i] << 8);
+            }
+            dynamic_keymap_mirror_set_keycode(byte / 2, keycode);
+        }
+    }
+#else
     nvm_dynamic_keymap_update_buffer(offset, size, data);
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+    layer_resolution_cache_invalidate();
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -166,6 +378,14 @@ void dynamic_keymap_macro_send(uint8_t id) {
         ++offset;
     }
 
+#ifdef SEND_STRING_NONBLOCKING
+    // Type the macro out in the background, unless it doesn't fit in the queue
+    send_string_nvm_state_t queued_state = {.offset = offset};
+    if (send_string_queued_impl(send_string_get_next_nvm, &queued_state, DYNAMIC_KEYMAP_MACRO_DELAY)) {
+        return;
+    }
+#endif
+
     send_string_nvm_state_t state = {.offset = offset};
     send_string_with_delay_impl(send_string_get_next_nvm, &state, DYNAMIC_KEYMAP_MACRO_DELAY);
 }
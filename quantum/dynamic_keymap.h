@@ -26,6 +26,8 @@
 #    define DYNAMIC_KEYMAP_MACRO_COUNT 16
 #endif
 
+void     dynamic_keymap_init(void);
+void     dynamic_keymap_task(void);
 uint8_t  dynamic_keymap_get_layer_count(void);
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column);
 void     dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode);
@@ -34,6 +36,12 @@ uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool cloc
 void     dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode);
 #endif // ENCODER_MAP_ENABLE
 void dynamic_keymap_reset(void);
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+// Writes any keymap changes held in the RAM mirror back to NVM immediately
+void dynamic_keymap_flush(void);
+// Returns true if the RAM mirror holds changes not yet written to NVM
+bool dynamic_keymap_flush_pending(void);
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
 // These get/set the keycodes as stored in the EEPROM buffer
 // Data is big-endian 16-bit values (the keycodes)
 // Order is by layer/row/column
@@ -32,6 +32,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "task_profiling.h"
+#include "latency_trace.h"
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -83,6 +85,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef SECURE_ENABLE
 #    include "secure.h"
 #endif
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_NONBLOCKING)
+#    include "send_string.h"
+#endif
 #ifdef POINTING_DEVICE_ENABLE
 #    include "pointing_device.h"
 #endif
@@ -104,6 +109,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef VIA_ENABLE
 #    include "via.h"
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#endif
 #ifdef DIP_SWITCH_ENABLE
 #    include "dip_switch.h"
 #endif
@@ -419,9 +427,11 @@ __attribute__((weak)) void housekeeping_task_user(void) {}
  * Invokes hooks for executing code after QMK is done after each loop iteration.
  */
 void housekeeping_task(void) {
+    TASK_PROFILING_START(TASK_PROFILING_HOUSEKEEPING);
     housekeeping_task_modules();
     housekeeping_task_kb();
     housekeeping_task_user();
+    TASK_PROFILING_STOP(TASK_PROFILING_HOUSEKEEPING);
 }
 
 /** \brief quantum_init
@@ -460,6 +470,9 @@ void keyboard_init(void) {
 #ifdef VIA_ENABLE
     via_init();
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+    dynamic_keymap_init();
+#endif
 #ifdef SPLIT_KEYBOARD
     split_pre_init();
 #endif
@@ -625,7 +638,9 @@ static bool matrix_task(void) {
                 const bool key_pressed = current_row & col_mask;
 
                 if (process_keypress) {
-                    action_exec(MAKE_KEYEVENT(row, col, key_pressed));
+                    keyevent_t event = MAKE_KEYEVENT(row, col, key_pressed);
+                    LATENCY_TRACE_BEGIN(&event);
+                    action_exec(event);
                 }
 
                 switch_events(row, col, key_pressed);
@@ -699,17 +714,26 @@ void quantum_task(void) {
 #ifdef LAYER_LOCK_ENABLE
     layer_lock_task();
 #endif
+
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_NONBLOCKING)
+    send_string_task();
+#endif
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
     __attribute__((unused)) bool activity_has_occurred = false;
-    if (matrix_task()) {
+    TASK_PROFILING_START(TASK_PROFILING_MATRIX);
+    const bool matrix_changed = matrix_task();
+    TASK_PROFILING_STOP(TASK_PROFILING_MATRIX);
+    if (matrix_changed) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
 
+    TASK_PROFILING_START(TASK_PROFILING_QUANTUM);
     quantum_task();
+    TASK_PROFILING_STOP(TASK_PROFILING_QUANTUM);
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
     split_watchdog_task();
@@ -723,7 +747,9 @@ void keyboard_task(void) {
     led_matrix_task();
 #endif
 #ifdef RGB_MATRIX_ENABLE
+    TASK_PROFILING_START(TASK_PROFILING_RGB_MATRIX);
     rgb_matrix_task();
+    TASK_PROFILING_STOP(TASK_PROFILING_RGB_MATRIX);
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
@@ -733,21 +759,29 @@ void keyboard_task(void) {
 #endif
 
 #ifdef ENCODER_ENABLE
-    if (encoder_task()) {
+    TASK_PROFILING_START(TASK_PROFILING_ENCODER);
+    const bool encoder_changed = encoder_task();
+    TASK_PROFILING_STOP(TASK_PROFILING_ENCODER);
+    if (encoder_changed) {
         last_encoder_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
-    if (pointing_device_task()) {
+    TASK_PROFILING_START(TASK_PROFILING_POINTING_DEVICE);
+    const bool pointing_device_changed = pointing_device_task();
+    TASK_PROFILING_STOP(TASK_PROFILING_POINTING_DEVICE);
+    if (pointing_device_changed) {
         last_pointing_device_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef OLED_ENABLE
+    TASK_PROFILING_START(TASK_PROFILING_OLED);
     oled_task();
+    TASK_PROFILING_STOP(TASK_PROFILING_OLED);
 #    if OLED_TIMEOUT > 0
     // Wake up oled if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) oled_on();
@@ -793,6 +827,10 @@ void keyboard_task(void) {
 
     led_task();
 
+#ifdef DYNAMIC_KEYMAP_ENABLE
+    dynamic_keymap_task();
+#endif
+
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
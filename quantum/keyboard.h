@@ -40,6 +40,9 @@ typedef struct {
     uint16_t        time;
     keyevent_type_t type;
     bool            pressed;
+#ifdef LATENCY_TRACE_ENABLE
+    uint16_t trace_id;
+#endif
 } keyevent_t;
 
 /* equivalent test of keypos_t */
@@ -119,6 +119,20 @@ __attribute__((weak)) combo_t* combo_get(uint16_t combo_idx) {
     return combo_get_raw(combo_idx);
 }
 
+#    if defined(COMBO_KEY_INDEX)
+
+#        ifndef COMBO_KEY_INDEX_SIZE
+#            define COMBO_KEY_INDEX_SIZE (ARRAY_SIZE(key_combos) * MAX_COMBO_LENGTH)
+#        endif
+
+STATIC_ASSERT(COMBO_KEY_INDEX_SIZE >= ARRAY_SIZE(key_combos), "COMBO_KEY_INDEX_SIZE is smaller than the number of combos");
+STATIC_ASSERT(COMBO_KEY_INDEX_SIZE <= UINT16_MAX, "COMBO_KEY_INDEX_SIZE exceeds the maximum of 65535 keys");
+
+combo_key_index_t combo_key_index[COMBO_KEY_INDEX_SIZE];
+const uint16_t    combo_key_index_size = COMBO_KEY_INDEX_SIZE;
+
+#    endif // defined(COMBO_KEY_INDEX)
+
 #endif // defined(COMBO_ENABLE)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -175,6 +189,19 @@ __attribute__((weak)) const key_override_t* key_override_get(uint16_t key_overri
     return key_override_get_raw(key_override_idx);
 }
 
+#    if defined(KEY_OVERRIDE_INDEX)
+
+#        ifndef KEY_OVERRIDE_INDEX_SIZE
+#            define KEY_OVERRIDE_INDEX_SIZE ARRAY_SIZE(key_overrides)
+#        endif
+
+STATIC_ASSERT(KEY_OVERRIDE_INDEX_SIZE >= ARRAY_SIZE(key_overrides), "KEY_OVERRIDE_INDEX_SIZE is smaller than the number of key overrides");
+
+key_override_index_t key_override_index[KEY_OVERRIDE_INDEX_SIZE];
+const uint16_t       key_override_index_size = KEY_OVERRIDE_INDEX_SIZE;
+
+#    endif // defined(KEY_OVERRIDE_INDEX)
+
 #endif // defined(KEY_OVERRIDE_ENABLE)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,156 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "latency_trace.h"
+#include <string.h>
+#include "debug.h"
+#include "timer.h"
+#include "raw_hid.h"
+
+static latency_trace_entry_t entries[LATENCY_TRACE_BUFFER_SIZE];
+static uint32_t              entries_start[LATENCY_TRACE_BUFFER_SIZE]; // timer_read_fine() at each entry's first stage
+static uint8_t               entries_head  = 0; // next slot to write
+static uint8_t               entries_count = 0;
+static uint16_t              next_trace_id = 1; // 0 marks an untraced event
+
+static uint32_t last_raw_change       = 0;
+static bool     last_raw_change_valid = false;
+
+static latency_trace_entry_t *find_entry(uint16_t trace_id) {
+    if (trace_id == 0) {
+        return NULL;
+    }
+    // Entries are written in trace id order, so the slot can be derived from the id of the newest
+    uint8_t  newest = (entries_head + LATENCY_TRACE_BUFFER_SIZE - 1) % LATENCY_TRACE_BUFFER_SIZE;
+    uint16_t age    = entries[newest].trace_id - trace_id;
+    if (age >= entries_count) {
+        // Overwritten since
+        return NULL;
+    }
+    latency_trace_entry_t *entry = &entries[(newest + LATENCY_TRACE_BUFFER_SIZE - age) % LATENCY_TRACE_BUFFER_SIZE];
+    return entry->trace_id == trace_id ? entry : NULL;
+}
+
+static inline void set_stage(latency_trace_entry_t *entry, latency_trace_stage_t stage, uint32_t now) {
+    uint32_t *start = &entries_start[entry - entries];
+    if (entry->stages == 0) {
+        *start = now;
+    }
+    entry->time[stage] = timer_fine_to_us(TIMER_DIFF_32(now, *start));
+    entry->stages |= 1 << stage;
+}
+
+void latency_trace_matrix_changed(void) {
+    last_raw_change       = timer_read_fine();
+    last_raw_change_valid = true;
+}
+
+void latency_trace_begin(keyevent_t *event) {
+    latency_trace_entry_t *entry = &entries[entries_head];
+    entries_head                 = (entries_head + 1) % LATENCY_TRACE_BUFFER_SIZE;
+    if (entries_count < LATENCY_TRACE_BUFFER_SIZE) {
+        entries_count++;
+    }
+
+    memset(entry, 0, sizeof(*entry));
+    entry->trace_id = next_trace_id++;
+    entry->key      = event->key;
+    entry->pressed  = event->pressed;
+    if (next_trace_id == 0) {
+        next_trace_id = 1;
+    }
+
+    if (last_raw_change_valid) {
+        set_stage(entry, LATENCY_TRACE_RAW, last_raw_change);
+    }
+    set_stage(entry, LATENCY_TRACE_SCAN, timer_read_fine());
+
+    event->trace_id = entry->trace_id;
+}
+
+void latency_trace_record(const keyevent_t *event, latency_trace_stage_t stage) {
+    latency_trace_entry_t *entry = find_entry(event->trace_id);
+    if (entry == NULL || (entry->stages & (1 << stage))) {
+        // Only the first time a stage is reached counts
+        return;
+    }
+    set_stage(entry, stage, timer_read_fine());
+}
+
+void latency_trace_report_sent(void) {
+    uint32_t now = timer_read_fine();
+    for (uint8_t i = 0; i < entries_count; i++) {
+        latency_trace_entry_t *entry = &entries[i];
+        // Only events that process_record() is still busy with can have caused this report
+        bool processing = (entry->stages & (1 << LATENCY_TRACE_PROCESS)) && !(entry->stages & (1 << LATENCY_TRACE_HANDLED));
+        if (processing && !(entry->stages & (1 << LATENCY_TRACE_REPORT))) {
+            set_stage(entry, LATENCY_TRACE_REPORT, now);
+        }
+    }
+}
+
+const latency_trace_entry_t *latency_trace_get(uint8_t index) {
+    if (index >= entries_count) {
+        return NULL;
+    }
+    return &entries[(entries_head + LATENCY_TRACE_BUFFER_SIZE - 1 - index) % LATENCY_TRACE_BUFFER_SIZE];
+}
+
+void latency_trace_clear(void) {
+    memset(entries, 0, sizeof(entries));
+    entries_head          = 0;
+    entries_count         = 0;
+    last_raw_change_valid = false;
+}
+
+void latency_trace_print(void) {
+    __attribute__((unused)) static const char *const stage_names[LATENCY_TRACE_STAGE_COUNT] = {"raw", "scan", "process", "handled", "report"};
+
+    for (uint8_t i = entries_count; i > 0; i--) {
+        const latency_trace_entry_t *entry = latency_trace_get(i - 1);
+        dprintf("#%u %u,%u %s:", entry->trace_id, entry->key.row, entry->key.col, entry->pressed ? "down" : "up");
+        for (uint8_t stage = 0; stage < LATENCY_TRACE_STAGE_COUNT; stage++) {
+            if (entry->stages & (1 << stage)) {
+                dprintf(" %s=%lu", stage_names[stage], (unsigned long)entry->time[stage]);
+            }
+        }
+        dprint("\n");
+    }
+}
+
+bool latency_trace_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 4 || data[0] != LATENCY_TRACE_RAW_HID_ID) {
+        return false;
+    }
+
+    // Request:  [id, command, index]
+    // Response: [id, command, index, status, trace id (2), row, col, pressed, stages, times (4 each)], little endian
+    uint8_t *status = &data[3];
+    switch (data[1]) {
+        case LATENCY_TRACE_RAW_HID_GET_ENTRY: {
+            const latency_trace_entry_t *entry = latency_trace_get(data[2]);
+            if (entry == NULL || length < 10 + LATENCY_TRACE_STAGE_COUNT * sizeof(uint32_t)) {
+                *status = 1;
+                break;
+            }
+            *status = 0;
+            raw_hid_write_u16(&data[4], entry->trace_id);
+            data[6] = entry->key.row;
+            data[7] = entry->key.col;
+            data[8] = entry->pressed;
+            data[9] = entry->stages;
+            for (uint8_t stage = 0; stage < LATENCY_TRACE_STAGE_COUNT; stage++) {
+                raw_hid_write_u32(&data[10 + stage * sizeof(uint32_t)], entry->time[stage]);
+            }
+            break;
+        }
+        case LATENCY_TRACE_RAW_HID_CLEAR:
+            latency_trace_clear();
+            *status = 0;
+            break;
+        default:
+            *status = 1;
+            break;
+    }
+    return true;
+}
@@ -0,0 +1,116 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "keyboard.h"
+
+/*
+    End-to-end key event latency tracing, enabled with `LATENCY_TRACE_ENABLE = yes`.
+
+    Each key event generated by the matrix scan is tagged with a trace id and gets an entry in
+    a ring buffer. As the event moves through the firmware, the time at which it reaches each
+    stage is written into that entry:
+
+        raw      - last change of the raw (undebounced) matrix before the event
+        scan     - the debounced event leaves matrix_task()
+        process  - the event leaves the tapping buffer and enters process_record()
+        handled  - process_record() is done with the event
+        report   - the first keyboard report handed to the host driver between `process` and
+                   `handled`, i.e. the report the event itself caused
+
+    Times are in microseconds from the first stage the entry reached, as measured by
+    timer_read_fine(). scan - raw is the debounce delay, process - scan the time spent waiting
+    on tap-hold decisions, handled - process the time spent in process_* handlers, and
+    report - process the time until the host driver accepted the resulting report. Events that
+    change nothing in the report, such as layer keys, never reach `report`.
+*/
+
+#ifndef LATENCY_TRACE_BUFFER_SIZE
+#    define LATENCY_TRACE_BUFFER_SIZE 16
+#endif
+
+#ifndef LATENCY_TRACE_RAW_HID_ID
+#    define LATENCY_TRACE_RAW_HID_ID 0x51
+#endif
+
+typedef enum {
+    LATENCY_TRACE_RAW,
+    LATENCY_TRACE_SCAN,
+    LATENCY_TRACE_PROCESS,
+    LATENCY_TRACE_HANDLED,
+    LATENCY_TRACE_REPORT,
+    LATENCY_TRACE_STAGE_COUNT,
+} latency_trace_stage_t;
+
+typedef struct {
+    uint16_t trace_id;
+    keypos_t key;
+    bool     pressed;
+    // Bitmask of the stages that were reached, indexed by latency_trace_stage_t
+    uint8_t  stages;
+    uint32_t time[LATENCY_TRACE_STAGE_COUNT];
+} latency_trace_entry_t;
+
+enum latency_trace_raw_hid_command {
+    LATENCY_TRACE_RAW_HID_GET_ENTRY = 0x01,
+    LATENCY_TRACE_RAW_HID_CLEAR     = 0x02,
+};
+
+#ifdef LATENCY_TRACE_ENABLE
+
+/** @brief Notes that the raw matrix changed; used as the start of the next traced events. */
+void latency_trace_matrix_changed(void);
+
+/** @brief Assigns a trace id to `event` and records its scan stage. */
+void latency_trace_begin(keyevent_t *event);
+
+/** @brief Records `stage` for a traced event. Untraced events are ignored. */
+void latency_trace_record(const keyevent_t *event, latency_trace_stage_t stage);
+
+/** @brief Records the report stage for every event that is in process_record() and has not been reported yet. */
+void latency_trace_report_sent(void);
+
+/**
+ * @brief Returns the `index`th most recent entry, starting at 0, or NULL past the oldest entry.
+ */
+const latency_trace_entry_t *latency_trace_get(uint8_t index);
+
+/** @brief Clears every entry. */
+void latency_trace_clear(void);
+
+/** @brief Prints every entry over console, oldest first. */
+void latency_trace_print(void);
+
+/**
+ * @brief Looks up the trace entry requested over raw HID, or clears the buffer.
+ *
+ * The entry is written over the request in `data`. Returns false, leaving `data` alone, for
+ * reports that don't start with LATENCY_TRACE_RAW_HID_ID; raw_hid_receive_quantum() then passes
+ * them on to raw_hid_receive() instead of replying.
+ */
+bool latency_trace_raw_hid_receive(uint8_t *data, uint8_t length);
+
+#    define LATENCY_TRACE_MATRIX_CHANGED() latency_trace_matrix_changed()
+#    define LATENCY_TRACE_BEGIN(event) latency_trace_begin(event)
+#    define LATENCY_TRACE_RECORD(event, stage) latency_trace_record((event), (stage))
+#    define LATENCY_TRACE_REPORT_SENT() latency_trace_report_sent()
+
+#else
+
+#    define LATENCY_TRACE_MATRIX_CHANGED() \
+        do {                               \
+        } while (0)
+#    define LATENCY_TRACE_BEGIN(event) \
+        do {                           \
+        } while (0)
+#    define LATENCY_TRACE_RECORD(event, stage) \
+        do {                                   \
+        } while (0)
+#    define LATENCY_TRACE_REPORT_SENT() \
+        do {                            \
+        } while (0)
+
+#endif // LATENCY_TRACE_ENABLE
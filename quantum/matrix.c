@@ -21,6 +21,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "matrix.h"
 #include "debounce.h"
 #include "atomic_util.h"
+#include "latency_trace.h"
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
@@ -47,6 +48,11 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define MATRIX_INPUT_PRESSED_STATE 0
 #endif
 
+// The idle probe relies on driving every row at once, so only applies to the stock COL2ROW scan
+#if defined(MATRIX_IDLE_PROBE) && !defined(DIRECT_PINS) && defined(DIODE_DIRECTION) && (DIODE_DIRECTION == COL2ROW) && defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)
+#    define MATRIX_IDLE_PROBE_SUPPORTED
+#endif
+
 #ifdef DIRECT_PINS
 static SPLIT_MUTABLE pin_t direct_pins[MATRIX_ROWS_PER_HAND][MATRIX_COLS] = DIRECT_PINS;
 #elif (DIODE_DIRECTION == ROW2COL) || (DIODE_DIRECTION == COL2ROW)
@@ -194,6 +200,31 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     current_matrix[current_row] = current_row_value;
 }
 
+#            ifdef MATRIX_IDLE_PROBE_SUPPORTED
+/* Drives every row at once and reports whether any column sees a pressed key.
+ * Lets an idle matrix be checked with a single select/unselect cycle instead of a full scan.
+ */
+static bool matrix_idle_probe(void) {
+    bool key_pressed = false;
+
+    for (uint8_t row = 0; row < MATRIX_ROWS_PER_HAND; row++) {
+        select_row(row);
+    }
+    matrix_output_select_delay();
+
+    for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++) {
+        if (readMatrixPin(col_pins[col_index]) == 0) {
+            key_pressed = true;
+            break;
+        }
+    }
+
+    unselect_rows();
+    matrix_output_unselect_delay(0, key_pressed);
+    return key_pressed;
+}
+#            endif // MATRIX_IDLE_PROBE_SUPPORTED
+
 #        elif (DIODE_DIRECTION == ROW2COL)
 
 static bool select_col(uint8_t col) {
@@ -316,10 +347,25 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 }
 #endif
 
+#ifdef MATRIX_IDLE_PROBE_SUPPORTED
+// true when the last scan saw no keys down
+static bool matrix_idle = false;
+#endif
+
 uint8_t matrix_scan(void) {
     matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
 
-#if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
+#ifdef MATRIX_IDLE_PROBE_SUPPORTED
+    // Only walk the rows once something is pressed; debounce below still runs every scan
+    if (!matrix_idle || matrix_idle_probe()) {
+        bool any_pressed = false;
+        for (uint8_t current_row = 0; current_row < MATRIX_ROWS_PER_HAND; current_row++) {
+            matrix_read_cols_on_row(curr_matrix, current_row);
+            any_pressed |= curr_matrix[current_row] != 0;
+        }
+        matrix_idle = !any_pressed;
+    }
+#elif defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
     // Set row, read cols
     for (uint8_t current_row = 0; current_row < MATRIX_ROWS_PER_HAND; current_row++) {
         matrix_read_cols_on_row(curr_matrix, current_row);
@@ -333,7 +379,10 @@ uint8_t matrix_scan(void) {
 #endif
 
     bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
-    if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
+    if (changed) {
+        memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
+        LATENCY_TRACE_MATRIX_CHANGED();
+    }
 
 #ifdef SPLIT_KEYBOARD
     changed = debounce(raw_matrix, matrix + thisHand, MATRIX_ROWS_PER_HAND, changed) | matrix_post_scan();
@@ -0,0 +1,73 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+#include "timer.h"
+}
+
+class MatrixIdleProbe : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_reset();
+        matrix_init();
+        // Settle into the idle state
+        matrix_scan();
+        mock_select_cycles = 0;
+    }
+};
+
+TEST_F(MatrixIdleProbe, IdleScanSelectsAllRowsOnce) {
+    for (int i = 0; i < 10; i++) {
+        EXPECT_FALSE(matrix_scan());
+    }
+    // One probe per scan, driving every row, instead of a row-by-row walk
+    EXPECT_EQ(mock_select_cycles, 10);
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        EXPECT_EQ(matrix_get_row(row), 0);
+    }
+}
+
+TEST_F(MatrixIdleProbe, KeyPressWakesFullScan) {
+    mock_press_key(2, 3, true);
+    EXPECT_TRUE(matrix_scan());
+    EXPECT_EQ(matrix_get_row(2), (matrix_row_t)1 << 3);
+    EXPECT_TRUE(matrix_is_on(2, 3));
+    // Probe, followed by a full row-by-row scan
+    EXPECT_EQ(mock_select_cycles, 1 + MATRIX_ROWS);
+
+    // Full scans continue while a key is held
+    mock_select_cycles = 0;
+    EXPECT_FALSE(matrix_scan());
+    EXPECT_EQ(mock_select_cycles, MATRIX_ROWS);
+
+    mock_press_key(2, 3, false);
+    EXPECT_TRUE(matrix_scan());
+    EXPECT_EQ(matrix_get_row(2), 0);
+
+    // Back to probing
+    mock_select_cycles = 0;
+    EXPECT_FALSE(matrix_scan());
+    EXPECT_EQ(mock_select_cycles, 1);
+}
+
+TEST_F(MatrixIdleProbe, MultipleKeysAcrossRows) {
+    mock_press_key(0, 0, true);
+    mock_press_key(3, 4, true);
+    EXPECT_TRUE(matrix_scan());
+    EXPECT_EQ(matrix_get_row(0), (matrix_row_t)1 << 0);
+    EXPECT_EQ(matrix_get_row(1), 0);
+    EXPECT_EQ(matrix_get_row(2), 0);
+    EXPECT_EQ(matrix_get_row(3), (matrix_row_t)1 << 4);
+
+    mock_press_key(0, 0, false);
+    EXPECT_TRUE(matrix_scan());
+    EXPECT_EQ(matrix_get_row(0), 0);
+    EXPECT_EQ(matrix_get_row(3), (matrix_row_t)1 << 4);
+
+    mock_press_key(3, 4, false);
+    EXPECT_TRUE(matrix_scan());
+    EXPECT_EQ(matrix_get_row(3), 0);
+}
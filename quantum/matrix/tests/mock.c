@@ -0,0 +1,61 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "mock.h"
+#include "matrix.h"
+
+static const pin_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+static bool pin_is_output[MOCK_PIN_COUNT];
+static bool pin_level[MOCK_PIN_COUNT];
+static bool key_pressed[MATRIX_ROWS][MATRIX_COLS];
+
+uint32_t mock_select_cycles = 0;
+
+void mock_set_pin_input_high(pin_t pin) {
+    pin_is_output[pin] = false;
+    pin_level[pin]     = true;
+}
+
+void mock_set_pin_output(pin_t pin) {
+    pin_is_output[pin] = true;
+}
+
+void mock_write_pin(pin_t pin, bool level) {
+    pin_level[pin] = level;
+}
+
+bool mock_read_pin(pin_t pin) {
+    if (pin_is_output[pin]) {
+        return pin_level[pin];
+    }
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        if (col_pins[col] != pin) {
+            continue;
+        }
+        // Pulled up unless a pressed key connects it to a row being driven low
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            if (key_pressed[row][col] && pin_is_output[row_pins[row]] && !pin_level[row_pins[row]]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void mock_press_key(uint8_t row, uint8_t col, bool pressed) {
+    key_pressed[row][col] = pressed;
+}
+
+void mock_reset(void) {
+    memset(key_pressed, 0, sizeof(key_pressed));
+    mock_select_cycles = 0;
+}
+
+void matrix_output_select_delay(void) {
+    mock_select_cycles++;
+}
+
+void matrix_output_unselect_delay(uint8_t line, bool key_pressed) {}
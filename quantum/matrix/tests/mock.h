@@ -0,0 +1,28 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef uint8_t pin_t;
+
+#define MOCK_PIN_COUNT 16
+
+#define gpio_set_pin_input_high(pin) (mock_set_pin_input_high(pin))
+#define gpio_set_pin_output(pin) (mock_set_pin_output(pin))
+#define gpio_write_pin_low(pin) (mock_write_pin(pin, false))
+#define gpio_write_pin_high(pin) (mock_write_pin(pin, true))
+#define gpio_read_pin(pin) (mock_read_pin(pin))
+
+void mock_set_pin_input_high(pin_t pin);
+void mock_set_pin_output(pin_t pin);
+void mock_write_pin(pin_t pin, bool level);
+bool mock_read_pin(pin_t pin);
+
+/* Simulated switch matrix: a pressed key connects its column pin to its row pin */
+void mock_press_key(uint8_t row, uint8_t col, bool pressed);
+void mock_reset(void);
+
+/* Number of select/read cycles, i.e. calls to matrix_output_select_delay() */
+extern uint32_t mock_select_cycles;
@@ -0,0 +1,10 @@
+matrix_idle_probe_DEFS := -DMATRIX_TESTS -DIGNORE_ATOMIC_BLOCK -DNO_PRINT -DNO_DEBUG -DMATRIX_IDLE_PROBE
+matrix_idle_probe_CONFIG := $(QUANTUM_PATH)/matrix/tests/config_mock.h
+
+matrix_idle_probe_SRC := \
+	platforms/test/timer.c \
+	$(QUANTUM_PATH)/debounce/none.c \
+	$(QUANTUM_PATH)/matrix/tests/mock.c \
+	$(QUANTUM_PATH)/matrix/tests/matrix_idle_probe_tests.cpp \
+	$(QUANTUM_PATH)/matrix_common.c \
+	$(QUANTUM_PATH)/matrix.c
@@ -3,6 +3,7 @@
 #include "wait.h"
 #include "print.h"
 #include "debug.h"
+#include "latency_trace.h"
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
@@ -163,6 +164,9 @@ __attribute__((weak)) void matrix_init(void) {
 
 __attribute__((weak)) uint8_t matrix_scan(void) {
     bool changed = matrix_scan_custom(raw_matrix);
+    if (changed) {
+        LATENCY_TRACE_MATRIX_CHANGED();
+    }
 
 #ifdef SPLIT_KEYBOARD
     changed = debounce(raw_matrix, matrix + thisHand, MATRIX_ROWS_PER_HAND, changed) | matrix_post_scan();
@@ -56,6 +56,23 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_FONT_GLYPH_CACHE_ENTRIES
+/**
+ * @def This controls how many recently drawn glyphs are kept in RAM for each loaded font, already decompressed, so
+ *      that redrawing them skips the glyph lookup and decoding. Each entry needs
+ *      \ref QUANTUM_PAINTER_FONT_GLYPH_CACHE_BYTES of RAM, per font. Defaults to 0, disabling the cache.
+ */
+#    define QUANTUM_PAINTER_FONT_GLYPH_CACHE_ENTRIES 0
+#endif
+
+#ifndef QUANTUM_PAINTER_FONT_GLYPH_CACHE_BYTES
+/**
+ * @def This controls the size of each glyph cache entry. Glyphs whose decompressed pixel data is larger are never
+ *      cached.
+ */
+#    define QUANTUM_PAINTER_FONT_GLYPH_CACHE_BYTES 64
+#endif
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
@@ -72,6 +89,15 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+/**
+ * @def This controls whether images and fonts are decoded into two alternating pixel data buffers, so that one can be
+ *      transmitted (using DMA, where the comms driver supports it) while the other is being filled. Doubles the RAM
+ *      used by the pixel data buffer.
+ */
+#    define QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER FALSE
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
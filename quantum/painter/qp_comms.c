@@ -36,6 +36,14 @@ void qp_comms_stop(painter_device_t device) {
     driver->comms_vtable->comms_stop(device);
 }
 
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+static const void *background_send_data = NULL;
+
+void qp_comms_allow_background_send(const void *data) {
+    background_send_data = data;
+}
+#endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+
 uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
     painter_driver_t *driver = (painter_driver_t *)device;
     if (!driver || !driver->validate_ok) {
@@ -43,6 +51,12 @@ uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_
         return false;
     }
 
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+    if (data == background_send_data && driver->comms_vtable->comms_send_async) {
+        return driver->comms_vtable->comms_send_async(device, data, byte_count);
+    }
+#endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+
     return driver->comms_vtable->comms_send(device, data, byte_count);
 }
 
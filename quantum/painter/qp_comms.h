@@ -16,6 +16,12 @@ bool     qp_comms_start(painter_device_t device);
 void     qp_comms_stop(painter_device_t device);
 uint32_t qp_comms_send(painter_device_t device, const void* data, uint32_t byte_count);
 
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+// Lets qp_comms_send() of this buffer return before it has been transmitted, if the comms driver supports it. The caller
+// must leave the buffer untouched until the next comms operation. NULL stops it.
+void qp_comms_allow_background_send(const void* data);
+#endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
 
@@ -10,7 +10,15 @@
 // Quantum Painter utility functions
 
 // Global variable used for native pixel data streaming.
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+extern uint8_t *qp_internal_global_pixdata_buffer;
+#else
 extern uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+
+// Sends the global pixdata buffer to the display mid-stream. When double-buffered, the transfer may still be in progress
+// on return, and the global pixdata buffer points at the other half -- callers must not keep a pointer to it across this.
+bool qp_internal_pixdata_flush(painter_device_t device, uint32_t native_pixel_count);
 
 // Check if the supplied bpp is capable of being rendered
 bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
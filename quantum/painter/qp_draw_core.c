@@ -21,7 +21,14 @@ STATIC_ASSERT((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIXD
 //
 
 // Buffer used for transmitting native pixel data to the downstream device.
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+// Streamed pixel data alternates between two buffers, so the next block can be decoded while the last one is still being
+// transmitted.
+__attribute__((__aligned__(4))) static uint8_t pixdata_buffers[2][QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+uint8_t                                       *qp_internal_global_pixdata_buffer = pixdata_buffers[0];
+#else
 __attribute__((__aligned__(4))) uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
 
 // Static buffer to contain a generated color palette
 static bool                                       generated_palette = false;
@@ -42,6 +49,22 @@ uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device) {
     return ((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE * 8) / driver->native_bits_per_pixel);
 }
 
+// Sends the global pixdata buffer to the display mid-stream, leaving the global pixdata buffer ready to be refilled
+bool qp_internal_pixdata_flush(painter_device_t device, uint32_t native_pixel_count) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+    uint8_t *filled                   = qp_internal_global_pixdata_buffer;
+    qp_internal_global_pixdata_buffer = (filled == pixdata_buffers[0]) ? pixdata_buffers[1] : pixdata_buffers[0];
+
+    qp_comms_allow_background_send(filled);
+    bool ret = driver->driver_vtable->pixdata(device, filled, native_pixel_count);
+    qp_comms_allow_background_send(NULL);
+    return ret;
+#else
+    return driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, native_pixel_count);
+#endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+}
+
 // qp_setpixel internal implementation, but accepts a buffer with pre-converted native pixel. Only the first pixel is used.
 bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y) {
     painter_driver_t *driver = (painter_driver_t *)device;
@@ -12,6 +12,15 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QFF font handles
 
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_ENTRIES > 0
+typedef struct qff_glyph_cache_entry_t {
+    uint32_t code_point;
+    uint8_t  width;
+    uint16_t length; // number of bytes of decompressed pixel data, zero if the entry is unused
+    uint8_t  data[QUANTUM_PAINTER_FONT_GLYPH_CACHE_BYTES];
+} qff_glyph_cache_entry_t;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_ENTRIES > 0
+
 typedef struct qff_font_handle_t {
     painter_font_desc_t   base;
     bool                  validate_ok;
@@ -21,6 +30,9 @@ typedef struct qff_font_handle_t {
     bool                  has_palette;
     bool                  is_panel_native;
     painter_compression_t compression_scheme;
+    bool                  unicode_table_sorted;
+    uint32_t              unicode_table_offset; // location of the first unicode glyph entry
+    uint32_t              glyph_data_offset;    // location of the first byte of glyph pixel data
     union {
         qp_stream_t        stream;
         qp_memory_stream_t mem_stream;
@@ -32,10 +44,115 @@ typedef struct qff_font_handle_t {
     bool  owns_buffer;
     void *buffer;
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_ENTRIES > 0
+    qff_glyph_cache_entry_t  glyph_cache[QUANTUM_PAINTER_FONT_GLYPH_CACHE_ENTRIES];
+    uint8_t                  glyph_cache_next; // the entry replaced next
+    qff_glyph_cache_entry_t *cached_glyph;     // set by qp_drawtext_prepare_glyph_for_render() if the glyph was cached
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_ENTRIES > 0
 } qff_font_handle_t;
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper: unicode glyph lookup
+
+static bool qp_font_unicode_table_is_sorted(qff_font_handle_t *font) {
+    if (qp_stream_setpos(&font->stream, font->unicode_table_offset) < 0) {
+        return false;
+    }
+
+    qff_unicode_glyph_v1_t glyph_info;
+    uint32_t               prev_code_point = 0;
+    for (uint16_t i = 0; i < font->num_unicode_glyphs; ++i) {
+        if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &font->stream) != 1) {
+            return false;
+        }
+        if (i > 0 && glyph_info.code_point <= prev_code_point) {
+            return false;
+        }
+        prev_code_point = glyph_info.code_point;
+    }
+    return true;
+}
+
+static bool qp_font_read_unicode_glyph(qff_font_handle_t *font, uint16_t index, qff_unicode_glyph_v1_t *glyph_info) {
+    if (qp_stream_setpos(&font->stream, font->unicode_table_offset + index * sizeof(qff_unicode_glyph_v1_t)) < 0) {
+        qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
+        return false;
+    }
+    if (qp_stream_read(glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &font->stream) != 1) {
+        qp_dprintf("Failed to read unicode glyph info\n");
+        return false;
+    }
+    return true;
+}
+
+static bool qp_font_find_unicode_glyph(qff_font_handle_t *font, uint32_t code_point, qff_unicode_glyph_v1_t *glyph_info) {
+    if (font->unicode_table_sorted) {
+        uint16_t lo = 0;
+        uint16_t hi = font->num_unicode_glyphs;
+        while (lo < hi) {
+            uint16_t mid = lo + (hi - lo) / 2;
+            if (!qp_font_read_unicode_glyph(font, mid, glyph_info)) {
+                return false;
+            }
+            if (glyph_info->code_point == code_point) {
+                return true;
+            }
+            if (glyph_info->code_point < code_point) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return false;
+    }
+
+    // Unsorted tables can only be scanned
+    for (uint16_t i = 0; i < font->num_unicode_glyphs; ++i) {
+        if (!qp_font_read_unicode_glyph(font, i, glyph_info)) {
+            return false;
+        }
+        if (glyph_info->code_point == code_point) {
+            return true;
+        }
+    }
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper: glyph cache
+
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_ENTRIES > 0
+
+static qff_glyph_cache_entry_t *qp_font_glyph_cache_find(qff_font_handle_t *font, uint32_t code_point) {
+    for (uint8_t i = 0; i < QUANTUM_PAINTER_FONT_GLYPH_CACHE_ENTRIES; ++i) {
+        if (font->glyph_cache[i].length > 0 && font->glyph_cache[i].code_point == code_point) {
+            return &font->glyph_cache[i];
+        }
+    }
+    return NULL;
+}
+
+// Input callback wrapper which keeps a copy of each decompressed byte
+typedef struct qff_glyph_capture_state_t {
+    qp_internal_byte_input_callback input_callback;
+    void *                          input_state;
+    qff_glyph_cache_entry_t *       entry;
+    uint16_t                        length;
+} qff_glyph_capture_state_t;
+
+static int16_t qp_font_glyph_capture_byte(void *cb_arg) {
+    qff_glyph_capture_state_t *state   = (qff_glyph_capture_state_t *)cb_arg;
+    int16_t                    byteval = state->input_callback(state->input_state);
+    if (byteval >= 0 && state->length < sizeof(state->entry->data)) {
+        state->entry->data[state->length++] = byteval;
+    }
+    return byteval;
+}
+
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_ENTRIES > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
@@ -106,6 +223,23 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
         return NULL;
     }
 
+    // Work out where the glyph info and data live, so that drawing doesn't have to
+    font->unicode_table_offset = sizeof(qff_font_descriptor_v1_t)                                       // Skip the font descriptor
+                                 + (font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
+                                 + sizeof(qgf_block_header_v1_t);                                   // Skip the unicode block header
+    font->glyph_data_offset = sizeof(qff_font_descriptor_v1_t)                                                                                                         // Skip the font descriptor
+                              + (font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                       // Skip the ascii table
+                              + (font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
+                              + (font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                            // Skip the palette
+                              + sizeof(qgf_block_header_v1_t);                                                                                                         // Skip the data block header
+    font->unicode_table_sorted = qp_font_unicode_table_is_sorted(font);
+
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_ENTRIES > 0
+    memset(font->glyph_cache, 0, sizeof(font->glyph_cache));
+    font->glyph_cache_next = 0;
+    font->cached_glyph     = NULL;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_ENTRIES > 0
+
     // Validation success, we can return the handle
     font->validate_ok = true;
     qp_dprintf("qp_load_font: ok\n");
@@ -215,6 +349,16 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
 }
 
 static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_ENTRIES > 0
+    // Cached glyphs are drawn from RAM, the stream doesn't need positioning
+    qff_font->cached_glyph = qp_font_glyph_cache_find(qff_font, code_point);
+    if (qff_font->cached_glyph) {
+        *width = qff_font->cached_glyph->width;
+        return true;
+    }
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_ENTRIES > 0
+
+    uint32_t glyph_value;
     if (code_point >= 0x20 && code_point < 0x7F && qff_font->has_ascii_table) {
         // Do ascii table
         qff_ascii_glyph_v1_t glyph_info;
@@ -231,65 +375,27 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
             return false;
         }
 
-        uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-        uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-        uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                               + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                               + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                               + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                               + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                               + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-        if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing ascii glyph data\n");
-            return false;
-        }
-
-        *width = glyph_width;
-        return true;
+        glyph_value = glyph_info.value;
     } else {
         // Do unicode table, which may include singular ascii glyphs if full ascii table isn't specified
-        uint32_t glyph_info_offset = sizeof(qff_font_descriptor_v1_t)                                       // Skip the font descriptor
-                                     + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
-                                     + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
-
-        if (qp_stream_setpos(&qff_font->stream, glyph_info_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing glyph data\n");
+        qff_unicode_glyph_v1_t glyph_info;
+        if (!qp_font_find_unicode_glyph(qff_font, code_point, &glyph_info)) {
+            qp_dprintf("Failed to find unicode glyph info\n");
             return false;
         }
 
-        qff_unicode_glyph_v1_t glyph_info;
-        for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
-            if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
-                qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
-                return false;
-            }
-
-            if (glyph_info.code_point == code_point) {
-                uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-                uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-                uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                                       + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                                       + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                                       + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                                       + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                                       + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-                if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-                    qp_dprintf("Failed to set stream position while preparing unicode glyph data\n");
-                    return false;
-                }
-
-                *width = glyph_width;
-                return true;
-            }
-        }
+        glyph_value = glyph_info.value;
+    }
 
-        // Not found
-        qp_dprintf("Failed to find unicode glyph info\n");
+    uint8_t  glyph_width  = (uint8_t)(glyph_value & QFF_GLYPH_WIDTH_MASK);
+    uint32_t glyph_offset = ((glyph_value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
+    if (qp_stream_setpos(&qff_font->stream, qff_font->glyph_data_offset + glyph_offset) < 0) {
+        qp_dprintf("Failed to set stream position while preparing glyph data\n");
         return false;
     }
-    return false;
+
+    *width = glyph_width;
+    return true;
 }
 
 // Function to iterate over each UTF8 codepoint, invoking the callback for each decoded glyph
@@ -366,6 +472,34 @@ static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_f
 
     // Decode the pixel data for the glyph, and stream it
     uint32_t pixel_count = ((uint32_t)width) * height;
+
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_ENTRIES > 0
+    qff_glyph_cache_entry_t *cached = qff_font->cached_glyph;
+    if (cached) {
+        // Replay the already-decompressed pixel data
+        qp_memory_stream_t             cached_stream = qp_make_memory_stream(cached->data, cached->length);
+        qp_internal_byte_input_state_t cached_state  = {.device = state->device, .src_stream = &cached_stream.base};
+        return qp_internal_appender(state->device, qff_font->bpp, pixel_count, qp_internal_prepare_input_state(&cached_state, IMAGE_UNCOMPRESSED), &cached_state);
+    }
+
+    // Keep a copy of the decompressed pixel data while drawing, if it fits
+    uint32_t glyph_bytes = (pixel_count * qff_font->bpp + 7) / 8;
+    if (glyph_bytes <= QUANTUM_PAINTER_FONT_GLYPH_CACHE_BYTES) {
+        qff_glyph_cache_entry_t *entry = &qff_font->glyph_cache[qff_font->glyph_cache_next];
+        qff_font->glyph_cache_next     = (qff_font->glyph_cache_next + 1) % QUANTUM_PAINTER_FONT_GLYPH_CACHE_ENTRIES;
+        entry->length                  = 0;
+
+        qff_glyph_capture_state_t capture = {.input_callback = state->input_callback, .input_state = state->input_state, .entry = entry, .length = 0};
+        bool                      ok      = qp_internal_appender(state->device, qff_font->bpp, pixel_count, qp_font_glyph_capture_byte, &capture);
+        if (ok && capture.length == glyph_bytes) {
+            entry->code_point = code_point;
+            entry->width      = width;
+            entry->length     = capture.length;
+        }
+        return ok;
+    }
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_ENTRIES > 0
+
     return qp_internal_appender(state->device, qff_font->bpp, pixel_count, state->input_callback, state->input_state);
 }
 
@@ -44,6 +44,7 @@ typedef struct painter_comms_vtable_t {
     painter_driver_comms_start_func comms_start;
     painter_driver_comms_stop_func  comms_stop;
     painter_driver_comms_send_func  comms_send;
+    painter_driver_comms_send_func  comms_send_async; // optional -- may return before the data has been sent, the next comms call waits for it
 } painter_comms_vtable_t;
 
 typedef void (*painter_driver_comms_send_command_func)(painter_device_t device, uint8_t cmd);
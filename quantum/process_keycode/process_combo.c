@@ -16,6 +16,7 @@
 
 #include "process_combo.h"
 #include <stddef.h>
+#include <string.h>
 #include "process_auto_shift.h"
 #include "caps_word.h"
 #include "timer.h"
@@ -26,6 +27,7 @@
 #include "action_tapping.h"
 #include "action_util.h"
 #include "keymap_introspection.h"
+#include "debug.h"
 
 __attribute__((weak)) void process_combo_event(uint16_t combo_index, bool pressed) {}
 
@@ -199,9 +201,121 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
     return COMBO_TERM;
 }
 
+#ifdef COMBO_KEY_INDEX
+#    ifndef COMBO_TOUCHED_BUFFER_LENGTH
+#        define COMBO_TOUCHED_BUFFER_LENGTH 16
+#    endif
+
+/* Reverse index from keycode to the combos containing it, sorted by keycode
+ * and then by combo index so that combos are still visited in definition
+ * order. The storage is sized from key_combos in keymap_introspection.c. */
+static uint16_t combo_key_index_length = 0;
+static uint16_t combo_key_index_combos = 0;
+static bool     combo_key_index_valid  = false;
+static bool     combo_key_index_fits   = false;
+
+/* Combos processed since the last clear_combos(); these are the only ones
+ * that can hold state needing a reset. */
+static uint16_t touched_combos[COMBO_TOUCHED_BUFFER_LENGTH];
+static uint8_t  touched_combos_length   = 0;
+static bool     touched_combos_overflow = true;
+
+static void combo_key_index_build(void) {
+    combo_key_index_length = 0;
+    combo_key_index_combos = combo_count();
+    combo_key_index_fits   = true;
+
+    for (uint16_t combo_index = 0; combo_index < combo_key_index_combos; ++combo_index) {
+        combo_t *combo = combo_get(combo_index);
+        uint16_t key;
+        for (uint8_t i = 0; (key = pgm_read_word(&combo->keys[i])) != COMBO_END; ++i) {
+            // insertion sort; combos are visited in order so the new entry always goes last among equal keycodes
+            uint16_t pos = combo_key_index_length;
+            while (pos > 0 && combo_key_index[pos - 1].keycode > key) {
+                --pos;
+            }
+            if (pos > 0 && combo_key_index[pos - 1].keycode == key && combo_key_index[pos - 1].combo_index == combo_index) {
+                // keycode listed twice in the same combo
+                continue;
+            }
+            if (combo_key_index_length >= combo_key_index_size) {
+                dprintf("combo: %u combos do not fit in the key index, increase COMBO_KEY_INDEX_SIZE\n", combo_key_index_combos);
+                combo_key_index_fits  = false;
+                combo_key_index_valid = true;
+                return;
+            }
+            memmove(&combo_key_index[pos + 1], &combo_key_index[pos], (combo_key_index_length - pos) * sizeof(combo_key_index_t));
+            combo_key_index[pos] = (combo_key_index_t){
+                .keycode     = key,
+                .combo_index = combo_index,
+            };
+            combo_key_index_length++;
+        }
+    }
+    combo_key_index_valid = true;
+}
+
+static inline bool combo_key_index_ready(void) {
+    if (!combo_key_index_valid || combo_key_index_combos != combo_count()) {
+        combo_key_index_build();
+        touched_combos_overflow = true;
+    }
+    return combo_key_index_fits;
+}
+
+/* Returns the position of the first entry for keycode, or of the entry it
+ * would be inserted before. */
+static uint16_t combo_key_index_find(uint16_t keycode) {
+    uint16_t low = 0, high = combo_key_index_length;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (combo_key_index[mid].keycode < keycode) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+static inline void touch_combo(uint16_t combo_index) {
+    if (touched_combos_overflow) {
+        return;
+    }
+    for (uint8_t i = 0; i < touched_combos_length; ++i) {
+        if (touched_combos[i] == combo_index) {
+            return;
+        }
+    }
+    if (touched_combos_length < COMBO_TOUCHED_BUFFER_LENGTH) {
+        touched_combos[touched_combos_length++] = combo_index;
+    } else {
+        touched_combos_overflow = true;
+    }
+}
+
+void combo_key_index_invalidate(void) {
+    combo_key_index_valid = false;
+}
+#endif
+
 void clear_combos(void) {
     uint16_t index = 0;
     longest_term   = 0;
+#ifdef COMBO_KEY_INDEX
+    if (!touched_combos_overflow) {
+        for (uint8_t i = 0; i < touched_combos_length; ++i) {
+            combo_t *combo = combo_get(touched_combos[i]);
+            if (!COMBO_ACTIVE(combo)) {
+                RESET_COMBO_STATE(combo);
+            }
+        }
+        touched_combos_length = 0;
+        return;
+    }
+    touched_combos_length   = 0;
+    touched_combos_overflow = false;
+#endif
     for (index = 0; index < combo_count(); ++index) {
         combo_t *combo = combo_get(index);
         if (!COMBO_ACTIVE(combo)) {
@@ -581,10 +695,25 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_KEY_INDEX
+    // only visit the combos containing this keycode
+    if (keycode != COMBO_END && combo_key_index_ready()) {
+        for (uint16_t i = combo_key_index_find(keycode); i < combo_key_index_length && combo_key_index[i].keycode == keycode; ++i) {
+            uint16_t idx = combo_key_index[i].combo_index;
+            touch_combo(idx);
+            is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+        }
+    } else
+#endif
+    {
+#ifdef COMBO_KEY_INDEX
+        touched_combos_overflow = true;
+#endif
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo = combo_get(idx);
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+            no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -81,3 +81,16 @@ void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
 bool is_combo_enabled(void);
+
+#ifdef COMBO_KEY_INDEX
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+} combo_key_index_t;
+
+/* Defined in keymap_introspection.c, sized for every key of every combo */
+extern combo_key_index_t combo_key_index[];
+extern const uint16_t    combo_key_index_size;
+
+void combo_key_index_invalidate(void);
+#endif
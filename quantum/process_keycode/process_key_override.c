@@ -24,6 +24,7 @@
 #include "quantum.h"
 #include "quantum_keycodes.h"
 #include "keymap_introspection.h"
+#include <string.h>
 
 #ifndef KEY_OVERRIDE_REPEAT_DELAY
 #    define KEY_OVERRIDE_REPEAT_DELAY 500
@@ -243,13 +244,163 @@ static bool check_activation_event(const key_override_t *override, const bool ke
     }
 }
 
-/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
-static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
-    if (key_override_count() == 0) {
-        return true;
+/** Checks whether the override may activate on this event. Does not change any state. */
+static bool key_override_can_activate(const key_override_t *override, const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods) {
+    // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
+    if (active_mods == 0 && override->trigger_mods != 0) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
     }
 
-    for (uint8_t i = 0; i < key_override_count(); i++) {
+    // Check layer
+    if ((override->layers & (1 << layer)) == 0) {
+        key_override_printf("Not activating override: Not set to activate on pressed layer\n");
+        return false;
+    }
+
+    // Check allowed activation events
+    if (!check_activation_event(override, key_down, is_mod)) {
+        key_override_printf("Not activating override: Activation event not allowed\n");
+        return false;
+    }
+
+    const bool is_trigger = override->trigger == keycode;
+
+    // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
+    if (is_trigger && !key_down) {
+        key_override_printf("Not activating override: Trigger lifted\n");
+        return false;
+    }
+
+    // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
+    const bool no_trigger = override->trigger == KC_NO;
+
+    // Check if aleady active
+    if (override == active_override) {
+        key_override_printf("Not activating override: Alerady actived\n");
+        return false;
+    }
+
+    // Check if enabled
+    if (override->enabled != NULL && !((*(override->enabled) & 1))) {
+        key_override_printf("Not activating override: Not enabled\n");
+        return false;
+    }
+
+    // Check mods precisely
+    if (!key_override_matches_active_modifiers(override, active_mods)) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
+    }
+
+    // Check if trigger key is down.
+    const bool trigger_down = is_trigger && key_down;
+
+    // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
+    // If no trigger key is required, yes.
+    // If the trigger was just pressed, yes.
+    // If the last non-mod key that was pressed down is the trigger key, yes.
+    bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
+
+    if (!should_activate) {
+        key_override_printf("Not activating override. Trigger not down\n");
+        return false;
+    }
+
+    return true;
+}
+
+/** Activates the override. Returns true if the key action for `keycode` should be sent */
+static bool activate_override(const key_override_t *override, const uint16_t keycode, const bool key_down, const bool is_mod, const uint8_t active_mods) {
+    const bool trigger_down = override->trigger == keycode && key_down;
+    const bool no_trigger   = override->trigger == KC_NO;
+
+    key_override_printf("Activating override\n");
+
+    clear_active_override(false);
+
+#ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
+    // Send a dummy keycode before unregistering the modifier(s)
+    // so that suppressing the modifier(s) doesn't falsely get interpreted
+    // by the host OS as a tap of a modifier key.
+    // For example, unintended activations of the start menu on Windows when
+    // using a GUI+<kc> key override with suppressed mods.
+    neutralize_flashing_modifiers(active_mods);
+#endif
+
+    active_override                 = override;
+    active_override_trigger_is_down = true;
+
+    set_suppressed_override_mods(override->suppressed_mods);
+
+    if (!trigger_down && !no_trigger) {
+        // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
+        if (IS_BASIC_KEYCODE(override->trigger)) {
+            del_key(override->trigger);
+        } else {
+            unregister_code(override->trigger);
+        }
+    }
+
+    const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
+
+    bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
+                                mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
+
+    // Try firing the custom handler
+    if (override->custom_action != NULL) {
+        register_replacement &= override->custom_action(true, override->context);
+    }
+
+    if (register_replacement) {
+        const uint8_t override_mods = extract_mod_bits(override->replacement);
+        set_weak_override_mods(override_mods);
+
+        // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
+        if (is_mod) {
+            key_override_printf("Deferring register replacement key\n");
+            schedule_deferred_register(mod_free_replacement);
+            send_keyboard_report();
+        } else {
+            if (IS_BASIC_KEYCODE(mod_free_replacement)) {
+                add_key(mod_free_replacement);
+            } else {
+                key_override_printf("NOT KEY 2\n");
+                send_keyboard_report();
+                // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
+                wait_ms(10);
+                register_code(mod_free_replacement);
+            }
+        }
+    } else {
+        // If not registering the replacement key send keyboard report to update the unregistered keys.
+        send_keyboard_report();
+    }
+
+    // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
+    return !trigger_down;
+}
+
+#ifdef KEY_OVERRIDE_INDEX
+/* Overrides bucketed by trigger keycode, in definition order within each
+ * bucket. The storage is sized from key_overrides in keymap_introspection.c. */
+static uint16_t key_override_index_length = 0;
+static uint16_t key_override_index_count  = 0;
+static bool     key_override_index_valid  = false;
+static bool     key_override_index_fits   = false;
+
+static void key_override_index_build(void) {
+    key_override_index_length = 0;
+    key_override_index_count  = key_override_count();
+    key_override_index_fits   = key_override_index_count <= key_override_index_size;
+    key_override_index_valid  = true;
+
+    if (!key_override_index_fits) {
+        dprintf("key override: %u overrides do not fit in the trigger index, increase KEY_OVERRIDE_INDEX_SIZE\n", key_override_index_count);
+        return;
+    }
+
+    for (uint16_t i = 0; i < key_override_index_count; i++) {
         const key_override_t *const override = key_override_get(i);
 
         // End of array
@@ -257,133 +408,134 @@ static bool try_activating_override(const uint16_t keycode, const uint8_t layer,
             break;
         }
 
-        // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
-        if (active_mods == 0 && override->trigger_mods != 0) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
+        // insertion sort; overrides are visited in order so the new entry always goes last among equal triggers
+        uint16_t pos = key_override_index_length;
+        while (pos > 0 && key_override_index[pos - 1].trigger > override->trigger) {
+            pos--;
         }
+        memmove(&key_override_index[pos + 1], &key_override_index[pos], (key_override_index_length - pos) * sizeof(key_override_index_t));
+        key_override_index[pos] = (key_override_index_t){
+            .trigger        = override->trigger,
+            .trigger_mods   = override->trigger_mods,
+            .override_index = i,
+        };
+        key_override_index_length++;
+    }
+}
 
-        // Check layer
-        if ((override->layers & (1 << layer)) == 0) {
-            key_override_printf("Not activating override: Not set to activate on pressed layer\n");
-            continue;
-        }
+static inline bool key_override_index_ready(void) {
+    if (!key_override_index_valid || key_override_index_count != key_override_count()) {
+        key_override_index_build();
+    }
+    return key_override_index_fits;
+}
 
-        // Check allowed activation events
-        if (!check_activation_event(override, key_down, is_mod)) {
-            key_override_printf("Not activating override: Activation event not allowed\n");
-            continue;
+/* Returns the position of the first entry for trigger, or of the entry it
+ * would be inserted before. */
+static uint16_t key_override_index_find(uint16_t trigger) {
+    uint16_t low = 0, high = key_override_index_length;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (key_override_index[mid].trigger < trigger) {
+            low = mid + 1;
+        } else {
+            high = mid;
         }
+    }
+    return low;
+}
 
-        const bool is_trigger = override->trigger == keycode;
+void key_override_index_invalidate(void) {
+    key_override_index_valid = false;
+}
 
-        // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
-        if (is_trigger && !key_down) {
-            key_override_printf("Not activating override: Trigger lifted\n");
-            continue;
+/** Same as the linear scan in try_activating_override, but only visits the overrides that can possibly activate for this event */
+static bool try_activating_indexed_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
+    // An override can only activate when its trigger is the key in this event, the last non-mod key pressed down, or no key at all
+    const uint16_t triggers[]    = {keycode, last_key_down, KC_NO};
+    uint16_t       next[3]       = {0};
+    uint16_t       bucket_end[3] = {0};
+    uint8_t        buckets       = 0;
+
+    for (uint8_t t = 0; t < 3; t++) {
+        bool duplicate = false;
+        for (uint8_t u = 0; u < t; u++) {
+            duplicate |= triggers[u] == triggers[t];
         }
-
-        // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
-        const bool no_trigger = override->trigger == KC_NO;
-
-        // Check if aleady active
-        if (override == active_override) {
-            key_override_printf("Not activating override: Alerady actived\n");
+        if (duplicate) {
             continue;
         }
+        uint16_t pos = key_override_index_find(triggers[t]);
+        if (pos < key_override_index_length && key_override_index[pos].trigger == triggers[t]) {
+            next[buckets] = pos;
+            while (pos < key_override_index_length && key_override_index[pos].trigger == triggers[t]) {
+                pos++;
+            }
+            bucket_end[buckets] = pos;
+            buckets++;
+        }
+    }
 
-        // Check if enabled
-        if (override->enabled != NULL && !((*(override->enabled) & 1))) {
-            key_override_printf("Not activating override: Not enabled\n");
-            continue;
+    // Merge the buckets so overrides are still tried in definition order
+    while (true) {
+        uint8_t  bucket = 0xFF;
+        uint16_t lowest = UINT16_MAX;
+        for (uint8_t b = 0; b < buckets; b++) {
+            if (next[b] < bucket_end[b] && key_override_index[next[b]].override_index < lowest) {
+                lowest = key_override_index[next[b]].override_index;
+                bucket = b;
+            }
+        }
+        if (bucket == 0xFF) {
+            break;
         }
 
-        // Check mods precisely
-        if (!key_override_matches_active_modifiers(override, active_mods)) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
+        const key_override_index_t *entry = &key_override_index[next[bucket]++];
+        if (active_mods == 0 && entry->trigger_mods != 0) {
             continue;
         }
 
-        // Check if trigger key is down.
-        const bool trigger_down = is_trigger && key_down;
-
-        // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
-        // If no trigger key is required, yes.
-        // If the trigger was just pressed, yes.
-        // If the last non-mod key that was pressed down is the trigger key, yes.
-        bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
-
-        if (!should_activate) {
-            key_override_printf("Not activating override. Trigger not down\n");
+        const key_override_t *const override = key_override_get(entry->override_index);
+        if (!key_override_can_activate(override, keycode, layer, key_down, is_mod, active_mods)) {
             continue;
         }
 
-        key_override_printf("Activating override\n");
+        *activated = true;
+        return activate_override(override, keycode, key_down, is_mod, active_mods);
+    }
 
-        clear_active_override(false);
+    *activated = false;
 
-#ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
-        // Send a dummy keycode before unregistering the modifier(s)
-        // so that suppressing the modifier(s) doesn't falsely get interpreted
-        // by the host OS as a tap of a modifier key.
-        // For example, unintended activations of the start menu on Windows when
-        // using a GUI+<kc> key override with suppressed mods.
-        neutralize_flashing_modifiers(active_mods);
+    return true;
+}
 #endif
 
-        active_override                 = override;
-        active_override_trigger_is_down = true;
-
-        set_suppressed_override_mods(override->suppressed_mods);
-
-        if (!trigger_down && !no_trigger) {
-            // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
-            if (IS_BASIC_KEYCODE(override->trigger)) {
-                del_key(override->trigger);
-            } else {
-                unregister_code(override->trigger);
-            }
-        }
+/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
+static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
+    if (key_override_count() == 0) {
+        return true;
+    }
 
-        const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
+#ifdef KEY_OVERRIDE_INDEX
+    if (key_override_index_ready()) {
+        return try_activating_indexed_override(keycode, layer, key_down, is_mod, active_mods, activated);
+    }
+#endif
 
-        bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
-                                    mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
+    for (uint8_t i = 0; i < key_override_count(); i++) {
+        const key_override_t *const override = key_override_get(i);
 
-        // Try firing the custom handler
-        if (override->custom_action != NULL) {
-            register_replacement &= override->custom_action(true, override->context);
+        // End of array
+        if (override == NULL) {
+            break;
         }
 
-        if (register_replacement) {
-            const uint8_t override_mods = extract_mod_bits(override->replacement);
-            set_weak_override_mods(override_mods);
-
-            // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
-            if (is_mod) {
-                key_override_printf("Deferring register replacement key\n");
-                schedule_deferred_register(mod_free_replacement);
-                send_keyboard_report();
-            } else {
-                if (IS_BASIC_KEYCODE(mod_free_replacement)) {
-                    add_key(mod_free_replacement);
-                } else {
-                    key_override_printf("NOT KEY 2\n");
-                    send_keyboard_report();
-                    // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
-                    wait_ms(10);
-                    register_code(mod_free_replacement);
-                }
-            }
-        } else {
-            // If not registering the replacement key send keyboard report to update the unregistered keys.
-            send_keyboard_report();
+        if (!key_override_can_activate(override, keycode, layer, key_down, is_mod, active_mods)) {
+            continue;
         }
 
         *activated = true;
-
-        // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
-        return !trigger_down;
+        return activate_override(override, keycode, key_down, is_mod, active_mods);
     }
 
     *activated = false;
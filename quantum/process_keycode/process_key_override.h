@@ -105,6 +105,22 @@ bool process_key_override(const uint16_t keycode, const keyrecord_t *const recor
 /** Perform any deferred keys */
 void key_override_task(void);
 
+#ifdef KEY_OVERRIDE_INDEX
+/** Trigger index entry. The trigger mods are copied in so the common no-mods case can be rejected without touching the override itself */
+typedef struct {
+    uint16_t trigger;
+    uint16_t override_index;
+    uint8_t  trigger_mods;
+} key_override_index_t;
+
+/** Defined in keymap_introspection.c, sized for every entry of key_overrides */
+extern key_override_index_t key_override_index[];
+extern const uint16_t       key_override_index_size;
+
+/** Rebuilds the trigger index before the next key event. Call this after changing the trigger or trigger mods of an override at runtime */
+void key_override_index_invalidate(void);
+#endif
+
 /**
  *  Preferrably use these macros to create key overrides. They fix many of the options to a standard setting that should satisfy most basic use-cases. Only directly create a key_override_t struct when you really need to.
  */
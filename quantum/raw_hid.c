@@ -4,6 +4,28 @@
 #include "raw_hid.h"
 #include "host.h"
 
+#ifdef TASK_PROFILING_ENABLE
+#    include "task_profiling.h"
+#endif
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSACTION_STATS)
+#    include "transactions.h"
+#endif
+
+#if defined(TASK_PROFILING_ENABLE) && defined(LATENCY_TRACE_ENABLE) && (TASK_PROFILING_RAW_HID_ID == LATENCY_TRACE_RAW_HID_ID)
+#    error "TASK_PROFILING_RAW_HID_ID and LATENCY_TRACE_RAW_HID_ID must differ"
+#endif
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSACTION_STATS)
+#    if defined(TASK_PROFILING_ENABLE) && (SPLIT_TRANSACTION_STATS_RAW_HID_ID == TASK_PROFILING_RAW_HID_ID)
+#        error "SPLIT_TRANSACTION_STATS_RAW_HID_ID and TASK_PROFILING_RAW_HID_ID must differ"
+#    endif
+#    if defined(LATENCY_TRACE_ENABLE) && (SPLIT_TRANSACTION_STATS_RAW_HID_ID == LATENCY_TRACE_RAW_HID_ID)
+#        error "SPLIT_TRANSACTION_STATS_RAW_HID_ID and LATENCY_TRACE_RAW_HID_ID must differ"
+#    endif
+#endif
+
 void raw_hid_send(uint8_t *data, uint8_t length) {
     host_raw_hid_send(data, length);
 }
@@ -13,3 +35,26 @@ __attribute__((weak)) void raw_hid_receive(uint8_t *data, uint8_t length) {
     // and implement this function there. Leave this as weak linkage
     // so users can opt to not handle data coming in.
 }
+
+void raw_hid_receive_quantum(uint8_t *data, uint8_t length) {
+#ifdef TASK_PROFILING_ENABLE
+    if (task_profiling_raw_hid_receive(data, length)) {
+        raw_hid_send(data, length);
+        return;
+    }
+#endif
+#ifdef LATENCY_TRACE_ENABLE
+    if (latency_trace_raw_hid_receive(data, length)) {
+        raw_hid_send(data, length);
+        return;
+    }
+#endif
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSACTION_STATS)
+    if (split_transaction_stats_raw_hid_receive(data, length)) {
+        raw_hid_send(data, length);
+        return;
+    }
+#endif
+
+    raw_hid_receive(data, length);
+}
@@ -20,6 +20,17 @@
  */
 void raw_hid_receive(uint8_t *data, uint8_t length);
 
+/**
+ * \brief Called by the protocol layer for every raw HID report received from the host.
+ *
+ * Answers requests meant for enabled core features such as task profiling, and passes
+ * everything else on to raw_hid_receive().
+ *
+ * \param data A pointer to the received data. Always 32 bytes in length.
+ * \param length The length of the buffer. Always 32.
+ */
+void raw_hid_receive_quantum(uint8_t *data, uint8_t length);
+
 /**
  * \brief Send an HID report.
  *
@@ -28,4 +39,22 @@ void raw_hid_receive(uint8_t *data, uint8_t length);
  */
 void raw_hid_send(uint8_t *data, uint8_t length);
 
+/**
+ * \brief Stores `value` little endian at `dst`, for building responses.
+ */
+static inline void raw_hid_write_u16(uint8_t *dst, uint16_t value) {
+    dst[0] = value & 0xFF;
+    dst[1] = value >> 8;
+}
+
+/**
+ * \brief Stores `value` little endian at `dst`, for building responses.
+ */
+static inline void raw_hid_write_u32(uint8_t *dst, uint32_t value) {
+    dst[0] = value & 0xFF;
+    dst[1] = (value >> 8) & 0xFF;
+    dst[2] = (value >> 16) & 0xFF;
+    dst[3] = (value >> 24) & 0xFF;
+}
+
 /** \} */
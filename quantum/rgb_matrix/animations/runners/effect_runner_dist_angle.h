@@ -0,0 +1,19 @@
+#pragma once
+
+typedef hsv_t (*dist_angle_f)(hsv_t hsv, uint8_t dist, uint8_t angle, uint8_t time);
+
+bool effect_runner_dist_angle(effect_params_t* params, dist_angle_f effect_func) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+
+    uint8_t time = scale16by8(g_rgb_timer, rgb_matrix_config.speed / 2);
+    for (uint8_t i = led_min; i < led_max; i++) {
+        RGB_MATRIX_TEST_LED_FLAGS();
+        int16_t dx    = rgb_matrix_led_dx(i);
+        int16_t dy    = rgb_matrix_led_dy(i);
+        uint8_t dist  = rgb_matrix_led_dist(i, dx, dy);
+        uint8_t angle = rgb_matrix_led_angle(i, dx, dy);
+        rgb_t   rgb   = rgb_matrix_hsv_to_rgb(effect_func(rgb_matrix_config.hsv, dist, angle, time));
+        rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+    }
+    return rgb_matrix_check_finished_leds(led_max);
+}
@@ -8,6 +8,15 @@ bool effect_runner_reactive(effect_params_t* params, reactive_f effect_func) {
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
 
     uint16_t max_tick = 65535 / qadd8(rgb_matrix_config.speed, 1);
+    bool     fading   = false;
+    for (uint8_t j = 0; j < g_last_hit_tracker.count; j++) {
+        fading |= g_last_hit_tracker.tick[j] < max_tick;
+    }
+    if (!fading) {
+        // Every LED is drawn with max_tick until the next key hit
+        rgb_matrix_set_frame_static();
+    }
+
     for (uint8_t i = led_min; i < led_max; i++) {
         RGB_MATRIX_TEST_LED_FLAGS();
         uint16_t tick = max_tick;
@@ -0,0 +1,40 @@
+#pragma once
+
+// Per-LED geometry for the runners. Reads the table generated from info.json when it is valid,
+// otherwise computes the same values from g_led_config.
+
+static inline int16_t rgb_matrix_led_dx(uint8_t i) {
+#ifdef RGB_MATRIX_LED_GEOMETRY_TABLE
+    if (g_rgb_matrix_led_geometry_valid) {
+        return (int16_t)pgm_read_word(&g_rgb_matrix_led_geometry[i].dx);
+    }
+#endif
+    return g_led_config.point[i].x - k_rgb_matrix_center.x;
+}
+
+static inline int16_t rgb_matrix_led_dy(uint8_t i) {
+#ifdef RGB_MATRIX_LED_GEOMETRY_TABLE
+    if (g_rgb_matrix_led_geometry_valid) {
+        return (int16_t)pgm_read_word(&g_rgb_matrix_led_geometry[i].dy);
+    }
+#endif
+    return g_led_config.point[i].y - k_rgb_matrix_center.y;
+}
+
+static inline uint8_t rgb_matrix_led_dist(uint8_t i, int16_t dx, int16_t dy) {
+#ifdef RGB_MATRIX_LED_GEOMETRY_TABLE
+    if (g_rgb_matrix_led_geometry_valid) {
+        return pgm_read_byte(&g_rgb_matrix_led_geometry[i].dist);
+    }
+#endif
+    return sqrt16(dx * dx + dy * dy);
+}
+
+static inline uint8_t rgb_matrix_led_angle(uint8_t i, int16_t dx, int16_t dy) {
+#ifdef RGB_MATRIX_LED_GEOMETRY_TABLE
+    if (g_rgb_matrix_led_geometry_valid) {
+        return pgm_read_byte(&g_rgb_matrix_led_geometry[i].angle);
+    }
+#endif
+    return atan2_8(dy, dx);
+}
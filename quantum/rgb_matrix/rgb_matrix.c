@@ -71,6 +71,11 @@ uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#ifdef RGB_MATRIX_LED_GEOMETRY_TABLE
+// Replaced by the generated table. All zeroes only validates if every LED is on the center, where it is also correct
+__attribute__((weak)) const led_geometry_t g_rgb_matrix_led_geometry[RGB_MATRIX_LED_COUNT] PROGMEM = {{0}};
+bool                                       g_rgb_matrix_led_geometry_valid                          = false;
+#endif // RGB_MATRIX_LED_GEOMETRY_TABLE
 
 // internals
 static bool            suspend_state     = false;
@@ -90,6 +95,22 @@ static last_hit_t last_hit_buffer;
 const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
 #endif
 
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+// What has been handed to the driver, and what it held at the last flush. An LED is dirty
+// while the two differ, so an LED that is overwritten and then restored within a frame
+// (e.g. by an indicator) does not cause a flush.
+static rgb_t    led_state[RGB_MATRIX_LED_COUNT];
+static rgb_t    led_flushed[RGB_MATRIX_LED_COUNT];
+static uint8_t  led_dirty[(RGB_MATRIX_LED_COUNT + 7) / 8];
+static bool     flush_all = false;
+static bool     drawing_indicators;
+static bool     indicators_drawn;
+static bool     frame_static_requested;
+static bool     frame_invalidated;
+static bool     frame_static = false;
+static uint64_t frame_static_config;
+#endif // RGB_MATRIX_DIRTY_TRACKING
+
 EECONFIG_DEBOUNCE_HELPER(rgb_matrix, rgb_matrix_config);
 
 void eeconfig_force_flush_rgb_matrix(void) {
@@ -159,11 +180,31 @@ __attribute__((weak)) int rgb_matrix_led_index(int index) {
 }
 
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+    if (drawing_indicators) {
+        indicators_drawn = true;
+    }
+    if (index >= 0 && index < RGB_MATRIX_LED_COUNT) {
+        rgb_t *led = &led_state[index];
+        // After an invalidation the driver may hold anything, so everything is passed on until the next flush
+        if (!flush_all && led->r == red && led->g == green && led->b == blue) {
+            return;
+        }
+        led->r = red;
+        led->g = green;
+        led->b = blue;
+        if (memcmp(led, &led_flushed[index], sizeof(rgb_t)) != 0) {
+            led_dirty[index / 8] |= 1 << (index % 8);
+        } else {
+            led_dirty[index / 8] &= ~(1 << (index % 8));
+        }
+    }
+#endif // RGB_MATRIX_DIRTY_TRACKING
     rgb_matrix_driver.set_color(rgb_matrix_led_index(index), red, green, blue);
 }
 
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
-#if defined(RGB_MATRIX_SPLIT)
+#if defined(RGB_MATRIX_SPLIT) || defined(RGB_MATRIX_DIRTY_TRACKING)
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
         rgb_matrix_set_color(i, red, green, blue);
 #else
@@ -171,11 +212,45 @@ void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 #endif
 }
 
+void rgb_matrix_set_frame_static(void) {
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+    frame_static_requested = true;
+#endif // RGB_MATRIX_DIRTY_TRACKING
+}
+
+void rgb_matrix_invalidate_frame(void) {
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+    flush_all         = true;
+    frame_invalidated = true;
+    frame_static      = false;
+#endif // RGB_MATRIX_DIRTY_TRACKING
+}
+
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+bool rgb_matrix_is_led_dirty(uint8_t index) {
+    return index < RGB_MATRIX_LED_COUNT && (flush_all || (led_dirty[index / 8] & (1 << (index % 8))));
+}
+
+static bool rgb_matrix_frame_dirty(void) {
+    for (uint8_t i = 0; i < sizeof(led_dirty); i++) {
+        if (led_dirty[i]) {
+            return true;
+        }
+    }
+    return flush_all;
+}
+#endif // RGB_MATRIX_DIRTY_TRACKING
+
 void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
 #ifndef RGB_MATRIX_SPLIT
     if (!is_keyboard_master()) return;
 #endif
 
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+    // Reactive effects only declare themselves static while no key hit is fading out
+    frame_invalidated = true;
+#endif // RGB_MATRIX_DIRTY_TRACKING
+
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     uint8_t led[LED_HITS_TO_REMEMBER];
     uint8_t led_count = 0;
@@ -283,6 +358,11 @@ static void rgb_task_start(void) {
     // reset iter
     rgb_effect_params.iter = 0;
 
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+    frame_static_requested = false;
+    indicators_drawn       = false;
+#endif // RGB_MATRIX_DIRTY_TRACKING
+
     // update double buffers
     g_rgb_timer = rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
@@ -301,6 +381,20 @@ static void rgb_task_render(uint8_t effect) {
         rgb_matrix_set_color_all(0, 0, 0);
     }
 
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+    // The previous frame is still in the driver buffer, so a static effect does not need to
+    // draw it again. Still walk through the iterations so advanced indicators see every LED.
+    if (frame_static && !frame_invalidated && !rgb_effect_params.init && effect != RGB_MATRIX_NONE && effect != UINT8_MAX && rgb_matrix_config.raw == frame_static_config) {
+        RGB_MATRIX_USE_LIMITS_ITER(led_min, led_max, rgb_effect_params.iter);
+        frame_static_requested = true;
+        rgb_effect_params.iter++;
+        if (!rgb_matrix_check_finished_leds(led_max)) {
+            rgb_task_state = FLUSHING;
+        }
+        return;
+    }
+#endif // RGB_MATRIX_DIRTY_TRACKING
+
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
     switch (effect) {
@@ -367,8 +461,22 @@ static void rgb_task_flush(uint8_t effect) {
     rgb_last_effect = effect;
     rgb_last_enable = rgb_matrix_config.enable;
 
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+    frame_static        = frame_static_requested && !indicators_drawn && !frame_invalidated;
+    frame_static_config = rgb_matrix_config.raw;
+    frame_invalidated   = false;
+
+    // nothing to send if no LED changed since the last flush
+    if (rgb_matrix_frame_dirty()) {
+        rgb_matrix_update_pwm_buffers();
+        memcpy(led_flushed, led_state, sizeof(led_flushed));
+        memset(led_dirty, 0, sizeof(led_dirty));
+        flush_all = false;
+    }
+#else
     // update pwm buffers
     rgb_matrix_update_pwm_buffers();
+#endif // RGB_MATRIX_DIRTY_TRACKING
 
     // next task
     rgb_task_state = SYNCING;
@@ -394,10 +502,16 @@ void rgb_matrix_task(void) {
         case RENDERING:
             rgb_task_render(effect);
             if (effect) {
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+                drawing_indicators = true;
+#endif // RGB_MATRIX_DIRTY_TRACKING
                 if (rgb_task_state == FLUSHING) { // ensure we only draw basic indicators once rendering is finished
                     rgb_matrix_indicators();
                 }
                 rgb_matrix_indicators_advanced(&rgb_effect_params);
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+                drawing_indicators = false;
+#endif // RGB_MATRIX_DIRTY_TRACKING
             }
             break;
         case FLUSHING:
@@ -477,8 +591,32 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
     return true;
 }
 
+#ifdef RGB_MATRIX_LED_GEOMETRY_TABLE
+// The table is generated from info.json, while g_led_config or the center may have been
+// overridden in code, so only trust it if it matches what the runners would compute
+static bool rgb_matrix_check_led_geometry(void) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        led_geometry_t geometry;
+        memcpy_P(&geometry, &g_rgb_matrix_led_geometry[i], sizeof(geometry));
+
+        int16_t dx = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy = g_led_config.point[i].y - k_rgb_matrix_center.y;
+        if (geometry.dx != dx || geometry.dy != dy || geometry.dist != sqrt16(dx * dx + dy * dy) || geometry.angle != atan2_8(dy, dx)) {
+            dprintf("rgb_matrix: LED %u does not match the geometry table, computing it at runtime\n", i);
+            return false;
+        }
+    }
+    return true;
+}
+#endif // RGB_MATRIX_LED_GEOMETRY_TABLE
+
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
+    rgb_matrix_invalidate_frame();
+
+#ifdef RGB_MATRIX_LED_GEOMETRY_TABLE
+    g_rgb_matrix_led_geometry_valid = rgb_matrix_check_led_geometry();
+#endif // RGB_MATRIX_LED_GEOMETRY_TABLE
 
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
@@ -24,6 +24,7 @@
 #include "rgb_matrix_drivers.h"
 #include "color.h"
 #include "keyboard.h"
+#include "progmem.h"
 
 #ifndef RGB_MATRIX_TIMEOUT
 #    define RGB_MATRIX_TIMEOUT 0
@@ -220,6 +221,18 @@ void        rgb_matrix_set_flags(led_flags_t flags);
 void        rgb_matrix_set_flags_noeeprom(led_flags_t flags);
 void        rgb_matrix_update_pwm_buffers(void);
 
+// Called by an effect while rendering to declare that its output will not change until it is
+// reinitialised, the config changes or a key is hit, so later frames can be skipped.
+// Only has an effect with RGB_MATRIX_DIRTY_TRACKING.
+void rgb_matrix_set_frame_static(void);
+// Forces the next frame to be rendered and every LED to be flushed, e.g. after writing to the
+// LED driver directly.
+void rgb_matrix_invalidate_frame(void);
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+// Whether the LED changed since the last flush; valid until the flush completes.
+bool rgb_matrix_is_led_dirty(uint8_t index);
+#endif
+
 #ifdef RGB_MATRIX_MODE_NAME_ENABLE
 const char *rgb_matrix_get_mode_name(uint8_t mode);
 #endif // RGB_MATRIX_MODE_NAME_ENABLE
@@ -284,6 +297,12 @@ extern rgb_config_t rgb_matrix_config;
 
 extern uint32_t     g_rgb_timer;
 extern led_config_t g_led_config;
+#ifdef RGB_MATRIX_LED_GEOMETRY_TABLE
+// Generated from info.json by `qmk generate-keyboard-c`. Only used if it matches g_led_config
+// and k_rgb_matrix_center at init, see g_rgb_matrix_led_geometry_valid.
+extern const led_geometry_t g_rgb_matrix_led_geometry[RGB_MATRIX_LED_COUNT] PROGMEM;
+extern bool                 g_rgb_matrix_led_geometry_valid;
+#endif
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 extern last_hit_t g_last_hit_tracker;
 #endif
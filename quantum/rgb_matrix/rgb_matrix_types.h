@@ -69,6 +69,14 @@ typedef struct PACKED {
 
 #define NO_LED 255
 
+// Position of an LED relative to the matrix center, as used by the effect runners
+typedef struct PACKED {
+    int16_t dx;
+    int16_t dy;
+    uint8_t dist;  // sqrt16(dx * dx + dy * dy)
+    uint8_t angle; // atan2_8(dy, dx)
+} led_geometry_t;
+
 typedef struct PACKED {
     uint8_t     matrix_co[MATRIX_ROWS][MATRIX_COLS];
     led_point_t point[RGB_MATRIX_LED_COUNT];
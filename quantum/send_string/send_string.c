@@ -23,6 +23,10 @@
 #include "keycode.h"
 #include "action.h"
 #include "wait.h"
+#ifdef SEND_STRING_NONBLOCKING
+#    include "host.h"
+#    include "timer.h"
+#endif
 
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
 #    include "audio.h"
@@ -146,11 +150,75 @@ __attribute__((weak)) const uint8_t ascii_to_keycode_lut[128] PROGMEM = {
 // Note: we bit-pack in "reverse" order to optimize loading
 #define PGM_LOADBIT(mem, pos) ((pgm_read_byte(&((mem)[(pos) / 8])) >> ((pos) % 8)) & 0x01)
 
+typedef struct send_string_action_t {
+    uint8_t  keycode;
+    bool     pressed;
+    uint16_t delay_ms; // how long to wait after the key event
+} send_string_action_t;
+
+// Shift, AltGr, the key itself and a space for dead keys, each pressed and released
+#define SEND_STRING_MAX_CHAR_ACTIONS 8
+
+// Works out the key events that type `ascii_code`, returning how many there are
+static uint8_t send_string_char_actions(char ascii_code, uint8_t interval, send_string_action_t *actions) {
+#if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    if (ascii_code == '\a') { // BEL
+        PLAY_SONG(bell_song);
+        return 0;
+    }
+#endif
+
+    uint8_t keycode    = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+    bool    is_shifted = PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code);
+    bool    is_altgred = PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code);
+    bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
+    uint8_t count      = 0;
+
+    if (is_shifted) {
+        actions[count++] = (send_string_action_t){KC_LEFT_SHIFT, true, interval};
+    }
+
+    if (is_altgred) {
+        actions[count++] = (send_string_action_t){KC_RIGHT_ALT, true, interval};
+    }
+
+    actions[count++] = (send_string_action_t){keycode, true, interval};
+    actions[count++] = (send_string_action_t){keycode, false, interval};
+
+    if (is_altgred) {
+        actions[count++] = (send_string_action_t){KC_RIGHT_ALT, false, interval};
+    }
+
+    if (is_shifted) {
+        actions[count++] = (send_string_action_t){KC_LEFT_SHIFT, false, interval};
+    }
+
+    if (is_dead) {
+        actions[count++] = (send_string_action_t){KC_SPACE, true, TAP_CODE_DELAY};
+        actions[count++] = (send_string_action_t){KC_SPACE, false, interval};
+    }
+
+    return count;
+}
+
+static inline void send_string_perform(const send_string_action_t *action) {
+    if (action->pressed) {
+        register_code(action->keycode);
+    } else {
+        unregister_code(action->keycode);
+    }
+}
+
 void send_string(const char *string) {
     send_string_with_delay(string, TAP_CODE_DELAY);
 }
 
 void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval) {
+#ifdef SEND_STRING_NONBLOCKING
+    // Anything already queued was asked for first
+    send_string_queue_flush();
+#endif
+
     while (1) {
         char ascii_code = getter(arg);
         if (!ascii_code) break;
@@ -214,44 +282,15 @@ void send_char(char ascii_code) {
 }
 
 void send_char_with_delay(char ascii_code, uint8_t interval) {
-#if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
-    if (ascii_code == '\a') { // BEL
-        PLAY_SONG(bell_song);
-        return;
-    }
+#ifdef SEND_STRING_NONBLOCKING
+    send_string_queue_flush();
 #endif
 
-    uint8_t keycode    = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
-    bool    is_shifted = PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code);
-    bool    is_altgred = PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code);
-    bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
-
-    if (is_shifted) {
-        register_code(KC_LEFT_SHIFT);
-        wait_ms(interval);
-    }
-
-    if (is_altgred) {
-        register_code(KC_RIGHT_ALT);
-        wait_ms(interval);
-    }
-
-    tap_code_delay(keycode, interval);
-    wait_ms(interval);
-
-    if (is_altgred) {
-        unregister_code(KC_RIGHT_ALT);
-        wait_ms(interval);
-    }
-
-    if (is_shifted) {
-        unregister_code(KC_LEFT_SHIFT);
-        wait_ms(interval);
-    }
-
-    if (is_dead) {
-        tap_code(KC_SPACE);
-        wait_ms(interval);
+    send_string_action_t actions[SEND_STRING_MAX_CHAR_ACTIONS];
+    uint8_t              count = send_string_char_actions(ascii_code, interval, actions);
+    for (uint8_t i = 0; i < count; ++i) {
+        send_string_perform(&actions[i]);
+        wait_ms(actions[i].delay_ms);
     }
 }
 
@@ -326,3 +365,195 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
     send_string_with_delay_impl(send_string_get_next_progmem, &state, interval);
 }
 #endif
+
+#ifdef SEND_STRING_NONBLOCKING
+
+#    ifndef SEND_STRING_QUEUE_SIZE
+#        define SEND_STRING_QUEUE_SIZE 256
+#    endif
+
+// Each queued string is stored as its interval, followed by its characters and the terminating NUL
+static uint8_t  send_string_queue[SEND_STRING_QUEUE_SIZE];
+static uint16_t send_string_queue_head  = 0;
+static uint16_t send_string_queue_count = 0;
+
+// The key events of whatever is currently being typed, and when the next one is due
+static send_string_action_t send_string_actions[SEND_STRING_MAX_CHAR_ACTIONS];
+static uint8_t              send_string_action_count = 0;
+static uint8_t              send_string_action_index = 0;
+static uint8_t              send_string_interval     = 0;
+static bool                 send_string_in_string    = false;
+static uint32_t             send_string_timer        = 0;
+static uint32_t             send_string_wait_ms      = 0;
+
+static bool send_string_queue_push(uint8_t byte) {
+    if (send_string_queue_count == SEND_STRING_QUEUE_SIZE) {
+        return false;
+    }
+    send_string_queue[(send_string_queue_head + send_string_queue_count) % SEND_STRING_QUEUE_SIZE] = byte;
+    ++send_string_queue_count;
+    return true;
+}
+
+static char send_string_queue_pop(void) {
+    if (send_string_queue_count == 0) {
+        return 0;
+    }
+    char ret               = send_string_queue[send_string_queue_head];
+    send_string_queue_head = (send_string_queue_head + 1) % SEND_STRING_QUEUE_SIZE;
+    --send_string_queue_count;
+    return ret;
+}
+
+static inline void send_string_add_action(uint8_t keycode, bool pressed, uint16_t delay_ms) {
+    send_string_actions[send_string_action_count++] = (send_string_action_t){keycode, pressed, delay_ms};
+}
+
+// Reads from the queue until it has the key events for the next character or keycode, following any delays on the way
+static void send_string_queue_expand(void) {
+    send_string_action_count = 0;
+    send_string_action_index = 0;
+
+    while (send_string_action_count == 0 && send_string_queue_count > 0) {
+        if (!send_string_in_string) {
+            send_string_interval  = send_string_queue_pop();
+            send_string_in_string = true;
+            continue;
+        }
+
+        char ascii_code = send_string_queue_pop();
+        if (!ascii_code) {
+            send_string_in_string = false;
+        } else if (ascii_code == SS_QMK_PREFIX) {
+            ascii_code = send_string_queue_pop();
+
+            if (ascii_code == SS_TAP_CODE) {
+                // tap
+                uint8_t keycode = send_string_queue_pop();
+                send_string_add_action(keycode, true, keycode == KC_CAPS_LOCK ? TAP_HOLD_CAPS_DELAY : TAP_CODE_DELAY);
+                send_string_add_action(keycode, false, send_string_interval);
+            } else if (ascii_code == SS_DOWN_CODE) {
+                // down
+                send_string_add_action(send_string_queue_pop(), true, send_string_interval);
+            } else if (ascii_code == SS_UP_CODE) {
+                // up
+                send_string_add_action(send_string_queue_pop(), false, send_string_interval);
+            } else if (ascii_code == SS_DELAY_CODE) {
+                // delay, counted from the end of the previous key event's own wait
+                uint32_t ms = 0;
+                ascii_code  = send_string_queue_pop();
+
+                while (isdigit(ascii_code)) {
+                    ms *= 10;
+                    ms += ascii_code - '0';
+                    ascii_code = send_string_queue_pop();
+                }
+
+                if (timer_elapsed32(send_string_timer) >= send_string_wait_ms) {
+                    send_string_timer   = timer_read32();
+                    send_string_wait_ms = 0;
+                }
+                send_string_wait_ms += ms + send_string_interval;
+
+                // if we had a delay that terminated with a null, we're done
+                if (ascii_code == 0) {
+                    send_string_in_string = false;
+                }
+            }
+        } else {
+            send_string_action_count = send_string_char_actions(ascii_code, send_string_interval, send_string_actions);
+        }
+    }
+}
+
+// Performs the next key event if it's due, optionally waiting for the host to be ready for it. Returns false if there
+// was nothing to do yet.
+static bool send_string_queue_step(bool wait_for_host) {
+    if (send_string_action_index == send_string_action_count) {
+        send_string_queue_expand();
+        if (send_string_action_count == 0) {
+            return false;
+        }
+    }
+
+    if (timer_elapsed32(send_string_timer) < send_string_wait_ms || (wait_for_host && !host_keyboard_ready())) {
+        return false;
+    }
+
+    const send_string_action_t *action = &send_string_actions[send_string_action_index++];
+    send_string_perform(action);
+    send_string_timer   = timer_read32();
+    send_string_wait_ms = action->delay_ms;
+    return true;
+}
+
+bool send_string_queued_impl(char (*getter)(void *), void *arg, uint8_t interval) {
+    // Either the whole string fits, or none of it is queued
+    uint16_t count = send_string_queue_count;
+    if (!send_string_queue_push(interval)) {
+        return false;
+    }
+
+    while (1) {
+        char ascii_code = getter(arg);
+        if (!send_string_queue_push(ascii_code)) {
+            send_string_queue_count = count;
+            return false;
+        }
+        if (!ascii_code) {
+            return true;
+        }
+    }
+}
+
+bool send_string_queued(const char *string) {
+    return send_string_queued_with_delay(string, TAP_CODE_DELAY);
+}
+
+bool send_string_queued_with_delay(const char *string, uint8_t interval) {
+    send_string_memory_state_t state = {string};
+    return send_string_queued_impl(send_string_get_next_ram, &state, interval);
+}
+
+#    if defined(__AVR__)
+bool send_string_queued_P(const char *string) {
+    return send_string_queued_with_delay_P(string, TAP_CODE_DELAY);
+}
+
+bool send_string_queued_with_delay_P(const char *string, uint8_t interval) {
+    send_string_memory_state_t state = {string};
+    return send_string_queued_impl(send_string_get_next_progmem, &state, interval);
+}
+#    endif
+
+bool send_string_queue_is_busy(void) {
+    return send_string_action_index < send_string_action_count || send_string_queue_count > 0;
+}
+
+void send_string_queue_flush(void) {
+    while (send_string_queue_is_busy()) {
+        if (!send_string_queue_step(false)) {
+            wait_ms(1);
+        }
+    }
+}
+
+void send_string_queue_clear(void) {
+    send_string_queue_count = 0;
+    send_string_in_string   = false;
+
+    // Let go of anything the current character still has held down
+    for (; send_string_action_index < send_string_action_count; ++send_string_action_index) {
+        if (!send_string_actions[send_string_action_index].pressed) {
+            unregister_code(send_string_actions[send_string_action_index].keycode);
+        }
+    }
+}
+
+void send_string_task(void) {
+    if (send_string_queue_is_busy()) {
+        send_string_queue_step(true);
+    }
+}
+
+#endif // SEND_STRING_NONBLOCKING
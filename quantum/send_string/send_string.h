@@ -24,6 +24,7 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "progmem.h"
 #include "send_string_keycodes.h"
@@ -169,4 +170,80 @@ void send_string_with_delay_P(const char *string, uint8_t interval);
  */
 void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval);
 
+#if defined(SEND_STRING_NONBLOCKING) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a string of ASCII characters to be typed out in the background.
+ *
+ * This function simply calls `send_string_queued_with_delay(string, TAP_CODE_DELAY)`.
+ *
+ * \param string The string to type out.
+ *
+ * \return `false` if there isn't enough space left in the queue, in which case nothing is queued.
+ */
+bool send_string_queued(const char *string);
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out in the background, with a delay between each key event.
+ *
+ * Rather than blocking until the whole string has been typed, the string is copied into a queue and typed out by
+ * `send_string_task()`, one key event at a time, as fast as the host takes keyboard reports. The matrix and everything
+ * else carries on being scanned in the meantime.
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait after each key event.
+ *
+ * \return `false` if there isn't enough space left in the queue, in which case nothing is queued.
+ */
+bool send_string_queued_with_delay(const char *string, uint8_t interval);
+
+#    if defined(__AVR__) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a string of ASCII characters from PROGMEM to be typed out in the background.
+ *
+ * On ARM devices, this function is simply an alias for `send_string_queued_with_delay(string, 0)`.
+ */
+bool send_string_queued_P(const char *string);
+
+/**
+ * \brief Queue a string of ASCII characters from PROGMEM to be typed out in the background, with a delay between each key event.
+ *
+ * On ARM devices, this function is simply an alias for `send_string_queued_with_delay(string, interval)`.
+ */
+bool send_string_queued_with_delay_P(const char *string, uint8_t interval);
+#    else
+#        define send_string_queued_P(string) send_string_queued_with_delay(string, 0)
+#        define send_string_queued_with_delay_P(string, interval) send_string_queued_with_delay(string, interval)
+#    endif
+
+/**
+ * \brief Shortcut macro for send_string_queued_with_delay_P(PSTR(string), 0).
+ */
+#    define SEND_STRING_QUEUED(string) send_string_queued_with_delay_P(PSTR(string), 0)
+
+/**
+ * \brief Queues the string returned by the getter function, see `send_string_with_delay_impl()`.
+ */
+bool send_string_queued_impl(char (*getter)(void *), void *arg, uint8_t interval);
+
+/**
+ * \brief Whether there is anything left to type out from the queue.
+ */
+bool send_string_queue_is_busy(void);
+
+/**
+ * \brief Types out everything left in the queue before returning, like the blocking functions above.
+ */
+void send_string_queue_flush(void);
+
+/**
+ * \brief Drops everything left in the queue, releasing any keys it is holding down.
+ */
+void send_string_queue_clear(void);
+
+/**
+ * \brief Types the next key event from the queue, once the host has taken the previous report. Called from the main loop.
+ */
+void send_string_task(void);
+#endif
+
 /** \} */
@@ -8,3 +8,8 @@
 #        define F_SCL 100000UL // SCL frequency
 #    endif
 #endif
+
+// The asynchronous transport exchanges a single batch per scan.
+#if defined(SPLIT_TRANSPORT_ASYNC) && !defined(SPLIT_TRANSACTION_BATCHING)
+#    define SPLIT_TRANSACTION_BATCHING
+#endif
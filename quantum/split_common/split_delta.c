@@ -0,0 +1,129 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "split_delta.h"
+#include <string.h>
+#include "crc.h"
+#include "compiler_support.h"
+
+STATIC_ASSERT(SPLIT_DELTA_HEADER_SIZE + SPLIT_DELTA_BUFFER_SIZE <= UINT8_MAX, "SPLIT_DELTA_BUFFER_SIZE must be at most 252");
+
+uint8_t split_delta_next_seq(uint8_t seq) {
+    seq++;
+    return seq == 0 ? 1 : seq;
+}
+
+// Returns the length of the runs written to `out`, or -1 if they need more than `limit` bytes
+static int16_t encode_runs(uint8_t *out, uint8_t limit, const uint8_t *baseline, const uint8_t *current, uint8_t size) {
+    uint8_t length = 0;
+    uint8_t pos    = 0;
+    while (pos < size) {
+        uint8_t skip = 0;
+        while (pos < size && baseline[pos] == current[pos] && skip < UINT8_MAX) {
+            pos++;
+            skip++;
+        }
+        if (pos == size) {
+            // Trailing unchanged bytes don't need a run
+            break;
+        }
+
+        uint8_t count = 0;
+        if (baseline[pos] != current[pos]) {
+            // Carry the run over single unchanged bytes, starting a new run would cost more
+            uint8_t last = pos;
+            for (uint8_t i = pos; i < size && i - last <= 2 && i - pos < UINT8_MAX; i++) {
+                if (baseline[i] != current[i]) {
+                    last = i;
+                }
+            }
+            count = last - pos + 1;
+        }
+
+        if (length + 2 + count > limit) {
+            return -1;
+        }
+        out[length++] = skip;
+        out[length++] = count;
+        for (uint8_t i = 0; i < count; i++, pos++) {
+            out[length++] = baseline[pos] ^ current[pos];
+        }
+    }
+    return length;
+}
+
+void split_delta_encode(split_delta_frame_t *frame, const void *baseline, const void *current, uint8_t size, uint8_t base, uint8_t seq) {
+    int16_t length = -1;
+    if (baseline != NULL && base != 0 && size > 0) {
+        // Only worth it when smaller than a full copy
+        length = encode_runs(frame->data, size - 1 < sizeof(frame->data) ? size - 1 : sizeof(frame->data), baseline, current, size);
+    }
+    if (length < 0) {
+        base   = 0;
+        length = size;
+        memcpy(frame->data, current, size);
+    }
+
+    frame->seq      = seq;
+    frame->base     = base;
+    frame->checksum = crc8(current, size);
+    frame->length   = SPLIT_DELTA_HEADER_SIZE + length;
+}
+
+static bool runs_valid(const uint8_t *runs, uint8_t length, uint8_t size) {
+    uint16_t pos = 0;
+    for (uint8_t i = 0; i < length;) {
+        if (length - i < 2) {
+            return false;
+        }
+        uint8_t skip  = runs[i++];
+        uint8_t count = runs[i++];
+        if (length - i < count || pos + skip + count > size) {
+            return false;
+        }
+        pos += skip + count;
+        i += count;
+    }
+    return true;
+}
+
+static void xor_runs(uint8_t *state, const uint8_t *runs, uint8_t length) {
+    uint8_t pos = 0;
+    for (uint8_t i = 0; i < length;) {
+        pos += runs[i++];
+        for (uint8_t count = runs[i++]; count > 0; count--) {
+            state[pos++] ^= runs[i++];
+        }
+    }
+}
+
+bool split_delta_apply(const split_delta_frame_t *frame, void *state, uint8_t size, uint8_t *seq) {
+    if (frame->length < SPLIT_DELTA_HEADER_SIZE || frame->length > SPLIT_DELTA_HEADER_SIZE + sizeof(frame->data)) {
+        *seq = 0;
+        return false;
+    }
+    uint8_t length = frame->length - SPLIT_DELTA_HEADER_SIZE;
+
+    if (frame->base == 0) {
+        if (length != size || crc8(frame->data, size) != frame->checksum) {
+            *seq = 0;
+            return false;
+        }
+        memcpy(state, frame->data, size);
+    } else {
+        if (frame->base != *seq || !runs_valid(frame->data, length, size)) {
+            *seq = 0;
+            return false;
+        }
+        xor_runs(state, frame->data, length);
+        if (crc8(state, size) != frame->checksum) {
+            // XOR is its own inverse, so applying the runs again restores the state
+            xor_runs(state, frame->data, length);
+            *seq = 0;
+            return false;
+        }
+    }
+
+    *seq = frame->seq;
+    return true;
+}
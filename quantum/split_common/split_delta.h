@@ -0,0 +1,54 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Delta encoding of synced state, enabled with `SPLIT_TRANSACTION_DELTA`.
+
+    A frame either holds a full copy of the state, or the XOR of the bytes that changed since
+    the state the receiver already has. The changed bytes are stored as runs of
+    [unchanged bytes to skip, changed byte count, XORed bytes...].
+
+    Every state carries a sequence number. A delta names the sequence number it applies on top
+    of, so a receiver that missed a frame rejects the following deltas until it gets a full
+    copy again. Sequence number 0 means "no state".
+*/
+
+#ifndef SPLIT_DELTA_BUFFER_SIZE
+#    define SPLIT_DELTA_BUFFER_SIZE 32
+#endif // SPLIT_DELTA_BUFFER_SIZE
+
+// seq, base and checksum
+#define SPLIT_DELTA_HEADER_SIZE 3
+
+typedef struct _split_delta_frame_t {
+    uint8_t length;   // number of valid bytes following this one
+    uint8_t seq;      // sequence number of the state after applying the frame
+    uint8_t base;     // sequence number the delta applies on top of, 0 for a full copy
+    uint8_t checksum; // crc8 of the state after applying the frame
+    uint8_t data[SPLIT_DELTA_BUFFER_SIZE];
+} split_delta_frame_t;
+
+/** @brief Returns the sequence number following `seq`, skipping 0. */
+uint8_t split_delta_next_seq(uint8_t seq);
+
+/**
+ * @brief Encodes `current` into `frame` as sequence number `seq`.
+ *
+ * The frame is a delta against `baseline`, the state the receiver has as sequence number
+ * `base`. A full copy is encoded instead when `baseline` is NULL, `base` is 0, or the delta
+ * would not be smaller. `size` must not exceed SPLIT_DELTA_BUFFER_SIZE.
+ */
+void split_delta_encode(split_delta_frame_t *frame, const void *baseline, const void *current, uint8_t size, uint8_t base, uint8_t seq);
+
+/**
+ * @brief Applies `frame` to `state`, whose sequence number is `*seq`.
+ *
+ * Returns false, leaving `state` untouched and resetting `*seq` to 0, if the frame is malformed,
+ * doesn't apply on top of `*seq`, or doesn't produce the expected checksum.
+ */
+bool split_delta_apply(const split_delta_frame_t *frame, void *state, uint8_t size, uint8_t *seq);
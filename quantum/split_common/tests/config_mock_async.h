@@ -0,0 +1,9 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "config_mock.h"
+
+#define SPLIT_TRANSACTION_BATCHING
+#define SPLIT_TRANSPORT_ASYNC
@@ -0,0 +1,13 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "config_mock.h"
+
+#define SPLIT_TRANSACTION_STATS
+#define SPLIT_TRANSACTION_ADAPTIVE_SYNC
+
+// A low priority sync for the adaptive scheduler to hold back
+#define WPM_ENABLE
+#define SPLIT_WPM_ENABLE
@@ -0,0 +1,54 @@
+split_delta_DEFS := -DNO_DEBUG -DNO_PRINT
+split_delta_INC := $(QUANTUM_PATH)/split_common
+split_delta_SRC := \
+	$(QUANTUM_PATH)/crc.c \
+	$(QUANTUM_PATH)/split_common/split_delta.c \
+	$(QUANTUM_PATH)/split_common/tests/split_delta_tests.cpp
+
+split_transactions_common_DEFS := -DSPLIT_KEYBOARD -DNO_DEBUG -DNO_PRINT
+split_transactions_common_INC := $(QUANTUM_PATH)/split_common
+
+split_transactions_common_SRC := \
+	platforms/timer.c \
+	platforms/test/timer.c \
+	$(QUANTUM_PATH)/sync_timer.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(QUANTUM_PATH)/split_common/split_delta.c \
+	$(QUANTUM_PATH)/split_common/transport.c \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/tests/split_loopback.c
+
+split_transactions_DEFS := $(split_transactions_common_DEFS)
+split_transactions_INC := $(split_transactions_common_INC)
+split_transactions_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_mock.h
+split_transactions_SRC := $(split_transactions_common_SRC) $(QUANTUM_PATH)/split_common/tests/split_transactions_tests.cpp
+
+split_transactions_batching_DEFS := $(split_transactions_common_DEFS)
+split_transactions_batching_INC := $(split_transactions_common_INC)
+split_transactions_batching_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_mock_batching.h
+split_transactions_batching_SRC := $(split_transactions_common_SRC) $(QUANTUM_PATH)/split_common/tests/split_transactions_tests.cpp
+
+split_transactions_async_DEFS := $(split_transactions_common_DEFS)
+split_transactions_async_INC := $(split_transactions_common_INC)
+split_transactions_async_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_mock_async.h
+split_transactions_async_SRC := $(split_transactions_common_SRC) $(QUANTUM_PATH)/split_common/tests/split_async_tests.cpp
+
+split_transactions_delta_DEFS := $(split_transactions_common_DEFS)
+split_transactions_delta_INC := $(split_transactions_common_INC)
+split_transactions_delta_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_mock_delta.h
+split_transactions_delta_SRC := $(split_transactions_common_SRC) $(QUANTUM_PATH)/split_common/tests/split_transactions_tests.cpp
+
+split_transactions_delta_batching_DEFS := $(split_transactions_common_DEFS)
+split_transactions_delta_batching_INC := $(split_transactions_common_INC)
+split_transactions_delta_batching_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_mock_delta_batching.h
+split_transactions_delta_batching_SRC := $(split_transactions_common_SRC) $(QUANTUM_PATH)/split_common/tests/split_transactions_tests.cpp
+
+split_transactions_stats_DEFS := $(split_transactions_common_DEFS)
+split_transactions_stats_INC := $(split_transactions_common_INC)
+split_transactions_stats_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_mock_stats.h
+split_transactions_stats_SRC := $(split_transactions_common_SRC) $(QUANTUM_PATH)/split_common/tests/split_stats_tests.cpp
+
+split_transactions_async_stats_DEFS := $(split_transactions_common_DEFS)
+split_transactions_async_stats_INC := $(split_transactions_common_INC)
+split_transactions_async_stats_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_mock_async_stats.h
+split_transactions_async_stats_SRC := $(split_transactions_common_SRC) $(QUANTUM_PATH)/split_common/tests/split_async_stats_tests.cpp
@@ -0,0 +1,103 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "transactions.h"
+#include "split_loopback.h"
+}
+
+extern "C" {
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+#define HALF_ROWS ((MATRIX_ROWS) / 2)
+
+class SplitAsyncStats : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        split_loopback_reset();
+        split_loopback_master_wpm = 0;
+        split_loopback_slave_wpm  = 0;
+        memset(master_rows, 0, sizeof(master_rows));
+        memset(slave_rows, 0, sizeof(slave_rows));
+        memset(mirrored_master_rows, 0, sizeof(mirrored_master_rows));
+        // Clean batches let any back off left over from a previous test wind down
+        for (int i = 0; i < 10; i++) {
+            scan();
+        }
+        split_transaction_stats_reset();
+    }
+
+    bool scan(void) {
+        split_loopback_slave_task(mirrored_master_rows, slave_rows);
+        memset(received_slave_rows, 0, sizeof(received_slave_rows));
+        return transactions_master(master_rows, received_slave_rows);
+    }
+
+    matrix_row_t master_rows[HALF_ROWS];
+    matrix_row_t mirrored_master_rows[HALF_ROWS];
+    matrix_row_t slave_rows[HALF_ROWS];
+    matrix_row_t received_slave_rows[HALF_ROWS];
+};
+
+TEST_F(SplitAsyncStats, BatchIsTimedFromSubmission) {
+    split_loopback_set_round_trip_time(100);
+    split_loopback_set_latency(3);
+    scan();
+    for (int i = 0; i < 4; i++) {
+        scan();
+    }
+
+    // Two batches complete, each after three pending scans. The scans in between don't add to
+    // their round trips: both took 100us, 3 bits long once shifted right by 4.
+    const split_transaction_stats_t *batch = split_transaction_get_stats(CMD_BATCH);
+    EXPECT_EQ(batch->attempts, 2);
+    EXPECT_EQ(batch->failures, 0);
+    EXPECT_EQ(batch->rtt_histogram[3], 2);
+}
+
+TEST_F(SplitAsyncStats, PendingScansDontWindDownBackOff) {
+    // The batch in flight from SetUp() completes over the default 2ms budget
+    split_loopback_set_round_trip_time(3000);
+    EXPECT_TRUE(scan());
+
+    // Every batch now stays in flight for 3 scans. Only the 3 batches that complete count as
+    // clean syncs, which is not enough to wind down the back off without time passing.
+    split_loopback_set_round_trip_time(100);
+    split_loopback_set_latency(3);
+    split_loopback_master_wpm = 50;
+    for (int i = 0; i < 12; i++) {
+        EXPECT_TRUE(scan());
+    }
+    EXPECT_EQ(split_loopback_slave_wpm, 0);
+
+    advance_time(8);
+    for (int i = 0; i < 8; i++) {
+        EXPECT_TRUE(scan());
+    }
+    EXPECT_EQ(split_loopback_slave_wpm, 50);
+}
+
+TEST_F(SplitAsyncStats, FailedBatchesHoldBackLowPrioritySyncs) {
+    split_loopback_set_connected(false);
+    EXPECT_FALSE(scan());
+    EXPECT_FALSE(scan());
+    split_loopback_set_connected(true);
+
+    split_loopback_master_wpm = 50;
+    for (int i = 0; i < 2; i++) {
+        EXPECT_TRUE(scan());
+    }
+    EXPECT_EQ(split_loopback_slave_wpm, 0);
+    EXPECT_GT(split_transaction_get_stats(CMD_BATCH)->failures, 0);
+
+    advance_time(16);
+    for (int i = 0; i < 4; i++) {
+        EXPECT_TRUE(scan());
+    }
+    EXPECT_EQ(split_loopback_slave_wpm, 50);
+}
@@ -0,0 +1,119 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "transactions.h"
+#include "split_loopback.h"
+}
+
+extern "C" {
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+#define HALF_ROWS ((MATRIX_ROWS) / 2)
+
+class SplitAsync : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        split_loopback_reset();
+        split_loopback_master_led_state = 0;
+        split_loopback_slave_led_state  = 0;
+        memset(master_rows, 0, sizeof(master_rows));
+        memset(slave_rows, 0, sizeof(slave_rows));
+        memset(mirrored_master_rows, 0, sizeof(mirrored_master_rows));
+        // Start from a completed exchange, with nothing in flight
+        scan();
+        scan();
+        split_loopback_stats = (split_loopback_stats_t){0};
+    }
+
+    // One scan on each half. Like matrix_post_scan(), the master starts every scan with an
+    // empty slave matrix.
+    bool scan(void) {
+        split_loopback_slave_task(mirrored_master_rows, slave_rows);
+        memset(received_slave_rows, 0, sizeof(received_slave_rows));
+        return transactions_master(master_rows, received_slave_rows);
+    }
+
+    matrix_row_t master_rows[HALF_ROWS];
+    matrix_row_t mirrored_master_rows[HALF_ROWS];
+    matrix_row_t slave_rows[HALF_ROWS];
+    matrix_row_t received_slave_rows[HALF_ROWS];
+};
+
+TEST_F(SplitAsync, ScanDoesNotWaitForTheSlave) {
+    split_loopback_set_latency(3);
+    EXPECT_TRUE(scan());
+    slave_rows[0] = 0x01;
+
+    // The batch submitted by the scan above is still in flight
+    for (int i = 0; i < 3; i++) {
+        EXPECT_TRUE(scan());
+        EXPECT_EQ(split_loopback_stats.transactions, 1);
+        EXPECT_EQ(received_slave_rows[0], 0x00);
+    }
+
+    // It completes, and the next one picks up the new slave matrix
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(split_loopback_stats.transactions, 2);
+    for (int i = 0; i < 4 && received_slave_rows[0] == 0x00; i++) {
+        EXPECT_TRUE(scan());
+    }
+    EXPECT_EQ(received_slave_rows[0], 0x01);
+}
+
+TEST_F(SplitAsync, LastSlaveMatrixIsKeptWhilePending) {
+    slave_rows[2] = 0x42;
+    scan();
+    scan();
+    EXPECT_EQ(received_slave_rows[2], 0x42);
+
+    split_loopback_set_latency(2);
+    scan();
+    for (int i = 0; i < 2; i++) {
+        EXPECT_TRUE(scan());
+        EXPECT_EQ(received_slave_rows[2], 0x42);
+    }
+}
+
+TEST_F(SplitAsync, OneExchangePerScan) {
+    master_rows[1]                  = 0x20;
+    split_loopback_master_led_state = 0x02;
+    EXPECT_TRUE(scan());
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(split_loopback_stats.transactions, 2);
+    split_loopback_slave_task(mirrored_master_rows, slave_rows);
+    EXPECT_EQ(mirrored_master_rows[1], 0x20);
+    EXPECT_EQ(split_loopback_slave_led_state, 0x02);
+}
+
+TEST_F(SplitAsync, FailureIsReportedByTheNextScan) {
+    // The exchange happens when the batch completes, so the one already in flight fails too
+    split_loopback_set_connected(false);
+    EXPECT_FALSE(scan());
+    EXPECT_FALSE(scan());
+
+    split_loopback_set_connected(true);
+    slave_rows[0] = 0x08;
+    EXPECT_TRUE(scan());
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(received_slave_rows[0], 0x08);
+}
+
+TEST_F(SplitAsync, BlockingTransactionWaitsForPending) {
+    split_loopback_set_latency(5);
+    scan();
+    EXPECT_EQ(split_loopback_stats.transactions, 1);
+
+    uint8_t led_state = 0x04;
+    EXPECT_TRUE(transport_execute_transaction(PUT_LED_STATE, &led_state, sizeof(led_state), NULL, 0));
+    // The batch in flight went first
+    EXPECT_EQ(split_loopback_stats.transactions, 3);
+    EXPECT_EQ(split_loopback_slave_led_state, 0x00);
+    split_loopback_slave_task(mirrored_master_rows, slave_rows);
+    EXPECT_EQ(split_loopback_slave_led_state, 0x04);
+}
@@ -0,0 +1,129 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <string.h>
+
+extern "C" {
+#include "split_delta.h"
+}
+
+class SplitDelta : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        memset(baseline, 0, sizeof(baseline));
+        memset(current, 0, sizeof(current));
+        memset(&frame, 0, sizeof(frame));
+    }
+
+    uint8_t             baseline[16];
+    uint8_t             current[16];
+    split_delta_frame_t frame;
+};
+
+TEST_F(SplitDelta, FullCopyWithoutBaseline) {
+    current[5] = 0x55;
+    split_delta_encode(&frame, NULL, current, sizeof(current), 0, 1);
+    EXPECT_EQ(frame.base, 0);
+    EXPECT_EQ(frame.length, SPLIT_DELTA_HEADER_SIZE + sizeof(current));
+
+    uint8_t state[16] = {0};
+    uint8_t seq       = 0;
+    EXPECT_TRUE(split_delta_apply(&frame, state, sizeof(state), &seq));
+    EXPECT_EQ(seq, 1);
+    EXPECT_EQ(memcmp(state, current, sizeof(state)), 0);
+}
+
+TEST_F(SplitDelta, DeltaOnlyCarriesChangedBytes) {
+    memcpy(current, baseline, sizeof(current));
+    current[9] = 0x80;
+    split_delta_encode(&frame, baseline, current, sizeof(current), 3, 4);
+    EXPECT_EQ(frame.base, 3);
+    // One run: skip, count and the changed byte
+    EXPECT_EQ(frame.length, SPLIT_DELTA_HEADER_SIZE + 3);
+
+    uint8_t state[16];
+    memcpy(state, baseline, sizeof(state));
+    uint8_t seq = 3;
+    EXPECT_TRUE(split_delta_apply(&frame, state, sizeof(state), &seq));
+    EXPECT_EQ(seq, 4);
+    EXPECT_EQ(memcmp(state, current, sizeof(state)), 0);
+}
+
+TEST_F(SplitDelta, CloseChangesShareARun) {
+    current[2]  = 0x01;
+    current[4]  = 0x02;
+    current[12] = 0x03;
+    split_delta_encode(&frame, baseline, current, sizeof(current), 1, 2);
+    // [2, 3, x, 0, x] and [7, 1, x]
+    EXPECT_EQ(frame.length, SPLIT_DELTA_HEADER_SIZE + 5 + 3);
+
+    uint8_t state[16] = {0};
+    uint8_t seq       = 1;
+    EXPECT_TRUE(split_delta_apply(&frame, state, sizeof(state), &seq));
+    EXPECT_EQ(memcmp(state, current, sizeof(state)), 0);
+}
+
+TEST_F(SplitDelta, UnchangedStateIsEmptyDelta) {
+    baseline[0] = current[0] = 0x11;
+    split_delta_encode(&frame, baseline, current, sizeof(current), 7, 7);
+    EXPECT_EQ(frame.length, SPLIT_DELTA_HEADER_SIZE);
+
+    uint8_t state[16];
+    memcpy(state, baseline, sizeof(state));
+    uint8_t seq = 7;
+    EXPECT_TRUE(split_delta_apply(&frame, state, sizeof(state), &seq));
+    EXPECT_EQ(seq, 7);
+}
+
+TEST_F(SplitDelta, LargeChangeFallsBackToFullCopy) {
+    for (uint8_t i = 0; i < sizeof(current); i += 2) {
+        current[i] = i + 1;
+    }
+    split_delta_encode(&frame, baseline, current, sizeof(current), 1, 2);
+    EXPECT_EQ(frame.base, 0);
+    EXPECT_EQ(frame.length, SPLIT_DELTA_HEADER_SIZE + sizeof(current));
+}
+
+TEST_F(SplitDelta, ApplyRejectsWrongBase) {
+    current[0] = 0x01;
+    split_delta_encode(&frame, baseline, current, sizeof(current), 5, 6);
+
+    uint8_t state[16] = {0};
+    uint8_t seq       = 4;
+    EXPECT_FALSE(split_delta_apply(&frame, state, sizeof(state), &seq));
+    EXPECT_EQ(seq, 0);
+    EXPECT_EQ(state[0], 0x00);
+}
+
+TEST_F(SplitDelta, ApplyRejectsDivergedState) {
+    current[0] = 0x01;
+    split_delta_encode(&frame, baseline, current, sizeof(current), 5, 6);
+
+    // Same sequence number, different contents
+    uint8_t state[16] = {0};
+    state[8]          = 0xFF;
+    uint8_t seq       = 5;
+    EXPECT_FALSE(split_delta_apply(&frame, state, sizeof(state), &seq));
+    EXPECT_EQ(seq, 0);
+    EXPECT_EQ(state[0], 0x00);
+    EXPECT_EQ(state[8], 0xFF);
+}
+
+TEST_F(SplitDelta, ApplyRejectsMalformedRuns) {
+    current[15] = 0x01;
+    split_delta_encode(&frame, baseline, current, sizeof(current), 1, 2);
+    // Skip past the end of the state
+    frame.data[0] = 20;
+
+    uint8_t state[16] = {0};
+    uint8_t seq       = 1;
+    EXPECT_FALSE(split_delta_apply(&frame, state, sizeof(state), &seq));
+    EXPECT_EQ(seq, 0);
+}
+
+TEST_F(SplitDelta, SequenceSkipsZero) {
+    EXPECT_EQ(split_delta_next_seq(0), 1);
+    EXPECT_EQ(split_delta_next_seq(1), 2);
+    EXPECT_EQ(split_delta_next_seq(255), 1);
+}
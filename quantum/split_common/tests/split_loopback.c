@@ -0,0 +1,172 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "split_loopback.h"
+#include <string.h>
+
+#include "serial.h"
+#include "split_util.h"
+#include "transactions.h"
+#include "transport.h"
+#include "action_layer.h"
+#include "keyboard.h"
+
+split_loopback_stats_t split_loopback_stats;
+uint8_t                split_loopback_slave_led_state  = 0;
+uint8_t                split_loopback_master_led_state = 0;
+#ifdef WPM_ENABLE
+uint8_t split_loopback_master_wpm = 0;
+uint8_t split_loopback_slave_wpm  = 0;
+#endif // WPM_ENABLE
+
+static split_shared_memory_t slave_memory;
+static bool                  connected     = true;
+static bool                  in_slave_half = false;
+static bool                  drop_replies  = false;
+static uint32_t              round_trip_us = 0;
+#ifdef SPLIT_TRANSPORT_ASYNC
+static uint8_t                          latency      = 0;
+static uint8_t                          async_polls  = 0;
+static int                              async_index  = 0;
+static soft_serial_transaction_status_t async_status = SOFT_SERIAL_TRANSACTION_FAILED;
+#endif // SPLIT_TRANSPORT_ASYNC
+
+void advance_time_us(uint32_t us);
+
+layer_state_t layer_state         = 0;
+layer_state_t default_layer_state = 0;
+
+// Exchanges the contents of split_shmem with the slave half's shared memory
+static void swap_halves(void) {
+    static split_shared_memory_t temp;
+    memcpy(&temp, split_shmem, sizeof(temp));
+    memcpy(split_shmem, &slave_memory, sizeof(temp));
+    memcpy(&slave_memory, &temp, sizeof(temp));
+    in_slave_half = !in_slave_half;
+}
+
+void split_loopback_set_connected(bool value) {
+    connected = value;
+}
+
+void split_loopback_set_drop_replies(bool value) {
+    drop_replies = value;
+}
+
+void split_loopback_set_round_trip_time(uint32_t us) {
+    round_trip_us = us;
+}
+
+#ifdef SPLIT_TRANSPORT_ASYNC
+void split_loopback_set_latency(uint8_t polls) {
+    latency = polls;
+}
+#endif // SPLIT_TRANSPORT_ASYNC
+
+void split_loopback_reset(void) {
+#ifdef SPLIT_TRANSPORT_ASYNC
+    // Don't leave a transaction of the previous test in flight
+    latency = 0;
+    transport_wait_transaction();
+#endif // SPLIT_TRANSPORT_ASYNC
+    memset(&slave_memory, 0, sizeof(slave_memory));
+    memset(split_shmem, 0, sizeof(split_shared_memory_t));
+    memset(&split_loopback_stats, 0, sizeof(split_loopback_stats));
+    connected     = true;
+    drop_replies  = false;
+    round_trip_us = 0;
+}
+
+void split_loopback_slave_task(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    swap_halves();
+    transactions_slave(master_matrix, slave_matrix);
+    swap_halves();
+}
+
+void soft_serial_initiator_init(void) {}
+
+void soft_serial_target_init(void) {}
+
+bool soft_serial_transaction(int index) {
+    split_transaction_desc_t *trans = &split_transaction_table[index];
+
+    split_loopback_stats.transactions++;
+    advance_time_us(round_trip_us);
+    if (!connected) {
+        return false;
+    }
+
+    // Initiator to target
+    uint8_t *source = split_trans_initiator2target_buffer(trans);
+    split_loopback_stats.bytes += 1 + split_trans_initiator2target_length(trans);
+    memcpy(((uint8_t *)&slave_memory) + trans->initiator2target_offset, source, trans->initiator2target_buffer_size);
+
+    swap_halves();
+    if (trans->slave_callback) {
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+    }
+    swap_halves();
+    if (drop_replies) {
+        return false;
+    }
+
+    // Target to initiator
+    source = ((uint8_t *)&slave_memory) + trans->target2initiator_offset;
+    memcpy(split_trans_target2initiator_buffer(trans), source, trans->target2initiator_buffer_size);
+    split_loopback_stats.bytes += 1 + split_trans_target2initiator_length(trans);
+    return true;
+}
+
+#ifdef SPLIT_TRANSPORT_ASYNC
+bool soft_serial_transaction_start(int index) {
+    if (async_status == SOFT_SERIAL_TRANSACTION_PENDING) {
+        return false;
+    }
+    async_index  = index;
+    async_polls  = latency;
+    async_status = SOFT_SERIAL_TRANSACTION_PENDING;
+    return true;
+}
+
+// The whole exchange happens on the poll that ends the simulated latency
+soft_serial_transaction_status_t soft_serial_transaction_poll(void) {
+    if (async_status == SOFT_SERIAL_TRANSACTION_PENDING) {
+        if (async_polls > 0) {
+            async_polls--;
+        } else {
+            async_status = soft_serial_transaction(async_index) ? SOFT_SERIAL_TRANSACTION_SUCCESS : SOFT_SERIAL_TRANSACTION_FAILED;
+        }
+    }
+    return async_status;
+}
+#endif // SPLIT_TRANSPORT_ASYNC
+
+bool is_keyboard_master(void) {
+    return !in_slave_half;
+}
+
+bool is_transport_connected(void) {
+    return connected;
+}
+
+uint8_t host_keyboard_leds(void) {
+    return split_loopback_master_led_state;
+}
+
+void set_split_host_keyboard_leds(uint8_t led_state) {
+    split_loopback_slave_led_state = led_state;
+}
+
+#ifdef WPM_ENABLE
+uint8_t get_current_wpm(void) {
+    return in_slave_half ? split_loopback_slave_wpm : split_loopback_master_wpm;
+}
+
+void set_current_wpm(uint8_t wpm) {
+    if (in_slave_half) {
+        split_loopback_slave_wpm = wpm;
+    } else {
+        split_loopback_master_wpm = wpm;
+    }
+}
+#endif // WPM_ENABLE
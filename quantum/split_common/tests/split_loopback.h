@@ -0,0 +1,54 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "matrix.h"
+
+/*
+    In-process stand-in for the serial transport. Transactions are carried out against a second
+    copy of the shared memory that plays the part of the slave half, by swapping it into
+    split_shmem for as long as the slave side runs.
+*/
+
+typedef struct {
+    uint32_t transactions; // round trips started by the master
+    uint32_t bytes;        // bytes that would have crossed the wire, both directions
+} split_loopback_stats_t;
+
+extern split_loopback_stats_t split_loopback_stats;
+
+/** @brief Sets whether the slave half answers transactions. */
+void split_loopback_set_connected(bool connected);
+
+/** @brief Sets whether the slave half's replies get lost, after it has acted on the transaction. */
+void split_loopback_set_drop_replies(bool drop);
+
+/** @brief Sets how far each round trip moves the fine timer on, in microseconds. */
+void split_loopback_set_round_trip_time(uint32_t us);
+
+#ifdef SPLIT_TRANSPORT_ASYNC
+/** @brief Sets how many polls a started transaction stays in flight for, before it is carried out. */
+void split_loopback_set_latency(uint8_t polls);
+#endif // SPLIT_TRANSPORT_ASYNC
+
+/** @brief Clears the slave half's shared memory and the statistics. */
+void split_loopback_reset(void);
+
+/** @brief Runs transactions_slave() as the slave half. */
+void split_loopback_slave_task(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+
+/** @brief Host LED state as last applied by the slave half. */
+extern uint8_t split_loopback_slave_led_state;
+
+/** @brief Host LED state reported by host_keyboard_leds() on the master half. */
+extern uint8_t split_loopback_master_led_state;
+
+#ifdef WPM_ENABLE
+/** @brief WPM of each half, as seen by get_current_wpm() and set_current_wpm(). */
+extern uint8_t split_loopback_master_wpm;
+extern uint8_t split_loopback_slave_wpm;
+#endif // WPM_ENABLE
@@ -0,0 +1,170 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "transactions.h"
+#include "split_loopback.h"
+}
+
+extern "C" {
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+#define HALF_ROWS ((MATRIX_ROWS) / 2)
+
+class SplitStats : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        split_loopback_reset();
+        // Every round trip takes 100us
+        split_loopback_set_round_trip_time(100);
+        split_loopback_master_wpm = 0;
+        split_loopback_slave_wpm  = 0;
+        memset(master_rows, 0, sizeof(master_rows));
+        memset(slave_rows, 0, sizeof(slave_rows));
+        memset(received_slave_rows, 0, sizeof(received_slave_rows));
+        memset(mirrored_master_rows, 0, sizeof(mirrored_master_rows));
+        // Clean syncs let any back off left over from a previous test wind down
+        for (int i = 0; i < 10; i++) {
+            sync();
+        }
+        split_transaction_stats_reset();
+    }
+
+    bool sync(void) {
+        split_loopback_slave_task(mirrored_master_rows, slave_rows);
+        bool okay = transactions_master(master_rows, received_slave_rows);
+        split_loopback_slave_task(mirrored_master_rows, slave_rows);
+        return okay;
+    }
+
+    matrix_row_t master_rows[HALF_ROWS];
+    matrix_row_t mirrored_master_rows[HALF_ROWS];
+    matrix_row_t slave_rows[HALF_ROWS];
+    matrix_row_t received_slave_rows[HALF_ROWS];
+};
+
+TEST_F(SplitStats, CountsRoundTrips) {
+    master_rows[0] = 0x01;
+    EXPECT_TRUE(sync());
+
+    const split_transaction_stats_t *checksum = split_transaction_get_stats(GET_SLAVE_MATRIX_CHECKSUM);
+    EXPECT_EQ(checksum->attempts, 1);
+    EXPECT_EQ(checksum->failures, 0);
+    EXPECT_EQ(checksum->bytes, 1);
+    // 100us is 3 bits long once shifted right by 4
+    EXPECT_EQ(checksum->rtt_histogram[3], 1);
+
+    const split_transaction_stats_t *mirror = split_transaction_get_stats(PUT_MASTER_MATRIX);
+    EXPECT_EQ(mirror->attempts, 1);
+    EXPECT_EQ(mirror->bytes, sizeof(master_rows));
+}
+
+TEST_F(SplitStats, CountsFailedRetries) {
+    split_loopback_set_drop_replies(true);
+    EXPECT_FALSE(sync());
+
+    const split_transaction_stats_t *checksum = split_transaction_get_stats(GET_SLAVE_MATRIX_CHECKSUM);
+    EXPECT_EQ(checksum->attempts, 10);
+    EXPECT_EQ(checksum->failures, 10);
+    EXPECT_EQ(checksum->bytes, 0);
+}
+
+TEST_F(SplitStats, OutOfRangeIdHasNoStats) {
+    EXPECT_EQ(split_transaction_get_stats(-1), nullptr);
+    EXPECT_EQ(split_transaction_get_stats(NUM_TOTAL_TRANSACTIONS), nullptr);
+}
+
+TEST_F(SplitStats, RawHidGetCounters) {
+    split_loopback_set_drop_replies(true);
+    sync();
+
+    uint8_t data[32] = {SPLIT_TRANSACTION_STATS_RAW_HID_ID, SPLIT_TRANSACTION_STATS_RAW_HID_GET_COUNTERS, GET_SLAVE_MATRIX_CHECKSUM};
+    EXPECT_TRUE(split_transaction_stats_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[3], 0);
+    EXPECT_EQ(data[4], 10);
+    EXPECT_EQ(data[8], 10);
+    EXPECT_EQ(data[12], 0);
+}
+
+TEST_F(SplitStats, RawHidGetRtt) {
+    sync();
+
+    uint8_t data[32] = {SPLIT_TRANSACTION_STATS_RAW_HID_ID, SPLIT_TRANSACTION_STATS_RAW_HID_GET_RTT, GET_SLAVE_MATRIX_CHECKSUM};
+    EXPECT_TRUE(split_transaction_stats_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[3], 0);
+    EXPECT_EQ(data[4 + 3 * 2], 1);
+    EXPECT_EQ(data[4 + 3 * 2 + 1], 0);
+}
+
+TEST_F(SplitStats, RawHidReset) {
+    sync();
+
+    uint8_t data[32] = {SPLIT_TRANSACTION_STATS_RAW_HID_ID, SPLIT_TRANSACTION_STATS_RAW_HID_RESET};
+    EXPECT_TRUE(split_transaction_stats_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[3], 0);
+    EXPECT_EQ(split_transaction_get_stats(GET_SLAVE_MATRIX_CHECKSUM)->attempts, 0);
+}
+
+TEST_F(SplitStats, RawHidRejectsOtherRequests) {
+    uint8_t other[32] = {0x00, SPLIT_TRANSACTION_STATS_RAW_HID_GET_COUNTERS};
+    EXPECT_FALSE(split_transaction_stats_raw_hid_receive(other, sizeof(other)));
+
+    uint8_t bad_id[32] = {SPLIT_TRANSACTION_STATS_RAW_HID_ID, SPLIT_TRANSACTION_STATS_RAW_HID_GET_COUNTERS, NUM_TOTAL_TRANSACTIONS};
+    EXPECT_TRUE(split_transaction_stats_raw_hid_receive(bad_id, sizeof(bad_id)));
+    EXPECT_EQ(bad_id[3], 1);
+}
+
+TEST_F(SplitStats, FailuresHoldBackLowPrioritySyncs) {
+    split_loopback_set_drop_replies(true);
+    EXPECT_FALSE(sync());
+    split_loopback_set_drop_replies(false);
+
+    // The matrix still goes through, WPM waits
+    slave_rows[0]             = 0x01;
+    split_loopback_master_wpm = 50;
+    EXPECT_TRUE(sync());
+    EXPECT_EQ(received_slave_rows[0], 0x01);
+    EXPECT_EQ(split_loopback_slave_wpm, 0);
+    EXPECT_EQ(split_transaction_get_stats(PUT_WPM)->attempts, 0);
+
+    advance_time(8);
+    EXPECT_TRUE(sync());
+    EXPECT_EQ(split_loopback_slave_wpm, 50);
+}
+
+TEST_F(SplitStats, RepeatedFailuresBackOffFurther) {
+    split_loopback_set_drop_replies(true);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_FALSE(sync());
+    }
+    split_loopback_set_drop_replies(false);
+
+    split_loopback_master_wpm = 50;
+    advance_time(16);
+    EXPECT_TRUE(sync());
+    EXPECT_EQ(split_loopback_slave_wpm, 0);
+
+    advance_time(16);
+    EXPECT_TRUE(sync());
+    EXPECT_EQ(split_loopback_slave_wpm, 50);
+}
+
+TEST_F(SplitStats, SlowSyncsHoldBackLowPrioritySyncs) {
+    // A single round trip over the default 2ms budget
+    split_loopback_set_round_trip_time(3000);
+    EXPECT_TRUE(sync());
+    split_loopback_set_round_trip_time(100);
+
+    split_loopback_master_wpm = 50;
+    EXPECT_TRUE(sync());
+    EXPECT_EQ(split_loopback_slave_wpm, 0);
+
+    advance_time(8);
+    EXPECT_TRUE(sync());
+    EXPECT_EQ(split_loopback_slave_wpm, 50);
+}
@@ -0,0 +1,146 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "transactions.h"
+#include "split_loopback.h"
+}
+
+extern "C" {
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+#define HALF_ROWS ((MATRIX_ROWS) / 2)
+
+class SplitTransactions : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        split_loopback_reset();
+        split_loopback_master_led_state = 0;
+        split_loopback_slave_led_state  = 0;
+        memset(master_rows, 0, sizeof(master_rows));
+        memset(slave_rows, 0, sizeof(slave_rows));
+        memset(received_slave_rows, 0, sizeof(received_slave_rows));
+        memset(mirrored_master_rows, 0, sizeof(mirrored_master_rows));
+    }
+
+    // One scan on each half: the slave publishes its matrix, then the master syncs
+    bool sync(void) {
+        split_loopback_slave_task(mirrored_master_rows, slave_rows);
+        bool okay = transactions_master(master_rows, received_slave_rows);
+        split_loopback_slave_task(mirrored_master_rows, slave_rows);
+        return okay;
+    }
+
+    // Matrix of the master half, and its copy on the slave half
+    matrix_row_t master_rows[HALF_ROWS];
+    matrix_row_t mirrored_master_rows[HALF_ROWS];
+    // Matrix of the slave half, and its copy on the master half
+    matrix_row_t slave_rows[HALF_ROWS];
+    matrix_row_t received_slave_rows[HALF_ROWS];
+};
+
+TEST_F(SplitTransactions, SlaveMatrixReachesMaster) {
+    slave_rows[0] = 0x01;
+    slave_rows[3] = 0x80;
+    EXPECT_TRUE(sync());
+    EXPECT_EQ(received_slave_rows[0], 0x01);
+    EXPECT_EQ(received_slave_rows[1], 0x00);
+    EXPECT_EQ(received_slave_rows[3], 0x80);
+
+    slave_rows[0] = 0x00;
+    advance_time(1);
+    EXPECT_TRUE(sync());
+    EXPECT_EQ(received_slave_rows[0], 0x00);
+    EXPECT_EQ(received_slave_rows[3], 0x80);
+}
+
+TEST_F(SplitTransactions, MasterMatrixIsMirrored) {
+    master_rows[2] = 0x42;
+    EXPECT_TRUE(sync());
+    EXPECT_EQ(mirrored_master_rows[2], 0x42);
+}
+
+TEST_F(SplitTransactions, LedStateReachesSlave) {
+    split_loopback_master_led_state = 0x05;
+    EXPECT_TRUE(sync());
+    EXPECT_EQ(split_loopback_slave_led_state, 0x05);
+}
+
+TEST_F(SplitTransactions, DisconnectedSlaveFails) {
+    split_loopback_set_connected(false);
+    slave_rows[0] = 0x01;
+    EXPECT_FALSE(sync());
+    EXPECT_EQ(received_slave_rows[0], 0x00);
+}
+
+TEST_F(SplitTransactions, RoundTripsPerSync) {
+    // Let the first sync settle the idle state
+    EXPECT_TRUE(sync());
+    advance_time(1);
+
+    slave_rows[1]                   = 0x10;
+    master_rows[1]                  = 0x20;
+    split_loopback_master_led_state = 0x02;
+    split_loopback_stats            = (split_loopback_stats_t){0};
+    EXPECT_TRUE(sync());
+    EXPECT_EQ(received_slave_rows[1], 0x10);
+    EXPECT_EQ(mirrored_master_rows[1], 0x20);
+    EXPECT_EQ(split_loopback_slave_led_state, 0x02);
+#if defined(SPLIT_TRANSACTION_BATCHING)
+    EXPECT_EQ(split_loopback_stats.transactions, 1);
+#elif defined(SPLIT_TRANSACTION_DELTA)
+    // Matrix delta, master matrix and LED state
+    EXPECT_EQ(split_loopback_stats.transactions, 3);
+#else
+    // Matrix checksum, matrix data, master matrix and LED state
+    EXPECT_EQ(split_loopback_stats.transactions, 4);
+#endif
+}
+
+TEST_F(SplitTransactions, IdleSyncIsOneRoundTrip) {
+    EXPECT_TRUE(sync());
+    advance_time(1);
+
+    split_loopback_stats = (split_loopback_stats_t){0};
+    EXPECT_TRUE(sync());
+    // Only the matrix checksum, or an empty delta, is read when nothing changed
+    EXPECT_EQ(split_loopback_stats.transactions, 1);
+}
+
+TEST_F(SplitTransactions, SlaveMatrixRecoversFromLostReplies) {
+    slave_rows[0] = 0x01;
+    EXPECT_TRUE(sync());
+    advance_time(1);
+
+    split_loopback_set_drop_replies(true);
+    slave_rows[0] = 0x03;
+    EXPECT_FALSE(sync());
+    EXPECT_EQ(received_slave_rows[0], 0x01);
+    advance_time(1);
+
+    split_loopback_set_drop_replies(false);
+    slave_rows[0] = 0x07;
+    slave_rows[2] = 0x10;
+    EXPECT_TRUE(sync());
+    EXPECT_EQ(received_slave_rows[0], 0x07);
+    EXPECT_EQ(received_slave_rows[2], 0x10);
+}
+
+#ifdef SPLIT_TRANSACTION_DELTA
+TEST_F(SplitTransactions, SlaveMatrixChangeSendsDelta) {
+    EXPECT_TRUE(sync());
+    advance_time(1);
+
+    slave_rows[3]        = 0x04;
+    split_loopback_stats = (split_loopback_stats_t){0};
+    EXPECT_TRUE(sync());
+    EXPECT_EQ(received_slave_rows[3], 0x04);
+    // Less than a single full read of the matrix
+    EXPECT_LT(split_loopback_stats.bytes, 2 + sizeof(slave_rows));
+}
+#endif // SPLIT_TRANSACTION_DELTA
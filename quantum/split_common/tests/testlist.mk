@@ -0,0 +1,9 @@
+TEST_LIST += \
+	split_delta \
+	split_transactions \
+	split_transactions_async \
+	split_transactions_async_stats \
+	split_transactions_batching \
+	split_transactions_delta \
+	split_transactions_delta_batching \
+	split_transactions_stats
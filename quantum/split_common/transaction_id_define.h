@@ -23,8 +23,16 @@ enum serial_transaction_id {
     I2C_EXECUTE_CALLBACK,
 #endif // USE_I2C
 
+#ifdef SPLIT_TRANSACTION_BATCHING
+    CMD_BATCH,
+#endif // SPLIT_TRANSACTION_BATCHING
+
+#ifdef SPLIT_TRANSACTION_DELTA
+    GET_SLAVE_MATRIX_DELTA,
+#else // SPLIT_TRANSACTION_DELTA
     GET_SLAVE_MATRIX_CHECKSUM,
     GET_SLAVE_MATRIX_DATA,
+#endif // SPLIT_TRANSACTION_DELTA
 
 #ifdef SPLIT_TRANSPORT_MIRROR
     PUT_MASTER_MATRIX,
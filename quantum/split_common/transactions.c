@@ -30,6 +30,8 @@
 #include "transaction_id_define.h"
 #include "split_util.h"
 #include "synchronization_util.h"
+#include "util.h"
+#include "raw_hid.h"
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -84,9 +86,22 @@
 #define trans_initiator2target_cb(cb) \
     { 0, 0, 0, 0, cb }
 
-#define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
-#define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
-#define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
+#if defined(SPLIT_TRANSACTION_STATS) || defined(SPLIT_TRANSACTION_ADAPTIVE_SYNC)
+static bool link_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
+#else // defined(SPLIT_TRANSACTION_STATS) || defined(SPLIT_TRANSACTION_ADAPTIVE_SYNC)
+#    define link_execute_transaction transport_execute_transaction
+#endif // defined(SPLIT_TRANSACTION_STATS) || defined(SPLIT_TRANSACTION_ADAPTIVE_SYNC)
+
+#ifdef SPLIT_TRANSACTION_BATCHING
+static bool batch_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
+#    define transaction_execute batch_execute_transaction
+#else // SPLIT_TRANSACTION_BATCHING
+#    define transaction_execute link_execute_transaction
+#endif // SPLIT_TRANSACTION_BATCHING
+
+#define transport_write(id, data, length) transaction_execute(id, data, length, NULL, 0)
+#define transport_read(id, data, length) transaction_execute(id, NULL, 0, data, length)
+#define transport_exec(id) transaction_execute(id, NULL, 0, NULL, 0)
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 // Forward-declare the RPC callback handlers
@@ -175,9 +190,310 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
     return send_if_condition(trans_id, last_update, (memcmp(source, equiv_shmem, length) != 0), source, length);
 }
 
+////////////////////////////////////////////////////
+// Link statistics
+
+#ifdef SPLIT_TRANSACTION_STATS
+
+static split_transaction_stats_t link_stats[NUM_TOTAL_TRANSACTIONS];
+
+static void link_stats_record(int8_t id, bool okay, uint16_t bytes, uint32_t rtt_us) {
+    split_transaction_stats_t *stats = &link_stats[id];
+
+    stats->attempts++;
+    if (!okay) {
+        stats->failures++;
+        return;
+    }
+    stats->bytes += bytes;
+
+    uint8_t bucket = 0;
+    for (rtt_us >>= SPLIT_TRANSACTION_STATS_RTT_SHIFT; rtt_us && bucket < SPLIT_TRANSACTION_STATS_RTT_BUCKETS - 1; rtt_us >>= 1) {
+        bucket++;
+    }
+    if (stats->rtt_histogram[bucket] == UINT16_MAX) {
+        // Halve the whole histogram to keep the distribution while making room
+        for (uint8_t i = 0; i < SPLIT_TRANSACTION_STATS_RTT_BUCKETS; i++) {
+            stats->rtt_histogram[i] >>= 1;
+        }
+    }
+    stats->rtt_histogram[bucket]++;
+}
+
+const split_transaction_stats_t *split_transaction_get_stats(int8_t transaction_id) {
+    return (transaction_id >= 0 && transaction_id < NUM_TOTAL_TRANSACTIONS) ? &link_stats[transaction_id] : NULL;
+}
+
+void split_transaction_stats_reset(void) {
+    memset(link_stats, 0, sizeof(link_stats));
+}
+
+void split_transaction_stats_print(void) {
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        const split_transaction_stats_t *stats = &link_stats[id];
+        if (stats->attempts == 0) {
+            continue;
+        }
+        dprintf("split %2d: n=%lu fail=%lu bytes=%lu rtt=", id, (unsigned long)stats->attempts, (unsigned long)stats->failures, (unsigned long)stats->bytes);
+        for (uint8_t i = 0; i < SPLIT_TRANSACTION_STATS_RTT_BUCKETS; i++) {
+            dprintf(i ? ",%u" : "%u", stats->rtt_histogram[i]);
+        }
+        dprintf("\n");
+    }
+}
+
+bool split_transaction_stats_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 4 || data[0] != SPLIT_TRANSACTION_STATS_RAW_HID_ID) {
+        return false;
+    }
+
+    // Request:  [id, command, transaction id]
+    // Response: [id, command, transaction id, status, values...], values little endian
+    const split_transaction_stats_t *stats  = split_transaction_get_stats(data[2]);
+    uint8_t                         *status = &data[3];
+    switch (data[1]) {
+        case SPLIT_TRANSACTION_STATS_RAW_HID_GET_COUNTERS:
+            // attempts, failures and bytes as uint32
+            if (stats == NULL || length < 4 + 3 * sizeof(uint32_t)) {
+                *status = 1;
+                break;
+            }
+            *status = 0;
+            raw_hid_write_u32(&data[4], stats->attempts);
+            raw_hid_write_u32(&data[8], stats->failures);
+            raw_hid_write_u32(&data[12], stats->bytes);
+            break;
+        case SPLIT_TRANSACTION_STATS_RAW_HID_GET_RTT:
+            // the round trip time histogram as uint16
+            if (stats == NULL || length < 4 + sizeof(stats->rtt_histogram)) {
+                *status = 1;
+                break;
+            }
+            *status = 0;
+            for (uint8_t i = 0; i < SPLIT_TRANSACTION_STATS_RTT_BUCKETS; i++) {
+                raw_hid_write_u16(&data[4 + i * 2], stats->rtt_histogram[i]);
+            }
+            break;
+        case SPLIT_TRANSACTION_STATS_RAW_HID_RESET:
+            split_transaction_stats_reset();
+            *status = 0;
+            break;
+        case SPLIT_TRANSACTION_STATS_RAW_HID_PRINT:
+            split_transaction_stats_print();
+            *status = 0;
+            break;
+        default:
+            *status = 1;
+            break;
+    }
+    return true;
+}
+
+#endif // SPLIT_TRANSACTION_STATS
+
+////////////////////////////////////////////////////
+// Adaptive sync
+
+#ifdef SPLIT_TRANSACTION_ADAPTIVE_SYNC
+
+#    ifndef SPLIT_ADAPTIVE_SYNC_BUDGET_MS
+#        define SPLIT_ADAPTIVE_SYNC_BUDGET_MS 2
+#    endif // SPLIT_ADAPTIVE_SYNC_BUDGET_MS
+
+#    ifndef SPLIT_ADAPTIVE_SYNC_MAX_BACKOFF_MS
+#        define SPLIT_ADAPTIVE_SYNC_MAX_BACKOFF_MS 512
+#    endif // SPLIT_ADAPTIVE_SYNC_MAX_BACKOFF_MS
+
+#    define SPLIT_ADAPTIVE_SYNC_MIN_BACKOFF_MS 8
+
+static bool     adaptive_link_failed = false; // a round trip failed during the current sync
+static uint32_t adaptive_sync_start  = 0; // timer_read_fine() at the start of the current sync
+static uint16_t adaptive_backoff     = 0; // how long low priority syncs are held back for
+static uint32_t adaptive_last_low    = 0; // when low priority syncs last ran
+
+static void adaptive_sync_begin(void) {
+    adaptive_link_failed = false;
+    adaptive_sync_start  = timer_read_fine();
+}
+
+// A sync that failed or ran over budget means the link is noisy or saturated: hold back low
+// priority syncs for twice as long. Every clean sync halves the hold back again.
+static void adaptive_sync_end(void) {
+    if (adaptive_link_failed || timer_fine_to_us(TIMER_DIFF_32(timer_read_fine(), adaptive_sync_start)) > SPLIT_ADAPTIVE_SYNC_BUDGET_MS * 1000) {
+        adaptive_backoff = adaptive_backoff ? MIN(adaptive_backoff * 2, SPLIT_ADAPTIVE_SYNC_MAX_BACKOFF_MS) : SPLIT_ADAPTIVE_SYNC_MIN_BACKOFF_MS;
+    } else {
+        adaptive_backoff /= 2;
+    }
+}
+
+static bool adaptive_sync_low_priority_due(void) {
+    if (adaptive_backoff && timer_elapsed32(adaptive_last_low) < adaptive_backoff) {
+        return false;
+    }
+    adaptive_last_low = timer_read32();
+    return true;
+}
+
+#    ifdef SPLIT_TRANSPORT_ASYNC
+// transactions_master() returns while the batch is still in flight, so a sync runs from the
+// submission of a batch to its completion instead
+#        define TRANSACTIONS_ADAPTIVE_SYNC_BEGIN()
+#        define TRANSACTIONS_ADAPTIVE_SYNC_END()
+#        define TRANSACTIONS_ADAPTIVE_BATCH_SUBMITTED() adaptive_sync_begin()
+#        define TRANSACTIONS_ADAPTIVE_BATCH_COMPLETED(success) \
+            do {                                              \
+                adaptive_link_failed |= !(success);           \
+                adaptive_sync_end();                          \
+            } while (0)
+#    else // SPLIT_TRANSPORT_ASYNC
+#        define TRANSACTIONS_ADAPTIVE_SYNC_BEGIN() adaptive_sync_begin()
+#        define TRANSACTIONS_ADAPTIVE_SYNC_END() adaptive_sync_end()
+#    endif // SPLIT_TRANSPORT_ASYNC
+#    define TRANSACTIONS_LOW_PRIORITY_DUE() adaptive_sync_low_priority_due()
+
+#else // SPLIT_TRANSACTION_ADAPTIVE_SYNC
+
+#    define TRANSACTIONS_ADAPTIVE_SYNC_BEGIN()
+#    define TRANSACTIONS_ADAPTIVE_SYNC_END()
+#    define TRANSACTIONS_ADAPTIVE_BATCH_SUBMITTED()
+#    define TRANSACTIONS_ADAPTIVE_BATCH_COMPLETED(success)
+#    define TRANSACTIONS_LOW_PRIORITY_DUE() true
+
+#endif // SPLIT_TRANSACTION_ADAPTIVE_SYNC
+
+// Start time of a round trip, as accounted for by link_record()
+static inline uint32_t link_start(void) {
+#ifdef SPLIT_TRANSACTION_STATS
+    return timer_read_fine();
+#else
+    return 0;
+#endif // SPLIT_TRANSACTION_STATS
+}
+
+#if defined(SPLIT_TRANSACTION_STATS) || defined(SPLIT_TRANSACTION_ADAPTIVE_SYNC)
+
+// Accounts for a round trip started at `start`, as given by link_start()
+static void link_record(int8_t id, bool okay, uint16_t initiator2target_length, uint16_t target2initiator_length, uint32_t start) {
+#    ifdef SPLIT_TRANSACTION_STATS
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    uint16_t                  bytes = MIN(initiator2target_length, trans->initiator2target_buffer_size);
+    if (target2initiator_length > 0) {
+        bytes += split_trans_target2initiator_length(trans);
+    }
+    link_stats_record(id, okay, bytes, timer_fine_to_us(TIMER_DIFF_32(timer_read_fine(), start)));
+#    endif // SPLIT_TRANSACTION_STATS
+#    ifdef SPLIT_TRANSACTION_ADAPTIVE_SYNC
+    adaptive_link_failed |= !okay;
+#    endif // SPLIT_TRANSACTION_ADAPTIVE_SYNC
+}
+
+static bool link_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    uint32_t start = link_start();
+    bool     okay  = transport_execute_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+    link_record(id, okay, initiator2target_length, target2initiator_length, start);
+    return okay;
+}
+
+#endif // defined(SPLIT_TRANSACTION_STATS) || defined(SPLIT_TRANSACTION_ADAPTIVE_SYNC)
+
+////////////////////////////////////////////////////
+// Delta encoding
+
+#ifdef SPLIT_TRANSACTION_DELTA
+
+typedef struct {
+    uint32_t last_full;
+    uint8_t  seq;
+} delta_sync_state_t;
+
+#    define trans_initiator2target_delta_initializer(cb) \
+        { sizeof_member(split_shared_memory_t, delta_put), offsetof(split_shared_memory_t, delta_put), 0, 0, cb, SPLIT_TRANS_FRAMED_INITIATOR2TARGET }
+
+// Slave side of a delta-encoded transaction: keeps its own copy of the state the deltas apply
+// to, and publishes it to the shared memory member whenever a frame applies
+#    define DELTA_SLAVE_CALLBACK(name, member)                                                                                                                             \
+        STATIC_ASSERT(sizeof_member(split_shared_memory_t, member) <= SPLIT_DELTA_BUFFER_SIZE, #member " too large for SPLIT_DELTA_BUFFER_SIZE");                          \
+        static void name(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) { \
+            static uint8_t baseline[sizeof_member(split_shared_memory_t, member)];                                                                                         \
+            static uint8_t seq = 0;                                                                                                                                        \
+            if (split_delta_apply(&split_shmem->delta_put, baseline, sizeof(baseline), &seq)) {                                                                            \
+                memcpy(&split_shmem->member, baseline, sizeof(baseline));                                                                                                  \
+            }                                                                                                                                                              \
+        }
+
+/**
+ * @brief Like send_if_condition(), but only sends what changed since the last send.
+ *
+ * `equiv_shmem` holds what was last sent. A full copy is sent at least every
+ * FORCED_SYNC_THROTTLE_MS, which brings a slave that missed a frame back in sync.
+ */
+inline static bool send_delta_if_condition(int8_t trans_id, uint32_t *last_update, delta_sync_state_t *state, bool condition, const void *source, void *equiv_shmem, size_t length) {
+    if (timer_elapsed32(*last_update) < FORCED_SYNC_THROTTLE_MS && !condition) {
+        return true;
+    }
+
+    bool                full = state->seq == 0 || timer_elapsed32(state->last_full) >= FORCED_SYNC_THROTTLE_MS;
+    uint8_t             seq  = split_delta_next_seq(state->seq);
+    split_delta_frame_t frame;
+    split_delta_encode(&frame, full ? NULL : equiv_shmem, source, length, full ? 0 : state->seq, seq);
+    memcpy(equiv_shmem, source, length);
+
+    if (!transport_write(trans_id, &frame, sizeof(frame.length) + frame.length)) {
+        state->seq = 0;
+        return false;
+    }
+    state->seq   = seq;
+    *last_update = timer_read32();
+    if (full) {
+        state->last_full = *last_update;
+    }
+    return true;
+}
+
+#endif // SPLIT_TRANSACTION_DELTA
+
 ////////////////////////////////////////////////////
 // Slave matrix
 
+#ifdef SPLIT_TRANSACTION_DELTA
+
+STATIC_ASSERT(sizeof_member(split_shared_memory_t, smatrix.matrix) <= SPLIT_DELTA_BUFFER_SIZE, "Slave matrix too large for SPLIT_DELTA_BUFFER_SIZE");
+
+static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-decoded matrix, the deltas apply to it
+    static uint8_t      seq                            = 0;
+    split_delta_frame_t frame;
+
+    bool okay = transaction_execute(GET_SLAVE_MATRIX_DELTA, &seq, sizeof(seq), &frame, sizeof(frame));
+    if (okay) {
+        // A frame that doesn't apply resets seq, which asks the slave for a full copy
+        okay = split_delta_apply(&frame, last_matrix, sizeof(last_matrix), &seq);
+    }
+    // Keep the acknowledgement staged, so that a batch can carry it
+    split_shmem->smatrix.delta_ack = seq;
+    memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
+    return okay;
+}
+
+static void slave_matrix_delta_slave_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    static matrix_row_t baseline[(MATRIX_ROWS) / 2]; // last matrix sent to the master
+    static uint8_t      seq = 0;
+
+    uint8_t ack = split_shmem->smatrix.delta_ack;
+    if (ack == 0 || ack != seq) {
+        // The master doesn't have the last matrix that was sent, so start over
+        seq = split_delta_next_seq(seq);
+        split_delta_encode(&split_shmem->smatrix.delta, NULL, split_shmem->smatrix.matrix, sizeof(baseline), 0, seq);
+    } else {
+        uint8_t next = memcmp(baseline, split_shmem->smatrix.matrix, sizeof(baseline)) ? split_delta_next_seq(seq) : seq;
+        split_delta_encode(&split_shmem->smatrix.delta, baseline, split_shmem->smatrix.matrix, sizeof(baseline), seq, next);
+        seq = next;
+    }
+    memcpy(baseline, split_shmem->smatrix.matrix, sizeof(baseline));
+}
+
+#else // SPLIT_TRANSACTION_DELTA
+
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t     last_update                    = 0;
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
@@ -193,6 +509,8 @@ static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_ro
     return okay;
 }
 
+#endif // SPLIT_TRANSACTION_DELTA
+
 static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     memcpy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
     split_shmem->smatrix.checksum = crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
@@ -201,9 +519,18 @@ static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row
 // clang-format off
 #define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
-#define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
+#ifdef SPLIT_TRANSACTION_DELTA
+#    define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
+    [GET_SLAVE_MATRIX_DELTA] = { \
+        sizeof_member(split_shared_memory_t, smatrix.delta_ack), offsetof(split_shared_memory_t, smatrix.delta_ack), \
+        sizeof_member(split_shared_memory_t, smatrix.delta), offsetof(split_shared_memory_t, smatrix.delta), \
+        slave_matrix_delta_slave_callback, SPLIT_TRANS_FRAMED_TARGET2INITIATOR \
+    },
+#else // SPLIT_TRANSACTION_DELTA
+#    define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
     [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
     [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
+#endif // SPLIT_TRANSACTION_DELTA
 // clang-format on
 
 ////////////////////////////////////////////////////
@@ -502,7 +829,12 @@ static bool rgblight_handlers_master(matrix_row_t master_matrix[], matrix_row_t
     static uint32_t     last_update = 0;
     rgblight_syncinfo_t rgblight_sync;
     rgblight_get_syncinfo(&rgblight_sync);
+#    ifdef SPLIT_TRANSACTION_DELTA
+    static delta_sync_state_t delta_state = {0};
+    if (send_delta_if_condition(PUT_RGBLIGHT, &last_update, &delta_state, (rgblight_sync.status.change_flags != 0), &rgblight_sync, &split_shmem->rgblight_sync, sizeof(rgblight_sync))) {
+#    else // SPLIT_TRANSACTION_DELTA
     if (send_if_condition(PUT_RGBLIGHT, &last_update, (rgblight_sync.status.change_flags != 0), &rgblight_sync, sizeof(rgblight_sync))) {
+#    endif // SPLIT_TRANSACTION_DELTA
         rgblight_clear_change_flags();
     } else {
         return false;
@@ -525,7 +857,12 @@ static void rgblight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 
 #    define TRANSACTIONS_RGBLIGHT_MASTER() TRANSACTION_HANDLER_MASTER(rgblight)
 #    define TRANSACTIONS_RGBLIGHT_SLAVE() TRANSACTION_HANDLER_SLAVE(rgblight)
-#    define TRANSACTIONS_RGBLIGHT_REGISTRATIONS [PUT_RGBLIGHT] = trans_initiator2target_initializer(rgblight_sync),
+#    ifdef SPLIT_TRANSACTION_DELTA
+DELTA_SLAVE_CALLBACK(rgblight_delta_slave_callback, rgblight_sync)
+#        define TRANSACTIONS_RGBLIGHT_REGISTRATIONS [PUT_RGBLIGHT] = trans_initiator2target_delta_initializer(rgblight_delta_slave_callback),
+#    else // SPLIT_TRANSACTION_DELTA
+#        define TRANSACTIONS_RGBLIGHT_REGISTRATIONS [PUT_RGBLIGHT] = trans_initiator2target_initializer(rgblight_sync),
+#    endif // SPLIT_TRANSACTION_DELTA
 
 #else // defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
 
@@ -545,7 +882,12 @@ static bool led_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_
     led_matrix_sync_t led_matrix_sync;
     memcpy(&led_matrix_sync.led_matrix, &led_matrix_eeconfig, sizeof(led_eeconfig_t));
     led_matrix_sync.led_suspend_state = led_matrix_get_suspend_state();
+#    ifdef SPLIT_TRANSACTION_DELTA
+    static delta_sync_state_t delta_state = {0};
+    return send_delta_if_condition(PUT_LED_MATRIX, &last_update, &delta_state, memcmp(&led_matrix_sync, &split_shmem->led_matrix_sync, sizeof(led_matrix_sync)) != 0, &led_matrix_sync, &split_shmem->led_matrix_sync, sizeof(led_matrix_sync));
+#    else // SPLIT_TRANSACTION_DELTA
     return send_if_data_mismatch(PUT_LED_MATRIX, &last_update, &led_matrix_sync, &split_shmem->led_matrix_sync, sizeof(led_matrix_sync));
+#    endif // SPLIT_TRANSACTION_DELTA
 }
 
 static void led_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -559,7 +901,12 @@ static void led_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 
 #    define TRANSACTIONS_LED_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(led_matrix)
 #    define TRANSACTIONS_LED_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(led_matrix)
-#    define TRANSACTIONS_LED_MATRIX_REGISTRATIONS [PUT_LED_MATRIX] = trans_initiator2target_initializer(led_matrix_sync),
+#    ifdef SPLIT_TRANSACTION_DELTA
+DELTA_SLAVE_CALLBACK(led_matrix_delta_slave_callback, led_matrix_sync)
+#        define TRANSACTIONS_LED_MATRIX_REGISTRATIONS [PUT_LED_MATRIX] = trans_initiator2target_delta_initializer(led_matrix_delta_slave_callback),
+#    else // SPLIT_TRANSACTION_DELTA
+#        define TRANSACTIONS_LED_MATRIX_REGISTRATIONS [PUT_LED_MATRIX] = trans_initiator2target_initializer(led_matrix_sync),
+#    endif // SPLIT_TRANSACTION_DELTA
 
 #else // defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
 
@@ -579,7 +926,12 @@ static bool rgb_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_
     rgb_matrix_sync_t rgb_matrix_sync;
     memcpy(&rgb_matrix_sync.rgb_matrix, &rgb_matrix_config, sizeof(rgb_config_t));
     rgb_matrix_sync.rgb_suspend_state = rgb_matrix_get_suspend_state();
+#    ifdef SPLIT_TRANSACTION_DELTA
+    static delta_sync_state_t delta_state = {0};
+    return send_delta_if_condition(PUT_RGB_MATRIX, &last_update, &delta_state, memcmp(&rgb_matrix_sync, &split_shmem->rgb_matrix_sync, sizeof(rgb_matrix_sync)) != 0, &rgb_matrix_sync, &split_shmem->rgb_matrix_sync, sizeof(rgb_matrix_sync));
+#    else // SPLIT_TRANSACTION_DELTA
     return send_if_data_mismatch(PUT_RGB_MATRIX, &last_update, &rgb_matrix_sync, &split_shmem->rgb_matrix_sync, sizeof(rgb_matrix_sync));
+#    endif // SPLIT_TRANSACTION_DELTA
 }
 
 static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -593,7 +945,12 @@ static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 
 #    define TRANSACTIONS_RGB_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(rgb_matrix)
 #    define TRANSACTIONS_RGB_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(rgb_matrix)
-#    define TRANSACTIONS_RGB_MATRIX_REGISTRATIONS [PUT_RGB_MATRIX] = trans_initiator2target_initializer(rgb_matrix_sync),
+#    ifdef SPLIT_TRANSACTION_DELTA
+DELTA_SLAVE_CALLBACK(rgb_matrix_delta_slave_callback, rgb_matrix_sync)
+#        define TRANSACTIONS_RGB_MATRIX_REGISTRATIONS [PUT_RGB_MATRIX] = trans_initiator2target_delta_initializer(rgb_matrix_delta_slave_callback),
+#    else // SPLIT_TRANSACTION_DELTA
+#        define TRANSACTIONS_RGB_MATRIX_REGISTRATIONS [PUT_RGB_MATRIX] = trans_initiator2target_initializer(rgb_matrix_sync),
+#    endif // SPLIT_TRANSACTION_DELTA
 
 #else // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
@@ -914,6 +1271,159 @@ static void detected_os_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+////////////////////////////////////////////////////
+// Batching
+
+#ifdef SPLIT_TRANSACTION_BATCHING
+
+STATIC_ASSERT(SPLIT_TRANSACTION_BATCH_SIZE < UINT8_MAX, "SPLIT_TRANSACTION_BATCH_SIZE must be less than 255");
+
+// Reads that the slave answers ahead of time in every batch response
+static const int8_t batch_prefetch_ids[] = {
+#    ifdef SPLIT_TRANSACTION_DELTA
+    GET_SLAVE_MATRIX_DELTA,
+#    else // SPLIT_TRANSACTION_DELTA
+    GET_SLAVE_MATRIX_CHECKSUM,
+    GET_SLAVE_MATRIX_DATA,
+#    endif // SPLIT_TRANSACTION_DELTA
+#    ifdef ENCODER_ENABLE
+    GET_ENCODERS_CHECKSUM,
+    GET_ENCODERS_DATA,
+#    endif // ENCODER_ENABLE
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    GET_POINTING_CHECKSUM,
+    GET_POINTING_DATA,
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+};
+
+static split_batch_frame_t batch_request;
+static split_batch_frame_t batch_response;
+static bool                batch_queueing   = false;
+static uint32_t            batch_prefetched = 0; // bitmask of transaction ids whose response is waiting in split_shmem
+
+static bool batch_append(split_batch_frame_t *frame, int8_t id, const void *buffer, uint8_t length) {
+    if ((size_t)frame->length + 1 + length > sizeof(frame->data)) {
+        return false;
+    }
+    frame->data[frame->length] = id;
+    memcpy(&frame->data[frame->length + 1], buffer, length);
+    frame->length += 1 + length;
+    return true;
+}
+
+static void batch_begin(void) {
+    batch_request.length = 0;
+    batch_prefetched     = 0;
+    for (uint8_t i = 0; i < ARRAY_SIZE(batch_prefetch_ids); i++) {
+        // Reads that take arguments use whatever their handler last staged in split_shmem
+        split_transaction_desc_t *trans = &split_transaction_table[batch_prefetch_ids[i]];
+        batch_append(&batch_request, batch_prefetch_ids[i], split_trans_initiator2target_buffer(trans), split_trans_initiator2target_length(trans));
+    }
+    batch_queueing = true;
+}
+
+static bool batch_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+
+    if (batch_queueing && target2initiator_length == 0 && trans->target2initiator_buffer_size == 0) {
+        // Stage the data in split_shmem as the transport would, then queue the whole buffer
+        if (initiator2target_length > 0) {
+            size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
+            memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, len);
+        }
+        if (batch_append(&batch_request, id, split_trans_initiator2target_buffer(trans), split_trans_initiator2target_length(trans))) {
+            return true;
+        }
+        // Doesn't fit in the frame, send it on its own
+    } else if ((batch_prefetched & (1UL << id)) && (initiator2target_length == 0 || memcmp(initiator2target_buf, split_trans_initiator2target_buffer(trans), initiator2target_length) == 0)) {
+        // Answered in the batch response, to the same arguments
+        batch_prefetched &= ~(1UL << id);
+        size_t len = trans->target2initiator_buffer_size < target2initiator_length ? trans->target2initiator_buffer_size : target2initiator_length;
+        memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), len);
+        return true;
+    }
+
+    return link_execute_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+}
+
+// Unpacks the responses to where a regular read would have left them
+static void batch_unpack_response(void) {
+    uint8_t length = batch_response.length < sizeof(batch_response.data) ? batch_response.length : sizeof(batch_response.data);
+    for (uint8_t pos = 0; pos < length;) {
+        int8_t id = batch_response.data[pos++];
+        if (id < 0 || id >= NUM_TOTAL_TRANSACTIONS) {
+            break;
+        }
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        uint8_t                   size  = split_trans_used_length(&batch_response.data[pos], trans->target2initiator_buffer_size, trans->flags & SPLIT_TRANS_FRAMED_TARGET2INITIATOR);
+        if (size == 0 || pos + size > length) {
+            break;
+        }
+        memcpy(split_trans_target2initiator_buffer(trans), &batch_response.data[pos], size);
+        pos += size;
+        batch_prefetched |= 1UL << id;
+    }
+}
+
+#    ifndef SPLIT_TRANSPORT_ASYNC
+static bool batch_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    batch_queueing = false;
+    if (!link_execute_transaction(CMD_BATCH, &batch_request, sizeof(batch_request.length) + batch_request.length, &batch_response, sizeof(batch_response))) {
+        return false;
+    }
+    batch_unpack_response();
+    return true;
+}
+#    endif // SPLIT_TRANSPORT_ASYNC
+
+static void batch_handlers_slave(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const split_batch_frame_t *request  = &split_shmem->batch_request;
+    split_batch_frame_t       *response = &split_shmem->batch_response;
+
+    // Run each record as if it had been received as its own transaction
+    response->length = 0;
+    uint8_t length   = request->length < sizeof(request->data) ? request->length : sizeof(request->data);
+    for (uint8_t pos = 0; pos < length;) {
+        int8_t id = request->data[pos++];
+        if (id < 0 || id >= NUM_TOTAL_TRANSACTIONS || id == CMD_BATCH) {
+            break;
+        }
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        uint8_t                   size  = pos < length ? split_trans_used_length(&request->data[pos], trans->initiator2target_buffer_size, trans->flags & SPLIT_TRANS_FRAMED_INITIATOR2TARGET) : trans->initiator2target_buffer_size;
+        if (pos + size > length) {
+            break;
+        }
+        memcpy(split_trans_initiator2target_buffer(trans), &request->data[pos], size);
+        pos += size;
+
+        if (trans->slave_callback) {
+            trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+        }
+        // Responses that don't fit are left out, and read separately by the master
+        if (trans->target2initiator_buffer_size) {
+            batch_append(response, id, split_trans_target2initiator_buffer(trans), split_trans_target2initiator_length(trans));
+        }
+    }
+}
+
+// clang-format off
+#    define TRANSACTIONS_BATCH_BEGIN() batch_begin()
+#    define TRANSACTIONS_BATCH_MASTER() TRANSACTION_HANDLER_MASTER(batch)
+#    define TRANSACTIONS_BATCH_END() (batch_prefetched = 0)
+#    define TRANSACTIONS_BATCH_REGISTRATIONS \
+    [CMD_BATCH] = { \
+        sizeof_member(split_shared_memory_t, batch_request), offsetof(split_shared_memory_t, batch_request), \
+        sizeof_member(split_shared_memory_t, batch_response), offsetof(split_shared_memory_t, batch_response), \
+        batch_handlers_slave, SPLIT_TRANS_FRAMED_INITIATOR2TARGET | SPLIT_TRANS_FRAMED_TARGET2INITIATOR \
+    },
+// clang-format on
+
+#else // SPLIT_TRANSACTION_BATCHING
+
+#    define TRANSACTIONS_BATCH_REGISTRATIONS
+
+#endif // SPLIT_TRANSACTION_BATCHING
+
 ////////////////////////////////////////////////////
 
 split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
@@ -925,6 +1435,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 #endif // USE_I2C
 
     // clang-format off
+    TRANSACTIONS_BATCH_REGISTRATIONS
     TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS
     TRANSACTIONS_MASTER_MATRIX_REGISTRATIONS
     TRANSACTIONS_ENCODERS_REGISTRATIONS
@@ -954,7 +1465,111 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 };
 
-bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#ifdef SPLIT_TRANSACTION_BATCHING
+
+static bool transactions_master_queue_writes(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    TRANSACTIONS_MASTER_MATRIX_MASTER();
+    TRANSACTIONS_SYNC_TIMER_MASTER();
+    TRANSACTIONS_LAYER_STATE_MASTER();
+    TRANSACTIONS_LED_STATE_MASTER();
+    TRANSACTIONS_MODS_MASTER();
+    TRANSACTIONS_BACKLIGHT_MASTER();
+    if (TRANSACTIONS_LOW_PRIORITY_DUE()) {
+        TRANSACTIONS_RGBLIGHT_MASTER();
+        TRANSACTIONS_LED_MATRIX_MASTER();
+        TRANSACTIONS_RGB_MATRIX_MASTER();
+        TRANSACTIONS_WPM_MASTER();
+        TRANSACTIONS_OLED_MASTER();
+        TRANSACTIONS_ST7565_MASTER();
+    }
+    TRANSACTIONS_WATCHDOG_MASTER();
+    TRANSACTIONS_HAPTIC_MASTER();
+    TRANSACTIONS_ACTIVITY_MASTER();
+    TRANSACTIONS_DETECTED_OS_MASTER();
+    return true;
+}
+
+#    ifdef SPLIT_TRANSPORT_ASYNC
+
+static bool     batch_in_flight   = false;
+static bool     batch_replied     = false;
+static bool     batch_failed      = false;
+static uint32_t batch_submit_time = 0;
+
+static void batch_completed(int8_t id, bool success) {
+#        if defined(SPLIT_TRANSACTION_STATS) || defined(SPLIT_TRANSACTION_ADAPTIVE_SYNC)
+    link_record(id, success, sizeof(batch_request.length) + batch_request.length, sizeof(batch_response), batch_submit_time);
+#        endif // defined(SPLIT_TRANSACTION_STATS) || defined(SPLIT_TRANSACTION_ADAPTIVE_SYNC)
+    TRANSACTIONS_ADAPTIVE_BATCH_COMPLETED(success);
+    batch_in_flight = false;
+    batch_replied   = success;
+    batch_failed    = !success;
+    if (success) {
+        batch_unpack_response();
+    }
+}
+
+static bool transactions_master_handlers(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    // The batch exchange runs in the background: each call picks up the response to the
+    // previous batch, if it has arrived, and submits the next one. Until then the last
+    // received slave matrix is reported.
+    static matrix_row_t last_slave_matrix[(MATRIX_ROWS) / 2] = {0};
+
+    transport_poll_transaction();
+    if (batch_in_flight) {
+        memcpy(slave_matrix, last_slave_matrix, sizeof(last_slave_matrix));
+        return true;
+    }
+
+    bool okay    = !batch_failed;
+    batch_failed = false;
+    if (batch_replied) {
+        batch_replied = false;
+        TRANSACTIONS_SLAVE_MATRIX_MASTER();
+        TRANSACTIONS_ENCODERS_MASTER();
+        TRANSACTIONS_POINTING_MASTER();
+        memcpy(last_slave_matrix, slave_matrix, sizeof(last_slave_matrix));
+    } else {
+        memcpy(slave_matrix, last_slave_matrix, sizeof(last_slave_matrix));
+    }
+    TRANSACTIONS_BATCH_END();
+
+    TRANSACTIONS_BATCH_BEGIN();
+    transactions_master_queue_writes(master_matrix, slave_matrix);
+    batch_queueing    = false;
+    TRANSACTIONS_ADAPTIVE_BATCH_SUBMITTED();
+    batch_submit_time = link_start();
+    batch_in_flight   = transport_submit_transaction(CMD_BATCH, &batch_request, sizeof(batch_request.length) + batch_request.length, &batch_response, sizeof(batch_response), batch_completed);
+    if (!batch_in_flight) {
+        // A batch that couldn't be submitted is reported along with the next one
+        batch_failed = true;
+        TRANSACTIONS_ADAPTIVE_BATCH_COMPLETED(false);
+    }
+    return okay;
+}
+
+#    else // SPLIT_TRANSPORT_ASYNC
+
+static bool transactions_master_handlers(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    // Queue every write into one frame, exchange it for the slave's data, then let the reads
+    // pick their data out of the response
+    TRANSACTIONS_BATCH_BEGIN();
+    bool okay = transactions_master_queue_writes(master_matrix, slave_matrix);
+    TRANSACTIONS_BATCH_MASTER();
+    if (okay) {
+        TRANSACTIONS_SLAVE_MATRIX_MASTER();
+        TRANSACTIONS_ENCODERS_MASTER();
+        TRANSACTIONS_POINTING_MASTER();
+    }
+    TRANSACTIONS_BATCH_END();
+    return okay;
+}
+
+#    endif // SPLIT_TRANSPORT_ASYNC
+
+#else // SPLIT_TRANSACTION_BATCHING
+
+static bool transactions_master_handlers(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
@@ -963,12 +1578,14 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_LED_STATE_MASTER();
     TRANSACTIONS_MODS_MASTER();
     TRANSACTIONS_BACKLIGHT_MASTER();
-    TRANSACTIONS_RGBLIGHT_MASTER();
-    TRANSACTIONS_LED_MATRIX_MASTER();
-    TRANSACTIONS_RGB_MATRIX_MASTER();
-    TRANSACTIONS_WPM_MASTER();
-    TRANSACTIONS_OLED_MASTER();
-    TRANSACTIONS_ST7565_MASTER();
+    if (TRANSACTIONS_LOW_PRIORITY_DUE()) {
+        TRANSACTIONS_RGBLIGHT_MASTER();
+        TRANSACTIONS_LED_MATRIX_MASTER();
+        TRANSACTIONS_RGB_MATRIX_MASTER();
+        TRANSACTIONS_WPM_MASTER();
+        TRANSACTIONS_OLED_MASTER();
+        TRANSACTIONS_ST7565_MASTER();
+    }
     TRANSACTIONS_POINTING_MASTER();
     TRANSACTIONS_WATCHDOG_MASTER();
     TRANSACTIONS_HAPTIC_MASTER();
@@ -977,6 +1594,15 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     return true;
 }
 
+#endif // SPLIT_TRANSACTION_BATCHING
+
+bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    TRANSACTIONS_ADAPTIVE_SYNC_BEGIN();
+    bool okay = transactions_master_handlers(master_matrix, slave_matrix);
+    TRANSACTIONS_ADAPTIVE_SYNC_END();
+    return okay;
+}
+
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     TRANSACTIONS_SLAVE_MATRIX_SLAVE();
     TRANSACTIONS_MASTER_MATRIX_SLAVE();
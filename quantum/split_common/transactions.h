@@ -32,8 +32,14 @@ typedef struct _split_transaction_desc_t {
     uint8_t          target2initiator_buffer_size;
     uint16_t         target2initiator_offset;
     slave_callback_t slave_callback;
+    uint8_t          flags;
 } split_transaction_desc_t;
 
+// The buffer is a frame whose first byte holds the number of bytes in use after it, only those
+// need to be transferred
+#define SPLIT_TRANS_FRAMED_INITIATOR2TARGET (1 << 0)
+#define SPLIT_TRANS_FRAMED_TARGET2INITIATOR (1 << 1)
+
 // Forward declaration for the split transactions
 extern split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS];
 
@@ -41,6 +47,14 @@ extern split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS];
 #define split_trans_initiator2target_buffer(trans) (split_shmem_offset_ptr((trans)->initiator2target_offset))
 #define split_trans_target2initiator_buffer(trans) (split_shmem_offset_ptr((trans)->target2initiator_offset))
 
+static inline uint8_t split_trans_used_length(const uint8_t *buffer, uint8_t size, bool framed) {
+    return (framed && size > 0 && buffer[0] < size) ? buffer[0] + 1 : size;
+}
+
+// Number of bytes of each buffer that need to be transferred
+#define split_trans_initiator2target_length(trans) (split_trans_used_length(split_trans_initiator2target_buffer(trans), (trans)->initiator2target_buffer_size, (trans)->flags & SPLIT_TRANS_FRAMED_INITIATOR2TARGET))
+#define split_trans_target2initiator_length(trans) (split_trans_used_length(split_trans_target2initiator_buffer(trans), (trans)->target2initiator_buffer_size, (trans)->flags & SPLIT_TRANS_FRAMED_TARGET2INITIATOR))
+
 // returns false if valid data not received from slave
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
@@ -51,3 +65,51 @@ bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer
 
 #define transaction_rpc_send(transaction_id, initiator2target_buffer_size, initiator2target_buffer) transaction_rpc_exec(transaction_id, initiator2target_buffer_size, initiator2target_buffer, 0, NULL)
 #define transaction_rpc_recv(transaction_id, target2initiator_buffer_size, target2initiator_buffer) transaction_rpc_exec(transaction_id, 0, NULL, target2initiator_buffer_size, target2initiator_buffer)
+
+#ifdef SPLIT_TRANSACTION_STATS
+
+// Round trip times are kept in microseconds, in log2 buckets: bucket N holds times whose bit
+// length, after shifting right by SPLIT_TRANSACTION_STATS_RTT_SHIFT, is N. The last bucket
+// holds the rest.
+#    define SPLIT_TRANSACTION_STATS_RTT_BUCKETS 12
+
+#    ifndef SPLIT_TRANSACTION_STATS_RTT_SHIFT
+#        define SPLIT_TRANSACTION_STATS_RTT_SHIFT 4
+#    endif
+
+#    ifndef SPLIT_TRANSACTION_STATS_RAW_HID_ID
+#        define SPLIT_TRANSACTION_STATS_RAW_HID_ID 0x52
+#    endif
+
+enum split_transaction_stats_raw_hid_command {
+    SPLIT_TRANSACTION_STATS_RAW_HID_GET_COUNTERS = 0x01,
+    SPLIT_TRANSACTION_STATS_RAW_HID_GET_RTT      = 0x02,
+    SPLIT_TRANSACTION_STATS_RAW_HID_RESET        = 0x03,
+    SPLIT_TRANSACTION_STATS_RAW_HID_PRINT        = 0x04,
+};
+
+typedef struct {
+    uint32_t attempts; // round trips started, retries included
+    uint32_t failures; // round trips that failed
+    uint32_t bytes;    // bytes transferred by successful round trips, both directions
+    uint16_t rtt_histogram[SPLIT_TRANSACTION_STATS_RTT_BUCKETS];
+} split_transaction_stats_t;
+
+/** @brief Returns the statistics of `transaction_id`, or NULL if it is out of range. */
+const split_transaction_stats_t *split_transaction_get_stats(int8_t transaction_id);
+
+/** @brief Clears the statistics of every transaction. */
+void split_transaction_stats_reset(void);
+
+/** @brief Prints the statistics of every transaction that was used over console. */
+void split_transaction_stats_print(void);
+
+/**
+ * @brief Fills in the transaction statistics requested over raw HID.
+ *
+ * Returns false for reports that don't start with SPLIT_TRANSACTION_STATS_RAW_HID_ID. Called
+ * from raw_hid_receive_quantum(), which sends back the response written over `data`.
+ */
+bool split_transaction_stats_raw_hid_receive(uint8_t *data, uint8_t length);
+
+#endif // SPLIT_TRANSACTION_STATS
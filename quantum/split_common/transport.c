@@ -87,6 +87,20 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
     return true;
 }
 
+#    ifdef SPLIT_TRANSPORT_ASYNC
+static bool async_okay = false;
+
+// I2C transfers are carried out on submission, the result is reported by the next poll
+static bool transport_start_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    async_okay = transport_execute_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+    return true;
+}
+
+static split_transport_status_t transport_transaction_status(void) {
+    return async_okay ? SPLIT_TRANSPORT_DONE : SPLIT_TRANSPORT_FAILED;
+}
+#    endif // SPLIT_TRANSPORT_ASYNC
+
 #else // USE_I2C
 
 #    include "serial.h"
@@ -101,12 +115,21 @@ void transport_slave_init(void) {
     soft_serial_target_init();
 }
 
-bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
-    split_transaction_desc_t *trans = &split_transaction_table[id];
+static void transport_stage_initiator2target(split_transaction_desc_t *trans, const void *initiator2target_buf, uint16_t initiator2target_length) {
     if (initiator2target_length > 0) {
         size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
         memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, len);
     }
+}
+
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+#    ifdef SPLIT_TRANSPORT_ASYNC
+    // The shared memory belongs to the background transaction until it completes
+    transport_wait_transaction();
+#    endif // SPLIT_TRANSPORT_ASYNC
+
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    transport_stage_initiator2target(trans, initiator2target_buf, initiator2target_length);
 
     if (!soft_serial_transaction(id)) {
         return false;
@@ -120,8 +143,88 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
     return true;
 }
 
+#    ifdef SPLIT_TRANSPORT_ASYNC
+static soft_serial_transaction_status_t blocking_status = SOFT_SERIAL_TRANSACTION_FAILED;
+
+// Serial drivers without a background transfer complete the transaction on submission
+__attribute__((weak)) bool soft_serial_transaction_start(int sstd_index) {
+    blocking_status = soft_serial_transaction(sstd_index) ? SOFT_SERIAL_TRANSACTION_SUCCESS : SOFT_SERIAL_TRANSACTION_FAILED;
+    return true;
+}
+
+__attribute__((weak)) soft_serial_transaction_status_t soft_serial_transaction_poll(void) {
+    return blocking_status;
+}
+
+static bool transport_start_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    transport_stage_initiator2target(&split_transaction_table[id], initiator2target_buf, initiator2target_length);
+    return soft_serial_transaction_start(id);
+}
+
+static split_transport_status_t transport_transaction_status(void) {
+    switch (soft_serial_transaction_poll()) {
+        case SOFT_SERIAL_TRANSACTION_PENDING:
+            return SPLIT_TRANSPORT_PENDING;
+        case SOFT_SERIAL_TRANSACTION_SUCCESS:
+            return SPLIT_TRANSPORT_DONE;
+        default:
+            return SPLIT_TRANSPORT_FAILED;
+    }
+}
+#    endif // SPLIT_TRANSPORT_ASYNC
+
 #endif // USE_I2C
 
+#ifdef SPLIT_TRANSPORT_ASYNC
+
+static struct {
+    bool                       pending;
+    int8_t                     id;
+    void                      *target2initiator_buf;
+    uint16_t                   target2initiator_length;
+    split_transport_complete_t complete;
+} async_transaction = {0};
+
+bool transport_submit_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length, split_transport_complete_t complete) {
+    transport_wait_transaction();
+
+    async_transaction.id                      = id;
+    async_transaction.target2initiator_buf    = target2initiator_buf;
+    async_transaction.target2initiator_length = target2initiator_length;
+    async_transaction.complete                = complete;
+    async_transaction.pending                 = transport_start_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+    return async_transaction.pending;
+}
+
+split_transport_status_t transport_poll_transaction(void) {
+    if (!async_transaction.pending) {
+        return SPLIT_TRANSPORT_IDLE;
+    }
+
+    split_transport_status_t status = transport_transaction_status();
+    if (status == SPLIT_TRANSPORT_PENDING) {
+        return status;
+    }
+
+    async_transaction.pending       = false;
+    split_transaction_desc_t *trans = &split_transaction_table[async_transaction.id];
+    if (status == SPLIT_TRANSPORT_DONE && async_transaction.target2initiator_length > 0) {
+        size_t len = trans->target2initiator_buffer_size < async_transaction.target2initiator_length ? trans->target2initiator_buffer_size : async_transaction.target2initiator_length;
+        memcpy(async_transaction.target2initiator_buf, split_trans_target2initiator_buffer(trans), len);
+    }
+    if (async_transaction.complete) {
+        async_transaction.complete(async_transaction.id, status == SPLIT_TRANSPORT_DONE);
+    }
+    return status;
+}
+
+void transport_wait_transaction(void) {
+    while (transport_poll_transaction() == SPLIT_TRANSPORT_PENDING) {
+    }
+}
+
+#endif // SPLIT_TRANSPORT_ASYNC
+
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     return transactions_master(master_matrix, slave_matrix);
 }
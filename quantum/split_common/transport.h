@@ -22,6 +22,7 @@
 #include "progmem.h"
 #include "action_layer.h"
 #include "matrix.h"
+#include "split_delta.h"
 
 #ifndef RPC_M2S_BUFFER_SIZE
 #    define RPC_M2S_BUFFER_SIZE 32
@@ -31,6 +32,10 @@
 #    define RPC_S2M_BUFFER_SIZE 32
 #endif // RPC_S2M_BUFFER_SIZE
 
+#ifndef SPLIT_TRANSACTION_BATCH_SIZE
+#    define SPLIT_TRANSACTION_BATCH_SIZE 64
+#endif // SPLIT_TRANSACTION_BATCH_SIZE
+
 void transport_master_init(void);
 void transport_slave_init(void);
 
@@ -40,6 +45,35 @@ void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
 bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
 
+#ifdef SPLIT_TRANSPORT_ASYNC
+typedef enum {
+    SPLIT_TRANSPORT_IDLE,    // nothing was submitted
+    SPLIT_TRANSPORT_PENDING, // the transaction is still in flight
+    SPLIT_TRANSPORT_DONE,    // the transaction completed, the response has been copied out
+    SPLIT_TRANSPORT_FAILED,  // the transaction failed
+} split_transport_status_t;
+
+typedef void (*split_transport_complete_t)(int8_t id, bool success);
+
+/**
+ * @brief Starts a transaction without waiting for it to complete.
+ *
+ * `target2initiator_buf` must stay valid until the transaction completes, at which point
+ * `complete` is called, if not NULL, from within transport_poll_transaction(). Only one
+ * transaction can be in flight, a pending one is waited for first.
+ */
+bool transport_submit_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length, split_transport_complete_t complete);
+
+/**
+ * @brief Checks on the submitted transaction. DONE and FAILED are returned once, by the
+ * poll that completes it, IDLE afterwards.
+ */
+split_transport_status_t transport_poll_transaction(void);
+
+/** @brief Waits until the submitted transaction, if any, has completed. */
+void transport_wait_transaction(void);
+#endif // SPLIT_TRANSPORT_ASYNC
+
 #ifdef ENCODER_ENABLE
 #    include "encoder.h"
 #endif // ENCODER_ENABLE
@@ -55,6 +89,10 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 typedef struct _split_slave_matrix_sync_t {
     uint8_t      checksum;
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
+#ifdef SPLIT_TRANSACTION_DELTA
+    uint8_t             delta_ack; // sequence number of the matrix the master has
+    split_delta_frame_t delta;
+#endif // SPLIT_TRANSACTION_DELTA
 } split_slave_matrix_sync_t;
 
 #ifdef SPLIT_TRANSPORT_MIRROR
@@ -147,11 +185,29 @@ typedef struct _rpc_sync_info_t {
 #    include "os_detection.h"
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+#ifdef SPLIT_TRANSACTION_BATCHING
+// A batch frame holds a sequence of records, each a transaction id followed by that
+// transaction's buffer. Only the first `length` bytes of `data` are valid.
+typedef struct _split_batch_frame_t {
+    uint8_t length;
+    uint8_t data[SPLIT_TRANSACTION_BATCH_SIZE];
+} split_batch_frame_t;
+#endif // SPLIT_TRANSACTION_BATCHING
+
 typedef struct _split_shared_memory_t {
 #ifdef USE_I2C
     int8_t transaction_id;
 #endif // USE_I2C
 
+#ifdef SPLIT_TRANSACTION_BATCHING
+    split_batch_frame_t batch_request;
+    split_batch_frame_t batch_response;
+#endif // SPLIT_TRANSACTION_BATCHING
+
+#ifdef SPLIT_TRANSACTION_DELTA
+    split_delta_frame_t delta_put; // shared by every delta-encoded master to slave transaction
+#endif // SPLIT_TRANSACTION_DELTA
+
     split_slave_matrix_sync_t smatrix;
 
 #ifdef SPLIT_TRANSPORT_MIRROR
@@ -0,0 +1,159 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "task_profiling.h"
+#include <string.h>
+#include "debug.h"
+#include "timer.h"
+#include "util.h"
+#include "raw_hid.h"
+
+// One bucket per bit length of the sample, so bucket N holds samples in [2^(N-1), 2^N)
+#define TASK_PROFILING_BUCKETS 33
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint16_t histogram[TASK_PROFILING_BUCKETS];
+} task_profiling_stage_data_t;
+
+static task_profiling_stage_data_t stages[TASK_PROFILING_STAGE_COUNT];
+
+static const char *const stage_names[TASK_PROFILING_STAGE_COUNT] = {
+    [TASK_PROFILING_MATRIX]          = "matrix",
+    [TASK_PROFILING_QUANTUM]         = "quantum",
+    [TASK_PROFILING_RGB_MATRIX]      = "rgb_matrix",
+    [TASK_PROFILING_ENCODER]         = "encoder",
+    [TASK_PROFILING_POINTING_DEVICE] = "pointing_device",
+    [TASK_PROFILING_OLED]            = "oled",
+    [TASK_PROFILING_HOUSEKEEPING]    = "housekeeping",
+};
+
+static uint8_t bucket_for(uint32_t us) {
+    uint8_t bucket = 0;
+    while (us) {
+        us >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+void task_profiling_record(task_profiling_stage_t stage, uint32_t us) {
+    task_profiling_stage_data_t *data = &stages[stage];
+
+    if (data->count == 0 || us < data->min) {
+        data->min = us;
+    }
+    if (us > data->max) {
+        data->max = us;
+    }
+    data->count++;
+    data->sum += us;
+
+    uint16_t *bucket = &data->histogram[bucket_for(us)];
+    if (*bucket == UINT16_MAX) {
+        // Halve the whole histogram to keep the distribution while making room
+        for (uint8_t i = 0; i < TASK_PROFILING_BUCKETS; i++) {
+            data->histogram[i] >>= 1;
+        }
+    }
+    (*bucket)++;
+}
+
+static uint32_t percentile_99(const task_profiling_stage_data_t *data) {
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < TASK_PROFILING_BUCKETS; i++) {
+        total += data->histogram[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    uint32_t target     = total - total / 100;
+    uint32_t cumulative = 0;
+    uint8_t  bucket     = 0;
+    for (; bucket < TASK_PROFILING_BUCKETS - 1; bucket++) {
+        cumulative += data->histogram[bucket];
+        if (cumulative >= target) {
+            break;
+        }
+    }
+
+    // Report the upper edge of the bucket, bounded by what was actually seen
+    uint32_t upper = bucket == 0 ? 0 : (bucket >= 32 ? UINT32_MAX : (((uint32_t)1 << bucket) - 1));
+    return MAX(MIN(upper, data->max), data->min);
+}
+
+bool task_profiling_get_stats(task_profiling_stage_t stage, task_profiling_stats_t *stats) {
+    if (stage >= TASK_PROFILING_STAGE_COUNT) {
+        return false;
+    }
+
+    const task_profiling_stage_data_t *data = &stages[stage];
+
+    stats->count = data->count;
+    stats->min   = data->min;
+    stats->max   = data->max;
+    stats->avg   = data->count ? (uint32_t)(data->sum / data->count) : 0;
+    stats->p99   = percentile_99(data);
+    return true;
+}
+
+const char *task_profiling_stage_name(task_profiling_stage_t stage) {
+    return stage < TASK_PROFILING_STAGE_COUNT ? stage_names[stage] : "";
+}
+
+void task_profiling_reset(void) {
+    memset(stages, 0, sizeof(stages));
+}
+
+void task_profiling_print(void) {
+    for (uint8_t stage = 0; stage < TASK_PROFILING_STAGE_COUNT; stage++) {
+        task_profiling_stats_t stats;
+        task_profiling_get_stats(stage, &stats);
+        if (stats.count == 0) {
+            continue;
+        }
+        dprintf("%s: n=%lu min=%lu avg=%lu max=%lu p99=%lu\n", stage_names[stage], (unsigned long)stats.count, (unsigned long)stats.min, (unsigned long)stats.avg, (unsigned long)stats.max, (unsigned long)stats.p99);
+    }
+}
+
+bool task_profiling_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 4 || data[0] != TASK_PROFILING_RAW_HID_ID) {
+        return false;
+    }
+
+    // Request:  [id, command, stage]
+    // Response: [id, command, stage, status, count, min, avg, max, p99], values as little endian uint32
+    uint8_t *status = &data[3];
+    switch (data[1]) {
+        case TASK_PROFILING_RAW_HID_GET_STATS: {
+            task_profiling_stats_t stats;
+            if (length < 4 + 5 * sizeof(uint32_t) || !task_profiling_get_stats(data[2], &stats)) {
+                *status = 1;
+                break;
+            }
+            *status = 0;
+            raw_hid_write_u32(&data[4], stats.count);
+            raw_hid_write_u32(&data[8], stats.min);
+            raw_hid_write_u32(&data[12], stats.avg);
+            raw_hid_write_u32(&data[16], stats.max);
+            raw_hid_write_u32(&data[20], stats.p99);
+            break;
+        }
+        case TASK_PROFILING_RAW_HID_RESET:
+            task_profiling_reset();
+            *status = 0;
+            break;
+        case TASK_PROFILING_RAW_HID_PRINT:
+            task_profiling_print();
+            *status = 0;
+            break;
+        default:
+            *status = 1;
+            break;
+    }
+    return true;
+}
@@ -0,0 +1,84 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "timer.h"
+
+/*
+    Per-stage timing statistics for keyboard_task(), enabled with `TASK_PROFILING_ENABLE = yes`.
+
+    Each stage records min/avg/max and a log2 histogram of the microseconds spent in it, as
+    measured by timer_read_fine(), from which an approximate 99th percentile is derived. When disabled, the instrumentation macros
+    compile to nothing.
+*/
+
+typedef enum {
+    TASK_PROFILING_MATRIX,
+    TASK_PROFILING_QUANTUM,
+    TASK_PROFILING_RGB_MATRIX,
+    TASK_PROFILING_ENCODER,
+    TASK_PROFILING_POINTING_DEVICE,
+    TASK_PROFILING_OLED,
+    TASK_PROFILING_HOUSEKEEPING,
+    TASK_PROFILING_STAGE_COUNT,
+} task_profiling_stage_t;
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t avg;
+    uint32_t max;
+    uint32_t p99;
+} task_profiling_stats_t;
+
+#ifndef TASK_PROFILING_RAW_HID_ID
+#    define TASK_PROFILING_RAW_HID_ID 0x50
+#endif
+
+enum task_profiling_raw_hid_command {
+    TASK_PROFILING_RAW_HID_GET_STATS = 0x01,
+    TASK_PROFILING_RAW_HID_RESET     = 0x02,
+    TASK_PROFILING_RAW_HID_PRINT     = 0x03,
+};
+
+#ifdef TASK_PROFILING_ENABLE
+
+/** @brief Adds one sample of `us` microseconds to `stage`. */
+void task_profiling_record(task_profiling_stage_t stage, uint32_t us);
+
+/** @brief Fills `stats` for `stage`. Returns false if the stage is out of range. */
+bool task_profiling_get_stats(task_profiling_stage_t stage, task_profiling_stats_t *stats);
+
+/** @brief Returns the printable name of `stage`. */
+const char *task_profiling_stage_name(task_profiling_stage_t stage);
+
+/** @brief Clears the statistics of every stage. */
+void task_profiling_reset(void);
+
+/** @brief Prints the statistics of every stage over console. */
+void task_profiling_print(void);
+
+/**
+ * @brief Handles a profiling request received over raw HID, writing the response into `data`.
+ *
+ * raw_hid_receive_quantum() offers every incoming report to this first, and sends `data` back
+ * when it returns true.
+ */
+bool task_profiling_raw_hid_receive(uint8_t *data, uint8_t length);
+
+#    define TASK_PROFILING_START(stage) const uint32_t task_profiling_start_##stage = timer_read_fine()
+#    define TASK_PROFILING_STOP(stage) task_profiling_record((stage), timer_fine_to_us(TIMER_DIFF_32(timer_read_fine(), task_profiling_start_##stage)))
+
+#else
+
+#    define TASK_PROFILING_START(stage) \
+        do {                            \
+        } while (0)
+#    define TASK_PROFILING_STOP(stage) \
+        do {                           \
+        } while (0)
+
+#endif // TASK_PROFILING_ENABLE
@@ -64,3 +64,15 @@ wear_leveling_8byte_SRC := \
 	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_8byte.cpp
 wear_leveling_8byte_INC := \
 	$(wear_leveling_common_INC)
+
+wear_leveling_checkpoint_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=16384 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=1024 \
+	-DWEAR_LEVELING_CHECKPOINT_INTERVAL=1024
+wear_leveling_checkpoint_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_checkpoint.cpp
+wear_leveling_checkpoint_INC := \
+	$(wear_leveling_common_INC)
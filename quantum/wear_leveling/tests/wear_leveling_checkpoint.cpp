@@ -0,0 +1,213 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <random>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+// The number of bytes of write log available after the consolidated data and checkpoint index
+using LOG_CAPACITY = std::integral_constant<std::size_t, (WEAR_LEVELING_BACKING_SIZE - WEAR_LEVELING_LOG_START)>;
+
+class WearLevelingCheckpoint : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+        rng.seed(0x1234);
+        wear_leveling_init();
+    }
+
+    // Writes random data to a random location, as a single multibyte log entry
+    void write_random(void) {
+        std::uniform_int_distribution<uint32_t> address_dist(64, WEAR_LEVELING_LOGICAL_SIZE - LOG_ENTRY_MULTIBYTE_MAX_BYTES);
+        std::uniform_int_distribution<uint32_t> byte_dist(2, 255);
+        uint8_t                                 value[LOG_ENTRY_MULTIBYTE_MAX_BYTES];
+        for (auto& v : value) {
+            v = byte_dist(rng);
+        }
+        test_write(address_dist(rng), value, sizeof(value));
+    }
+
+    // Writes random data until the write log of a freshly reset backing store reaches the supplied fill level, stopping short of consolidation
+    void fill_log(double fraction) {
+        auto&               inst          = MockBackingStore::Instance();
+        const std::uint64_t target_writes = (std::uint64_t)(fraction * LOG_CAPACITY::value / BACKING_STORE_WRITE_SIZE);
+        while (inst.total_write_count() < target_writes && inst.erasure_count() == 0) {
+            write_random();
+        }
+    }
+
+    wear_leveling_status_t test_write(uint32_t address, const void* value, size_t length) {
+        memcpy(&verify_data[address], value, length);
+        return wear_leveling_write(address, value, length);
+    }
+
+    void expect_data_matches(void) {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> actual;
+        EXPECT_EQ(wear_leveling_read(0, actual.data(), actual.size()), WEAR_LEVELING_SUCCESS);
+        EXPECT_TRUE(actual == verify_data) << "Logical data does not match what was written";
+    }
+
+    static uint32_t index_entry(uint16_t index) {
+        auto&             inst = MockBackingStore::Instance();
+        write_log_entry_t entry{.raw64 = 0};
+        for (std::size_t i = 0; i < WEAR_LEVELING_CHECKPOINT_INDEX_ENTRY_SIZE / BACKING_STORE_WRITE_SIZE && i * sizeof(backing_store_int_t) < 4; ++i) {
+            inst.read(WEAR_LEVELING_LOGICAL_SIZE + 8 + index * WEAR_LEVELING_CHECKPOINT_INDEX_ENTRY_SIZE + i * BACKING_STORE_WRITE_SIZE, ((backing_store_int_t*)entry.raw8)[i]);
+        }
+        return entry.raw32[0];
+    }
+
+    static uint16_t used_index_entries(void) {
+        uint16_t used = 0;
+        while (used < WEAR_LEVELING_CHECKPOINT_INDEX_ENTRIES && index_entry(used) != 0) {
+            ++used;
+        }
+        return used;
+    }
+
+    // Replaces a value in the backing store, as if it had been corrupted
+    static void corrupt(uint32_t address, backing_store_int_t value) {
+        auto& element = MockBackingStore::Instance().storage_begin()[address / BACKING_STORE_WRITE_SIZE];
+        element.erase();
+        if (value != 0) {
+            element.set(~value);
+        }
+    }
+
+    static std::uint64_t reads_during_init(void) {
+        auto&         inst  = MockBackingStore::Instance();
+        std::uint64_t start = inst.read_invoke_count();
+        EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED);
+        return inst.read_invoke_count() - start;
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+    std::mt19937                                         rng;
+};
+
+/**
+ * This test verifies that checkpoints are indexed at the configured interval.
+ */
+TEST_F(WearLevelingCheckpoint, CheckpointsAreIndexed) {
+    EXPECT_EQ(used_index_entries(), 0) << "Fresh backing store should not have checkpoints";
+
+    fill_log(0.9);
+    uint16_t used = used_index_entries();
+    EXPECT_GT(used, 1) << "Expected several checkpoints";
+    for (uint16_t i = 0; i < used; ++i) {
+        uint32_t address = index_entry(i);
+        EXPECT_GE(address, WEAR_LEVELING_LOG_START) << "Checkpoint " << i << " is outside the write log";
+        EXPECT_LE(address + WEAR_LEVELING_CHECKPOINT_SIZE, WEAR_LEVELING_BACKING_SIZE) << "Checkpoint " << i << " is outside the write log";
+        if (i > 0) {
+            EXPECT_GE(address - index_entry(i - 1), WEAR_LEVELING_CHECKPOINT_SIZE + WEAR_LEVELING_CHECKPOINT_INTERVAL) << "Checkpoint " << i << " is too close to the previous one";
+        }
+    }
+}
+
+/**
+ * This test verifies that reinitialising restores the same data, from any point in the write log.
+ */
+TEST_F(WearLevelingCheckpoint, ReinitRestoresData) {
+    for (double fraction : {0.05, 0.2, 0.5, 0.8, 0.95}) {
+        fill_log(fraction);
+        EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED);
+        expect_data_matches();
+    }
+}
+
+/**
+ * This test verifies that init only plays back the write log after the latest checkpoint.
+ */
+TEST_F(WearLevelingCheckpoint, InitSkipsLogBeforeCheckpoint) {
+    fill_log(0.9);
+    ASSERT_GT(used_index_entries(), 0);
+
+    std::uint64_t reads = reads_during_init();
+    expect_data_matches();
+    EXPECT_LT(reads, (WEAR_LEVELING_CHECKPOINT_SIZE + WEAR_LEVELING_CHECKPOINT_INTERVAL) / BACKING_STORE_WRITE_SIZE + 64) << "Init read more than the latest checkpoint and the log after it";
+}
+
+/**
+ * This test verifies that an index entry cut short by power loss is ignored, and not written to again.
+ */
+TEST_F(WearLevelingCheckpoint, TornIndexEntryFallsBackToPreviousCheckpoint) {
+    fill_log(0.6);
+    uint16_t used = used_index_entries();
+    ASSERT_GT(used, 1);
+
+    // Only the first half of the latest entry made it
+    corrupt(WEAR_LEVELING_LOGICAL_SIZE + 8 + (used - 1) * WEAR_LEVELING_CHECKPOINT_INDEX_ENTRY_SIZE + BACKING_STORE_WRITE_SIZE, 0);
+    corrupt(WEAR_LEVELING_LOGICAL_SIZE + 8 + (used - 1) * WEAR_LEVELING_CHECKPOINT_INDEX_ENTRY_SIZE, 0x7FFF);
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED);
+    expect_data_matches();
+
+    // Further checkpoints go into the next entry -- the mock fails any write to a location that isn't erased
+    fill_log(0.9);
+    EXPECT_GT(used_index_entries(), used);
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED);
+    expect_data_matches();
+}
+
+/**
+ * This test verifies that checkpoints that don't match their checksum are ignored in favour of the whole write log.
+ */
+TEST_F(WearLevelingCheckpoint, CorruptCheckpointsFallBackToFullPlayback) {
+    fill_log(0.6);
+    uint16_t used = used_index_entries();
+    ASSERT_GT(used, 0);
+    for (uint16_t i = 0; i < used; ++i) {
+        corrupt(index_entry(i) + BACKING_STORE_WRITE_SIZE + 100, 0x5A5A);
+    }
+
+    std::uint64_t reads = reads_during_init();
+    expect_data_matches();
+    EXPECT_GT(reads, (WEAR_LEVELING_LOGICAL_SIZE + LOG_CAPACITY::value / 2) / BACKING_STORE_WRITE_SIZE) << "Init should have played back the whole write log";
+}
+
+/**
+ * This test verifies that consolidation clears the checkpoint index along with the write log.
+ */
+TEST_F(WearLevelingCheckpoint, ConsolidationClearsCheckpoints) {
+    auto& inst = MockBackingStore::Instance();
+    while (inst.erasure_count() == 0) {
+        write_random();
+    }
+    EXPECT_EQ(used_index_entries(), 0) << "Checkpoints should have been erased";
+
+    for (int i = 0; i < 1000 && used_index_entries() == 0; ++i) {
+        write_random();
+    }
+    EXPECT_GT(used_index_entries(), 0) << "Checkpoints should resume after consolidation";
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED);
+    expect_data_matches();
+}
+
+/**
+ * This test verifies that init reads stay bounded by the latest checkpoint as the write log fills, while playing back the whole log keeps growing.
+ */
+TEST_F(WearLevelingCheckpoint, InitReadsStayBoundedAsLogFills) {
+    auto&         inst          = MockBackingStore::Instance();
+    std::uint64_t previous_full = 0;
+    for (int percent = 0; percent <= 90; percent += 10) {
+        inst.reset_instance();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+        wear_leveling_init();
+        fill_log(percent / 100.0);
+
+        std::uint64_t checkpoint_reads = reads_during_init();
+        expect_data_matches();
+
+        // Without the index, init has to fall back to the consolidated data and the whole log
+        for (uint32_t address = WEAR_LEVELING_LOGICAL_SIZE + 8; address < WEAR_LEVELING_LOG_START; address += BACKING_STORE_WRITE_SIZE) {
+            corrupt(address, 0);
+        }
+        std::uint64_t full_reads = reads_during_init();
+        expect_data_matches();
+
+        EXPECT_LT(checkpoint_reads, (WEAR_LEVELING_CHECKPOINT_SIZE + WEAR_LEVELING_CHECKPOINT_INTERVAL + WEAR_LEVELING_CHECKPOINT_INDEX_SIZE) / BACKING_STORE_WRITE_SIZE + 64) << "At " << percent << "% fill";
+        EXPECT_LE(checkpoint_reads, full_reads + WEAR_LEVELING_CHECKPOINT_INDEX_SIZE / BACKING_STORE_WRITE_SIZE) << "At " << percent << "% fill";
+        EXPECT_GE(full_reads, previous_full) << "At " << percent << "% fill";
+        previous_full = full_reads;
+    }
+    EXPECT_GT(previous_full, 4 * (WEAR_LEVELING_LOGICAL_SIZE / BACKING_STORE_WRITE_SIZE)) << "A nearly full log should take several times longer to play back";
+}
@@ -62,12 +62,18 @@
             to other subsystems performing reads/writes. This must be a multiple
             of the write size.
 
+        - WEAR_LEVELING_CHECKPOINT_INTERVAL: The number of bytes of write log
+            after which a checkpoint is appended. Zero (the default) disables
+            checkpoints. Changing this changes the layout of the backing store.
+
     General algorithm:
 
         During initialization:
             * The contents of the consolidated data section are read into cache.
             * The contents of the write log are "played back" and update the
                 cache accordingly.
+            * If checkpoints are enabled, the latest checkpoint is read into
+                cache instead, and only the write log after it is played back.
 
         During reads:
             * Logical data is served from the cache.
@@ -76,6 +82,8 @@
             * The cache is updated with the new data.
             * A new write log entry is appended to the log.
             * If the log's full, data is consolidated and the write log cleared.
+            * If checkpoints are enabled and enough has been logged since the
+                last one, a checkpoint is appended to the log.
 
     Write log structure:
 
@@ -154,7 +162,31 @@
         ║  │Address >> 1 ║
         ║  └── Value: 1  ║
         ╚════════════════╝
-        0 <= Address <= 0x3FFE (16382) */
+        0 <= Address <= 0x3FFE (16382)
+
+    Checkpoints:
+
+        A checkpoint is a copy of the cache at a point in the write log, so that
+        playback can start from it rather than the start of the log. It is a
+        log entry of type 0x03, padded to the backing store write size, followed
+        by the logical data and its FNV1a_64:
+
+        ╔ Checkpoint ══════════════════════════════════════════╗
+        ║11000000║(padding)║Logical data........║FNV1a_64 (8 B)║
+        ╚════════╩═════════╩════════════════════╩══════════════╝
+
+        Playback skips over checkpoints it comes across, as the log before them
+        has already produced the same data.
+
+        To find the latest checkpoint without playing back the log, an index is
+        kept between the consolidated data's FNV1a_64 and the start of the log.
+        Each index entry is the 32-bit address of a checkpoint, and is written
+        only after the checkpoint itself is complete. Index entries use 4 bytes,
+        or a single write for 8-byte backing stores. The index holds as many
+        entries as could fit checkpoints into the write log.
+
+        On init, the latest index entry with an intact checkpoint is used. If
+        there isn't one, the consolidated data and the whole log are used. */
 
 /**
  * Storage area for the wear-leveling cache.
@@ -163,6 +195,10 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
     bool                                                           unlocked;
+#if WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+    uint32_t checkpoint_end;   // where the write log following the latest checkpoint starts
+    uint16_t checkpoint_count; // the number of checkpoint index entries used
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
 } wear_leveling;
 
 /**
@@ -203,7 +239,48 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
  */
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+    wear_leveling.write_address = WEAR_LEVELING_LOG_START;
+}
+
+/**
+ * Resets the checkpoint state, for when the write log is empty.
+ */
+static inline void wear_leveling_clear_checkpoints(void) {
+#if WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+    wear_leveling.checkpoint_end   = WEAR_LEVELING_LOG_START;
+    wear_leveling.checkpoint_count = 0;
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+}
+
+/**
+ * Reads a FNV1a_64 result from the backing store.
+ */
+static bool wear_leveling_read_hash(uint32_t address, uint64_t *hash) {
+    write_log_entry_t entry;
+#if BACKING_STORE_WRITE_SIZE == 2
+    bool ok = backing_store_read_bulk(address, entry.raw16, 4);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    bool ok = backing_store_read_bulk(address, entry.raw32, 2);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    bool ok = backing_store_read(address, &entry.raw64);
+#endif
+    *hash = entry.raw64;
+    return ok;
+}
+
+/**
+ * Writes a FNV1a_64 result to the backing store.
+ */
+static bool wear_leveling_write_hash(uint32_t address, uint64_t hash) {
+    write_log_entry_t entry;
+    entry.raw64 = hash;
+#if BACKING_STORE_WRITE_SIZE == 2
+    return backing_store_write_bulk(address, entry.raw16, 4);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    return backing_store_write_bulk(address, entry.raw32, 2);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    return backing_store_write(address, entry.raw64);
+#endif
 }
 
 /**
@@ -221,19 +298,13 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
 
     // Verify the FNV1a_64 result
     if (status != WEAR_LEVELING_FAILED) {
-        uint64_t          expected = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
-        write_log_entry_t entry;
+        uint64_t expected = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
+        uint64_t actual   = 0;
         wl_dprintf("Reading checksum\n");
-#if BACKING_STORE_WRITE_SIZE == 2
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4);
-#elif BACKING_STORE_WRITE_SIZE == 4
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2);
-#elif BACKING_STORE_WRITE_SIZE == 8
-        backing_store_read((WEAR_LEVELING_LOGICAL_SIZE) + 0, &entry.raw64);
-#endif
+        wear_leveling_read_hash((WEAR_LEVELING_LOGICAL_SIZE), &actual);
         // If we have a mismatch, clear the cache but do not flag a failure,
         // which will cater for the completely clean MCU case.
-        if (entry.raw64 == expected) {
+        if (actual == expected) {
             wl_dprintf("Checksum matches, consolidated data is correct\n");
         } else {
             wl_dprintf("Checksum mismatch, clearing cache\n");
@@ -266,27 +337,10 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
 
     if (status != WEAR_LEVELING_FAILED) {
         // Write out the FNV1a_64 result of the consolidated data
-        write_log_entry_t entry;
-        entry.raw64 = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
         wl_dprintf("Writing checksum\n");
-        do {
-#if BACKING_STORE_WRITE_SIZE == 2
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 4
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 8
-            if (!backing_store_write((WEAR_LEVELING_LOGICAL_SIZE), entry.raw64)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#endif
-        } while (0);
+        if (!wear_leveling_write_hash((WEAR_LEVELING_LOGICAL_SIZE), fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT))) {
+            status = WEAR_LEVELING_FAILED;
+        }
     }
 
     if (lock_status == STATUS_SUCCESS) {
@@ -317,7 +371,8 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
     }
 
     // Next write of the log occurs after the consolidated values at the start of the backing store.
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    wear_leveling.write_address = WEAR_LEVELING_LOG_START;
+    wear_leveling_clear_checkpoints();
 
     return status;
 }
@@ -470,15 +525,165 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     return status;
 }
 
+#if WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
 /**
- * "Replays" the write log from the backing store, updating the local cache with updated values.
+ * Location of a checkpoint index entry.
  */
-static wear_leveling_status_t wear_leveling_playback_log(void) {
+static inline uint32_t wear_leveling_checkpoint_index_address(uint16_t index) {
+    return (WEAR_LEVELING_LOGICAL_SIZE) + 8 + ((uint32_t)index * (WEAR_LEVELING_CHECKPOINT_INDEX_ENTRY_SIZE));
+}
+
+/**
+ * Reads a checkpoint index entry, giving the address of the checkpoint, or zero if the entry is unused.
+ */
+static bool wear_leveling_read_checkpoint_index(uint16_t index, uint32_t *checkpoint_address) {
+    write_log_entry_t entry   = {.raw64 = 0};
+    uint32_t          address = wear_leveling_checkpoint_index_address(index);
+#    if BACKING_STORE_WRITE_SIZE == 2
+    bool ok = backing_store_read_bulk(address, entry.raw16, 2);
+#    elif BACKING_STORE_WRITE_SIZE == 4
+    bool ok = backing_store_read(address, &entry.raw32[0]);
+#    elif BACKING_STORE_WRITE_SIZE == 8
+    bool ok = backing_store_read(address, &entry.raw64);
+#    endif
+    *checkpoint_address = entry.raw32[0];
+    return ok;
+}
+
+/**
+ * Reads the checkpoint at the supplied address into the cache.
+ *
+ * @return false if there isn't an intact checkpoint there, in which case the cache contents are undefined
+ */
+static bool wear_leveling_read_checkpoint(uint32_t address) {
+    if (address < WEAR_LEVELING_LOG_START || address % (BACKING_STORE_WRITE_SIZE) != 0 || address + (WEAR_LEVELING_CHECKPOINT_SIZE) > (WEAR_LEVELING_BACKING_SIZE)) {
+        return false;
+    }
+
+    write_log_entry_t log = {.raw64 = 0};
+#    if BACKING_STORE_WRITE_SIZE == 2
+    bool ok = backing_store_read(address, &log.raw16[0]);
+#    elif BACKING_STORE_WRITE_SIZE == 4
+    bool ok = backing_store_read(address, &log.raw32[0]);
+#    elif BACKING_STORE_WRITE_SIZE == 8
+    bool ok = backing_store_read(address, &log.raw64);
+#    endif
+    if (!ok || LOG_ENTRY_GET_TYPE(log) != LOG_ENTRY_TYPE_CHECKPOINT) {
+        return false;
+    }
+
+    address += (BACKING_STORE_WRITE_SIZE);
+    if (!backing_store_read_bulk(address, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+        return false;
+    }
+
+    uint64_t hash = 0;
+    if (!wear_leveling_read_hash(address + (WEAR_LEVELING_LOGICAL_SIZE), &hash)) {
+        return false;
+    }
+    return hash == fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
+}
+
+/**
+ * Loads the latest intact checkpoint into the cache.
+ *
+ * @return the address of the write log following the checkpoint, or zero if there's no usable checkpoint
+ */
+static uint32_t wear_leveling_load_checkpoint(void) {
+    wl_dprintf("Reading checkpoint index\n");
+    wear_leveling.checkpoint_end = WEAR_LEVELING_LOG_START;
+
+    // Index entries are used in order, so the latest is the last nonzero one
+    uint16_t used = 0;
+    uint32_t address;
+    while (used < (WEAR_LEVELING_CHECKPOINT_INDEX_ENTRIES)) {
+        if (!wear_leveling_read_checkpoint_index(used, &address)) {
+            // Not knowing which entries are free, stop adding checkpoints until the next consolidation
+            wl_dprintf("Failed to read checkpoint index\n");
+            wear_leveling.checkpoint_count = (WEAR_LEVELING_CHECKPOINT_INDEX_ENTRIES);
+            return 0;
+        }
+        if (address == 0) {
+            break;
+        }
+        ++used;
+    }
+    wear_leveling.checkpoint_count = used;
+
+    // Power may have been lost partway through writing the latest index entry, so fall back to earlier ones
+    while (used > 0) {
+        if (wear_leveling_read_checkpoint_index(--used, &address) && wear_leveling_read_checkpoint(address)) {
+            wl_dprintf("Loaded checkpoint at 0x%04X\n", (int)address);
+            wear_leveling.checkpoint_end = address + (WEAR_LEVELING_CHECKPOINT_SIZE);
+            return wear_leveling.checkpoint_end;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Appends a checkpoint to the write log if enough has been logged since the last one, so that later playback can start
+ * from it. Skipped if the write log is too full to fit one, as consolidation is due first.
+ */
+static wear_leveling_status_t wear_leveling_checkpoint_if_needed(void) {
+    if (wear_leveling.write_address - wear_leveling.checkpoint_end < (WEAR_LEVELING_CHECKPOINT_INTERVAL) || wear_leveling.checkpoint_count >= (WEAR_LEVELING_CHECKPOINT_INDEX_ENTRIES) || wear_leveling.write_address + (WEAR_LEVELING_CHECKPOINT_SIZE) > (WEAR_LEVELING_BACKING_SIZE)) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    const uint32_t address = wear_leveling.write_address;
+    wl_dprintf("Writing checkpoint at 0x%04X\n", (int)address);
+
+    // Once the marker is written, playback steps over the whole checkpoint whether or not the rest makes it
+    write_log_entry_t log = LOG_ENTRY_MAKE_CHECKPOINT();
+#    if BACKING_STORE_WRITE_SIZE == 2
+    bool ok = backing_store_write(address, log.raw16[0]);
+#    elif BACKING_STORE_WRITE_SIZE == 4
+    bool ok = backing_store_write(address, log.raw32[0]);
+#    elif BACKING_STORE_WRITE_SIZE == 8
+    bool ok = backing_store_write(address, log.raw64);
+#    endif
+    if (!ok) {
+        wl_dprintf("Failed to write to backing store\n");
+        return WEAR_LEVELING_FAILED;
+    }
+    wear_leveling.write_address += (WEAR_LEVELING_CHECKPOINT_SIZE);
+    wear_leveling.checkpoint_end = wear_leveling.write_address;
+
+    ok = backing_store_write_bulk(address + (BACKING_STORE_WRITE_SIZE), (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t));
+    ok = ok && wear_leveling_write_hash(address + (BACKING_STORE_WRITE_SIZE) + (WEAR_LEVELING_LOGICAL_SIZE), fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT));
+
+    // Only a complete checkpoint gets an index entry
+    if (ok) {
+        write_log_entry_t entry         = {.raw64 = 0};
+        entry.raw32[0]                  = address;
+        uint32_t          index_address = wear_leveling_checkpoint_index_address(wear_leveling.checkpoint_count++);
+#    if BACKING_STORE_WRITE_SIZE == 2
+        ok = backing_store_write_bulk(index_address, entry.raw16, 2);
+#    elif BACKING_STORE_WRITE_SIZE == 4
+        ok = backing_store_write(index_address, entry.raw32[0]);
+#    elif BACKING_STORE_WRITE_SIZE == 8
+        ok = backing_store_write(index_address, entry.raw64);
+#    endif
+    }
+
+    if (!ok) {
+        wl_dprintf("Failed to write checkpoint\n");
+        return WEAR_LEVELING_FAILED;
+    }
+
+    return wear_leveling_consolidate_if_needed();
+}
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+
+/**
+ * "Replays" the write log from the backing store, starting at the supplied address, updating the local cache with updated values.
+ */
+static wear_leveling_status_t wear_leveling_playback_log(uint32_t address) {
     wl_dprintf("Playback write log\n");
 
     wear_leveling_status_t status          = WEAR_LEVELING_SUCCESS;
     bool                   cancel_playback = false;
-    uint32_t               address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
     while (!cancel_playback && address < (WEAR_LEVELING_BACKING_SIZE)) {
         backing_store_int_t value;
         bool                ok = backing_store_read(address, &value);
@@ -591,6 +796,19 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 wear_leveling.cache[a + 1] = 0;
             } break;
 #endif // BACKING_STORE_WRITE_SIZE == 2
+#if WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+            case LOG_ENTRY_TYPE_CHECKPOINT: {
+                // The log before a checkpoint has already produced the same data, so step over it
+                address += (WEAR_LEVELING_CHECKPOINT_SIZE) - (BACKING_STORE_WRITE_SIZE);
+                if (address > (WEAR_LEVELING_BACKING_SIZE)) {
+                    cancel_playback = true;
+                    status          = WEAR_LEVELING_FAILED;
+                    break;
+                }
+
+                wear_leveling.checkpoint_end = address;
+            } break;
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
             default: {
                 cancel_playback = true;
                 status          = WEAR_LEVELING_FAILED;
@@ -629,14 +847,24 @@ wear_leveling_status_t wear_leveling_init(void) {
     }
 
     // Read the previous consolidated values, then replay the existing write log so that the cache has the "live" values
-    wear_leveling_status_t status = wear_leveling_read_consolidated();
-    if (status == WEAR_LEVELING_FAILED) {
-        // If it failed, clear the cache and return with failure
-        wear_leveling_clear_cache();
-        return status;
+    wear_leveling_status_t status           = WEAR_LEVELING_SUCCESS;
+    uint32_t               playback_address = 0;
+    wear_leveling_clear_checkpoints();
+#if WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+    // The latest checkpoint already includes everything logged before it
+    playback_address = wear_leveling_load_checkpoint();
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+    if (playback_address == 0) {
+        playback_address = WEAR_LEVELING_LOG_START;
+        status           = wear_leveling_read_consolidated();
+        if (status == WEAR_LEVELING_FAILED) {
+            // If it failed, clear the cache and return with failure
+            wear_leveling_clear_cache();
+            return status;
+        }
     }
 
-    status = wear_leveling_playback_log();
+    status = wear_leveling_playback_log(playback_address);
     if (status == WEAR_LEVELING_FAILED) {
         // If it failed, clear the cache and return with failure
         wear_leveling_clear_cache();
@@ -663,6 +891,7 @@ wear_leveling_status_t wear_leveling_erase(void) {
     // Perform the erase
     bool ret = backing_store_erase();
     wear_leveling_clear_cache();
+    wear_leveling_clear_checkpoints();
 
     // Lock the backing store if we acquired the lock successfully
     if (lock_status == STATUS_SUCCESS) {
@@ -710,6 +939,11 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
         case WEAR_LEVELING_SUCCESS:
             // Consolidate the cache + write log if required
             status = wear_leveling_consolidate_if_needed();
+#if WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+            if (status == WEAR_LEVELING_SUCCESS) {
+                status = wear_leveling_checkpoint_if_needed();
+            }
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
             break;
 
         default:
@@ -59,11 +59,31 @@ typedef uint64_t backing_store_int_t;
         } while (0)
 #endif // WEAR_LEVELING_ASSERTS
 
+#ifndef WEAR_LEVELING_CHECKPOINT_INTERVAL
+#    define WEAR_LEVELING_CHECKPOINT_INTERVAL 0
+#endif
+
 // Compile-time validation of configurable options
 STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "Total backing size must be at least twice the size of the logical size");
 STATIC_ASSERT(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
 
+#if WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+// A checkpoint is a log entry marker, followed by a copy of the logical data and its FNV1a_64
+#    define WEAR_LEVELING_CHECKPOINT_SIZE ((BACKING_STORE_WRITE_SIZE) + (WEAR_LEVELING_LOGICAL_SIZE) + 8)
+// Each checkpoint index entry holds a 32-bit address, using at least one backing store write
+#    define WEAR_LEVELING_CHECKPOINT_INDEX_ENTRY_SIZE ((BACKING_STORE_WRITE_SIZE) > 4 ? (BACKING_STORE_WRITE_SIZE) : 4)
+// The most checkpoints the write log could ever hold
+#    define WEAR_LEVELING_CHECKPOINT_INDEX_ENTRIES (((WEAR_LEVELING_BACKING_SIZE) - (WEAR_LEVELING_LOGICAL_SIZE) - 8) / ((WEAR_LEVELING_CHECKPOINT_INTERVAL) + (WEAR_LEVELING_CHECKPOINT_SIZE)))
+#    define WEAR_LEVELING_CHECKPOINT_INDEX_SIZE ((WEAR_LEVELING_CHECKPOINT_INDEX_ENTRIES) * (WEAR_LEVELING_CHECKPOINT_INDEX_ENTRY_SIZE))
+STATIC_ASSERT(WEAR_LEVELING_CHECKPOINT_INDEX_ENTRIES > 0, "Backing size is too small to hold a checkpoint at the configured interval");
+#else
+#    define WEAR_LEVELING_CHECKPOINT_INDEX_SIZE 0
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+
+// The write log follows the consolidated data, its FNV1a_64, and the checkpoint index
+#define WEAR_LEVELING_LOG_START ((WEAR_LEVELING_LOGICAL_SIZE) + 8 + (WEAR_LEVELING_CHECKPOINT_INDEX_SIZE))
+
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
 bool backing_store_unlock(void);
@@ -99,6 +119,9 @@ enum {
     // 0x02 -- 2-byte backing store write optimization: word-encoded 0/1 values
     LOG_ENTRY_TYPE_WORD_01,
 
+    // 0x03 -- Checkpoint: followed by a copy of the logical data and its FNV1a_64
+    LOG_ENTRY_TYPE_CHECKPOINT,
+
     LOG_ENTRY_TYPES
 };
 
@@ -147,3 +170,10 @@ STATIC_ASSERT(LOG_ENTRY_TYPES <= (1 << 2), "Too many log entry types to fit into
             [1] = (uint8_t)((address) >> 1), /* address */                                            \
         }                                                                                             \
     }
+
+#define LOG_ENTRY_MAKE_CHECKPOINT()                                                                   \
+    (write_log_entry_t) {                                                                             \
+        .raw8 = {                                                                                     \
+            [0] = ((((uint8_t)LOG_ENTRY_TYPE_CHECKPOINT) & BITMASK_FOR_BITCOUNT(2)) << 6), /* type */ \
+        }                                                                                             \
+    }
@@ -0,0 +1,34 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+/* A spread of home row and top row combos, roughly what a combo-heavy keymap defines */
+uint16_t const as_combo[]  = {KC_A, KC_S, COMBO_END};
+uint16_t const sd_combo[]  = {KC_S, KC_D, COMBO_END};
+uint16_t const df_combo[]  = {KC_D, KC_F, COMBO_END};
+uint16_t const jk_combo[]  = {KC_J, KC_K, COMBO_END};
+uint16_t const kl_combo[]  = {KC_K, KC_L, COMBO_END};
+uint16_t const qw_combo[]  = {KC_Q, KC_W, COMBO_END};
+uint16_t const we_combo[]  = {KC_W, KC_E, COMBO_END};
+uint16_t const er_combo[]  = {KC_E, KC_R, COMBO_END};
+uint16_t const ui_combo[]  = {KC_U, KC_I, COMBO_END};
+uint16_t const io_combo[]  = {KC_I, KC_O, COMBO_END};
+uint16_t const sdf_combo[] = {KC_S, KC_D, KC_F, COMBO_END};
+uint16_t const jkl_combo[] = {KC_J, KC_K, KC_L, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    COMBO(as_combo, KC_ESC),
+    COMBO(sd_combo, KC_TAB),
+    COMBO(df_combo, KC_BSPC),
+    COMBO(jk_combo, KC_ENT),
+    COMBO(kl_combo, KC_DEL),
+    COMBO(qw_combo, KC_HOME),
+    COMBO(we_combo, KC_END),
+    COMBO(er_combo, KC_PGUP),
+    COMBO(ui_combo, KC_PGDN),
+    COMBO(io_combo, KC_INS),
+    COMBO(sdf_combo, KC_CAPS),
+    COMBO(jkl_combo, KC_APP),
+};
+// clang-format on
@@ -0,0 +1,63 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_bench.hpp"
+#include "test_common.hpp"
+
+class CombosBench : public TestFixture {
+   protected:
+    void SetUp() override {
+        set_keymap({KeymapKey(0, 0, 0, KC_A), KeymapKey(0, 1, 0, KC_S), KeymapKey(0, 2, 0, KC_D), KeymapKey(0, 3, 0, KC_F), KeymapKey(0, 4, 0, KC_J), KeymapKey(0, 5, 0, KC_K), KeymapKey(0, 6, 0, KC_L), KeymapKey(0, 7, 0, KC_Z)});
+    }
+
+    static void tap(uint8_t col) {
+        press_key(col, 0);
+        bench_scan_loop();
+        release_key(col, 0);
+        bench_scan_loop();
+    }
+};
+
+TEST_F(CombosBench, TapKeyOutsideCombos) {
+    BenchHostDriver host;
+
+    bench_run(2000, [](uint32_t) { tap(7); });
+}
+
+TEST_F(CombosBench, TapComboKeyAlone) {
+    BenchHostDriver host;
+
+    // Buffered as a possible combo, then let go on release
+    bench_run(2000, [](uint32_t i) { tap(i % 7); });
+}
+
+TEST_F(CombosBench, TwoKeyChord) {
+    BenchHostDriver host;
+
+    bench_run(2000, [](uint32_t) {
+        press_key(0, 0);
+        bench_scan_loop();
+        press_key(1, 0);
+        bench_scan_loop();
+        release_key(0, 0);
+        bench_scan_loop();
+        release_key(1, 0);
+        bench_scan_loop();
+    });
+}
+
+TEST_F(CombosBench, ThreeKeyChord) {
+    BenchHostDriver host;
+
+    bench_run(2000, [](uint32_t) {
+        for (uint8_t col = 4; col <= 6; ++col) {
+            press_key(col, 0);
+            bench_scan_loop();
+        }
+        for (uint8_t col = 4; col <= 6; ++col) {
+            release_key(col, 0);
+            bench_scan_loop();
+        }
+    });
+}
@@ -0,0 +1,58 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_bench.hpp"
+
+extern "C" {
+#include "color.h"
+}
+
+/* Each iteration converts one row of every saturation at a single hue */
+#define BENCH_ROW_SIZE 256
+
+class HsvToRgbBench : public ::testing::Test {
+   protected:
+    static void fill_row(uint32_t i) {
+        for (int s = 0; s < BENCH_ROW_SIZE; s++) {
+            hsv[s] = {(uint8_t)i, (uint8_t)s, 255};
+        }
+    }
+
+    static hsv_t hsv[BENCH_ROW_SIZE];
+    static rgb_t rgb[BENCH_ROW_SIZE];
+};
+
+hsv_t HsvToRgbBench::hsv[BENCH_ROW_SIZE];
+rgb_t HsvToRgbBench::rgb[BENCH_ROW_SIZE];
+
+TEST_F(HsvToRgbBench, Single) {
+    bench_run(2000, [](uint32_t i) {
+        fill_row(i);
+        for (int s = 0; s < BENCH_ROW_SIZE; s++) {
+            rgb[s] = hsv_to_rgb_nocie(hsv[s]);
+        }
+    });
+}
+
+TEST_F(HsvToRgbBench, SingleCie) {
+    bench_run(2000, [](uint32_t i) {
+        fill_row(i);
+        for (int s = 0; s < BENCH_ROW_SIZE; s++) {
+            rgb[s] = hsv_to_rgb(hsv[s]);
+        }
+    });
+}
+
+TEST_F(HsvToRgbBench, Batch) {
+    bench_run(2000, [](uint32_t i) {
+        fill_row(i);
+        hsv_to_rgb_batch_nocie(hsv, rgb, BENCH_ROW_SIZE);
+    });
+}
+
+TEST_F(HsvToRgbBench, BatchCie) {
+    bench_run(2000, [](uint32_t i) {
+        fill_row(i);
+        hsv_to_rgb_batch(hsv, rgb, BENCH_ROW_SIZE);
+    });
+}
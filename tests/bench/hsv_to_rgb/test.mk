@@ -0,0 +1,6 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+LED_TABLES = yes
+
+SRC += $(QUANTUM_DIR)/color.c
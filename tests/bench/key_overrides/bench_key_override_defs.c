@@ -0,0 +1,30 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+/* A typical set of shifted symbol and navigation overrides */
+const key_override_t delete_override    = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+const key_override_t comma_override     = ko_make_basic(MOD_MASK_SHIFT, KC_COMM, KC_SCLN);
+const key_override_t dot_override       = ko_make_basic(MOD_MASK_SHIFT, KC_DOT, KC_COLN);
+const key_override_t slash_override     = ko_make_basic(MOD_MASK_SHIFT, KC_SLSH, KC_BSLS);
+const key_override_t quote_override     = ko_make_basic(MOD_MASK_SHIFT, KC_QUOT, KC_GRV);
+const key_override_t minus_override     = ko_make_basic(MOD_MASK_SHIFT, KC_MINS, KC_EQL);
+const key_override_t home_override      = ko_make_basic(MOD_MASK_CTRL, KC_LEFT, KC_HOME);
+const key_override_t end_override       = ko_make_basic(MOD_MASK_CTRL, KC_RGHT, KC_END);
+const key_override_t volume_up_override = ko_make_basic(MOD_MASK_ALT, KC_UP, KC_VOLU);
+const key_override_t volume_dn_override = ko_make_basic(MOD_MASK_ALT, KC_DOWN, KC_VOLD);
+
+// clang-format off
+const key_override_t *key_overrides[] = {
+    &delete_override,
+    &comma_override,
+    &dot_override,
+    &slash_override,
+    &quote_override,
+    &minus_override,
+    &home_override,
+    &end_override,
+    &volume_up_override,
+    &volume_dn_override,
+};
+// clang-format on
@@ -0,0 +1,61 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_bench.hpp"
+#include "test_common.hpp"
+
+class KeyOverridesBench : public TestFixture {
+   protected:
+    void SetUp() override {
+        set_keymap({KeymapKey(0, 0, 0, KC_LSFT), KeymapKey(0, 1, 0, KC_BSPC), KeymapKey(0, 2, 0, KC_X)});
+    }
+
+    static void tap(uint8_t col) {
+        press_key(col, 0);
+        bench_scan_loop();
+        release_key(col, 0);
+        bench_scan_loop();
+    }
+
+    static void hold_shift(bool held) {
+        if (held) {
+            press_key(0, 0);
+        } else {
+            release_key(0, 0);
+        }
+        bench_scan_loop();
+    }
+};
+
+TEST_F(KeyOverridesBench, TapKeyWithoutMods) {
+    BenchHostDriver host;
+
+    bench_run(2000, [](uint32_t) { tap(2); });
+}
+
+TEST_F(KeyOverridesBench, TapShiftedKeyWithoutOverride) {
+    BenchHostDriver host;
+
+    hold_shift(true);
+    bench_run(2000, [](uint32_t) { tap(2); });
+    hold_shift(false);
+}
+
+TEST_F(KeyOverridesBench, TapOverriddenKey) {
+    BenchHostDriver host;
+
+    hold_shift(true);
+    bench_run(2000, [](uint32_t) { tap(1); });
+    hold_shift(false);
+}
+
+TEST_F(KeyOverridesBench, ShiftPressAndRelease) {
+    BenchHostDriver host;
+
+    // Every modifier change has all overrides checked for activation
+    bench_run(2000, [](uint32_t) {
+        hold_shift(true);
+        hold_shift(false);
+    });
+}
@@ -0,0 +1,48 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_bench.hpp"
+#include "test_common.hpp"
+
+class MatrixTaskBench : public TestFixture {
+   protected:
+    void SetUp() override {
+        set_keymap({KeymapKey(0, 0, 0, KC_A), KeymapKey(0, 3, 1, KC_B), KeymapKey(0, 6, 2, KC_C), KeymapKey(0, 9, 3, KC_D)});
+    }
+};
+
+TEST_F(MatrixTaskBench, IdleScan) {
+    BenchHostDriver host;
+
+    bench_run(10000, [](uint32_t) { bench_scan_loop(); });
+}
+
+TEST_F(MatrixTaskBench, ScanWithHeldKeys) {
+    BenchHostDriver host;
+
+    press_key(0, 0);
+    press_key(3, 1);
+    press_key(6, 2);
+    bench_scan_loop();
+
+    bench_run(10000, [](uint32_t) { bench_scan_loop(); });
+
+    release_key(0, 0);
+    release_key(3, 1);
+    release_key(6, 2);
+    bench_scan_loop();
+}
+
+TEST_F(MatrixTaskBench, KeyPressAndRelease) {
+    BenchHostDriver host;
+
+    // Each iteration is one scan that sees a press and one that sees the release, cycling through the rows
+    bench_run(2000, [](uint32_t i) {
+        uint8_t row = i % MATRIX_ROWS;
+        press_key(row * 3, row);
+        bench_scan_loop();
+        release_key(row * 3, row);
+        bench_scan_loop();
+    });
+}
@@ -0,0 +1,70 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include "test_bench.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+#include "qp_surface_internal.h"
+}
+
+#define BENCH_SURFACE_WIDTH 240
+#define BENCH_SURFACE_HEIGHT 240
+
+static surface_painter_device_t surface_storage;
+static uint8_t                  surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(BENCH_SURFACE_WIDTH, BENCH_SURFACE_HEIGHT, 16)];
+
+class PainterSurfaceBench : public ::testing::Test {
+   protected:
+    void make(uint8_t bpp) {
+        memset(&surface_storage, 0, sizeof(surface_storage));
+        if (bpp == 16) {
+            surface = qp_make_rgb565_surface_advanced(&surface_storage, 1, BENCH_SURFACE_WIDTH, BENCH_SURFACE_HEIGHT, surface_buffer);
+        } else {
+            surface = qp_make_mono1bpp_surface_advanced(&surface_storage, 1, BENCH_SURFACE_WIDTH, BENCH_SURFACE_HEIGHT, surface_buffer);
+        }
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    }
+
+    static painter_device_t surface;
+};
+
+painter_device_t PainterSurfaceBench::surface = nullptr;
+
+TEST_F(PainterSurfaceBench, SetPixel) {
+    make(16);
+    bench_run(20000, [](uint32_t i) { qp_setpixel(surface, (i * 7) % BENCH_SURFACE_WIDTH, (i * 13) % BENCH_SURFACE_HEIGHT, i, 255, 255); });
+}
+
+TEST_F(PainterSurfaceBench, Line) {
+    make(16);
+    bench_run(2000, [](uint32_t i) { qp_line(surface, 0, i % BENCH_SURFACE_HEIGHT, BENCH_SURFACE_WIDTH - 1, BENCH_SURFACE_HEIGHT - 1 - i % BENCH_SURFACE_HEIGHT, i, 255, 255); });
+}
+
+TEST_F(PainterSurfaceBench, FilledRect) {
+    make(16);
+    bench_run(200, [](uint32_t i) { qp_rect(surface, 20, 20, 219, 219, i, 255, 255, true); });
+}
+
+TEST_F(PainterSurfaceBench, FilledRectMono) {
+    make(1);
+    bench_run(200, [](uint32_t i) { qp_rect(surface, 20, 20, 219, 219, 0, 0, (i & 1) ? 255 : 0, true); });
+}
+
+TEST_F(PainterSurfaceBench, OutlineCircle) {
+    make(16);
+    bench_run(2000, [](uint32_t i) { qp_circle(surface, 120, 120, 10 + i % 100, i, 255, 255, false); });
+}
+
+TEST_F(PainterSurfaceBench, FilledCircle) {
+    make(16);
+    bench_run(200, [](uint32_t i) { qp_circle(surface, 120, 120, 100, i, 255, 255, true); });
+}
+
+TEST_F(PainterSurfaceBench, FilledEllipse) {
+    make(16);
+    bench_run(200, [](uint32_t i) { qp_ellipse(surface, 120, 120, 100, 50, i, 255, 255, true); });
+}
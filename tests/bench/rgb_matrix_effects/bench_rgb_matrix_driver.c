@@ -0,0 +1,55 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "bench_rgb_matrix_driver.h"
+#include "rgb_matrix.h"
+
+// clang-format off
+led_config_t g_led_config = {
+    {
+        {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9 },
+        { 10, 11, 12, 13, 14, 15, 16, 17, 18, 19 },
+        { 20, 21, 22, 23, 24, 25, 26, 27, 28, 29 },
+        { 30, 31, 32, 33, 34, 35, 36, 37, 38, 39 },
+    },
+    {
+        {  0,  0}, { 24,  0}, { 49,  0}, { 74,  0}, { 99,  0}, {124,  0}, {149,  0}, {174,  0}, {199,  0}, {224,  0},
+        {  0, 21}, { 24, 21}, { 49, 21}, { 74, 21}, { 99, 21}, {124, 21}, {149, 21}, {174, 21}, {199, 21}, {224, 21},
+        {  0, 42}, { 24, 42}, { 49, 42}, { 74, 42}, { 99, 42}, {124, 42}, {149, 42}, {174, 42}, {199, 42}, {224, 42},
+        {  0, 64}, { 24, 64}, { 49, 64}, { 74, 64}, { 99, 64}, {124, 64}, {149, 64}, {174, 64}, {199, 64}, {224, 64},
+    },
+    {
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    },
+};
+// clang-format on
+
+uint32_t bench_rgb_matrix_flushes = 0;
+
+static rgb_t leds[RGB_MATRIX_LED_COUNT];
+
+static void bench_init(void) {}
+
+static void bench_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    leds[index] = (rgb_t){red, green, blue};
+}
+
+static void bench_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        bench_set_color(i, red, green, blue);
+    }
+}
+
+static void bench_flush(void) {
+    bench_rgb_matrix_flushes++;
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = bench_init,
+    .flush         = bench_flush,
+    .set_color     = bench_set_color,
+    .set_color_all = bench_set_color_all,
+};
@@ -0,0 +1,69 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_bench.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "bench_rgb_matrix_driver.h"
+}
+
+class RgbMatrixEffectsBench : public TestFixture {
+   protected:
+    void start_effect(uint8_t mode) {
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+        rgb_matrix_set_speed_noeeprom(128);
+        rgb_matrix_mode_noeeprom(mode);
+        for (int i = 0; i < 4; ++i) {
+            render_frame();
+        }
+    }
+
+    /* Runs the task state machine until it has rendered and flushed one full frame */
+    static void render_frame(void) {
+        uint32_t flushes = bench_rgb_matrix_flushes;
+        do {
+            rgb_matrix_task();
+            advance_time(1);
+        } while (bench_rgb_matrix_flushes == flushes);
+    }
+
+    /* As above, with a key hit every frame for the reactive effects to draw */
+    static void render_frame_with_keypress(uint32_t i) {
+        rgb_matrix_handle_key_event(i % MATRIX_ROWS, i % MATRIX_COLS, true);
+        rgb_matrix_handle_key_event(i % MATRIX_ROWS, i % MATRIX_COLS, false);
+        render_frame();
+    }
+};
+
+TEST_F(RgbMatrixEffectsBench, SolidColor) {
+    start_effect(RGB_MATRIX_SOLID_COLOR);
+    bench_run(1000, [](uint32_t) { render_frame(); });
+}
+
+TEST_F(RgbMatrixEffectsBench, CycleLeftRight) {
+    start_effect(RGB_MATRIX_CYCLE_LEFT_RIGHT);
+    bench_run(1000, [](uint32_t) { render_frame(); });
+}
+
+TEST_F(RgbMatrixEffectsBench, CyclePinwheel) {
+    start_effect(RGB_MATRIX_CYCLE_PINWHEEL);
+    bench_run(1000, [](uint32_t) { render_frame(); });
+}
+
+TEST_F(RgbMatrixEffectsBench, RainbowMovingChevron) {
+    start_effect(RGB_MATRIX_RAINBOW_MOVING_CHEVRON);
+    bench_run(1000, [](uint32_t) { render_frame(); });
+}
+
+TEST_F(RgbMatrixEffectsBench, SolidReactiveSimple) {
+    start_effect(RGB_MATRIX_SOLID_REACTIVE_SIMPLE);
+    bench_run(1000, render_frame_with_keypress);
+}
+
+TEST_F(RgbMatrixEffectsBench, TypingHeatmap) {
+    start_effect(RGB_MATRIX_TYPING_HEATMAP);
+    bench_run(1000, render_frame_with_keypress);
+}
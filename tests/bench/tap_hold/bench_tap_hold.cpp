@@ -0,0 +1,77 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "action.h"
+#include "keycode.h"
+#include "test_bench.hpp"
+#include "test_common.hpp"
+
+class TapHoldBench : public TestFixture {
+   protected:
+    void SetUp() override {
+        set_keymap({KeymapKey(0, 0, 0, LSFT_T(KC_A)), KeymapKey(0, 1, 0, KC_B), KeymapKey(0, 2, 0, LT(1, KC_C)), KeymapKey(1, 1, 0, KC_D)});
+    }
+
+    /* Feeds events straight into action_exec(), the way keyboard_task() would */
+    static void key_event(uint8_t col, bool pressed, uint32_t then_ms) {
+        action_exec(keyevent_t{.key = {.col = col, .row = 0}, .time = timer_read(), .type = KEY_EVENT, .pressed = pressed});
+        advance_time(then_ms);
+    }
+
+    static void tick(void) {
+        action_exec(keyevent_t{.key = {.col = 0, .row = 0}, .time = timer_read(), .type = TICK_EVENT, .pressed = false});
+    }
+
+    /* Lets the tapping state machine time out, so each iteration starts from scratch */
+    static void settle(void) {
+        advance_time(TAPPING_TERM + 1);
+        tick();
+    }
+};
+
+TEST_F(TapHoldBench, ModTapTap) {
+    BenchHostDriver host;
+
+    bench_run(2000, [](uint32_t) {
+        key_event(0, true, 10);
+        key_event(0, false, 0);
+        settle();
+    });
+}
+
+TEST_F(TapHoldBench, ModTapHold) {
+    BenchHostDriver host;
+
+    bench_run(2000, [](uint32_t) {
+        key_event(0, true, TAPPING_TERM + 1);
+        tick();
+        key_event(0, false, 0);
+        settle();
+    });
+}
+
+TEST_F(TapHoldBench, ModTapInterruptedByTap) {
+    BenchHostDriver host;
+
+    // Resolved as a tap on release, with the other key's events replayed from the waiting buffer
+    bench_run(2000, [](uint32_t) {
+        key_event(0, true, 10);
+        key_event(1, true, 10);
+        key_event(1, false, 10);
+        key_event(0, false, 0);
+        settle();
+    });
+}
+
+TEST_F(TapHoldBench, LayerTapHoldWithKey) {
+    BenchHostDriver host;
+
+    bench_run(2000, [](uint32_t) {
+        key_event(2, true, TAPPING_TERM + 1);
+        tick();
+        key_event(1, true, 10);
+        key_event(1, false, 10);
+        key_event(2, false, 0);
+        settle();
+    });
+}
@@ -0,0 +1,38 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "wear_leveling.h"
+#include "wear_leveling_internal.h"
+
+/* RAM standing in for flash; erased cells read back as zero, which is how wear-leveling sees erased flash */
+static backing_store_int_t backing_store[WEAR_LEVELING_BACKING_SIZE / BACKING_STORE_WRITE_SIZE];
+
+bool backing_store_init(void) {
+    return true;
+}
+
+bool backing_store_unlock(void) {
+    return true;
+}
+
+bool backing_store_erase(void) {
+    memset(backing_store, 0, sizeof(backing_store));
+    return true;
+}
+
+bool backing_store_write(uint32_t address, backing_store_int_t value) {
+    backing_store[address / BACKING_STORE_WRITE_SIZE] = value;
+    return true;
+}
+
+bool backing_store_lock(void) {
+    return true;
+}
+
+bool backing_store_read(uint32_t address, backing_store_int_t *value) {
+    *value = backing_store[address / BACKING_STORE_WRITE_SIZE];
+    return true;
+}
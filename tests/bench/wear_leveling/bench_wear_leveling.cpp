@@ -0,0 +1,63 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_bench.hpp"
+
+extern "C" {
+#include "wear_leveling.h"
+}
+
+class WearLevelingBench : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        ASSERT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS);
+        ASSERT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS);
+    }
+};
+
+/* Every write changes the stored value, so none of them are skipped; log consolidations are included as they come up */
+
+TEST_F(WearLevelingBench, ByteWrites) {
+    bench_run(5000, [](uint32_t i) {
+        uint8_t value = i;
+        wear_leveling_write(i % 64, &value, sizeof(value));
+    });
+}
+
+TEST_F(WearLevelingBench, WordWrites) {
+    bench_run(5000, [](uint32_t i) {
+        uint32_t value = i;
+        wear_leveling_write(128 + (i % 32) * sizeof(value), &value, sizeof(value));
+    });
+}
+
+TEST_F(WearLevelingBench, BlockWrites) {
+    bench_run(1000, [](uint32_t i) {
+        uint8_t block[32];
+        memset(block, i, sizeof(block));
+        wear_leveling_write(512, block, sizeof(block));
+    });
+}
+
+TEST_F(WearLevelingBench, UnchangedWrites) {
+    uint32_t value = 0x12345678;
+    wear_leveling_write(256, &value, sizeof(value));
+    bench_run(5000, [&value](uint32_t) { wear_leveling_write(256, &value, sizeof(value)); });
+}
+
+TEST_F(WearLevelingBench, InitReplaysWriteLog) {
+    // Part-fill the write log, so init has entries to play back on top of the consolidated data
+    for (uint32_t i = 0; i < 500; ++i) {
+        uint8_t value = i;
+        ASSERT_NE(wear_leveling_write(i % 64, &value, sizeof(value)), WEAR_LEVELING_FAILED);
+    }
+    bench_run(200, [](uint32_t) { wear_leveling_init(); });
+}
+
+TEST_F(WearLevelingBench, InitReplaysLongWriteLog) {
+    for (uint32_t i = 0; i < 1500; ++i) {
+        uint8_t value = i;
+        ASSERT_EQ(wear_leveling_write(i % 64, &value, sizeof(value)), WEAR_LEVELING_SUCCESS);
+    }
+    bench_run(200, [](uint32_t) { wear_leveling_init(); });
+}
@@ -0,0 +1,11 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+/* Sized like a typical embedded flash configuration */
+#define BACKING_STORE_WRITE_SIZE 2
+#define WEAR_LEVELING_BACKING_SIZE 8192
+#define WEAR_LEVELING_LOGICAL_SIZE 1024
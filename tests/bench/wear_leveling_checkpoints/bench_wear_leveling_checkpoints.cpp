@@ -0,0 +1,36 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_bench.hpp"
+
+extern "C" {
+#include "wear_leveling.h"
+}
+
+class WearLevelingCheckpointBench : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        ASSERT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS);
+        ASSERT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS);
+    }
+
+    /* Part-fills the write log with byte writes, stopping short of consolidation */
+    static void fill_log(uint32_t writes) {
+        for (uint32_t i = 0; i < writes; ++i) {
+            uint8_t value = i;
+            ASSERT_EQ(wear_leveling_write(i % 64, &value, sizeof(value)), WEAR_LEVELING_SUCCESS);
+        }
+    }
+};
+
+/* The same write logs as WearLevelingBench, which has to play all of them back on init; here only the log after the latest checkpoint is */
+
+TEST_F(WearLevelingCheckpointBench, InitReplaysWriteLog) {
+    fill_log(500);
+    bench_run(200, [](uint32_t) { wear_leveling_init(); });
+}
+
+TEST_F(WearLevelingCheckpointBench, InitReplaysLongWriteLog) {
+    fill_log(1500);
+    bench_run(200, [](uint32_t) { wear_leveling_init(); });
+}
@@ -0,0 +1,12 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+/* The same backing store as the wear_leveling benchmarks, with checkpoints so init doesn't play back the whole write log */
+#define BACKING_STORE_WRITE_SIZE 2
+#define WEAR_LEVELING_BACKING_SIZE 8192
+#define WEAR_LEVELING_LOGICAL_SIZE 1024
+#define WEAR_LEVELING_CHECKPOINT_INTERVAL 1024
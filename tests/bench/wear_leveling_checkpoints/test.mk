@@ -0,0 +1,6 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+WEAR_LEVELING_DRIVER = custom
+
+SRC += ../wear_leveling/bench_backing_store.c
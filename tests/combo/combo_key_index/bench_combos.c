@@ -0,0 +1,31 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+#include "keymap_introspection.h"
+#include "test_combos_key_index.h"
+
+/* Synthetic combos for benchmarking, each over two keycodes no other combo uses */
+static combo_t  bench_combos[BENCH_COMBOS_MAX];
+static uint16_t bench_keys[BENCH_COMBOS_MAX][3];
+static uint16_t bench_count = 0;
+
+uint32_t combo_get_calls = 0;
+
+void bench_combos_use(uint16_t count) {
+    for (uint16_t i = 0; i < count; i++) {
+        bench_keys[i][0] = bench_combo_keycode(i, 0);
+        bench_keys[i][1] = bench_combo_keycode(i, 1);
+        bench_keys[i][2] = COMBO_END;
+        bench_combos[i]  = (combo_t)COMBO(bench_keys[i], KC_NO);
+    }
+    bench_count = count;
+}
+
+uint16_t combo_count(void) {
+    return bench_count ? bench_count : combo_count_raw();
+}
+
+combo_t *combo_get(uint16_t combo_idx) {
+    combo_get_calls++;
+    return bench_count ? &bench_combos[combo_idx] : combo_get_raw(combo_idx);
+}
@@ -0,0 +1,115 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iostream>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_combos_key_index.h"
+
+using testing::_;
+
+class ComboKeyIndex : public TestFixture {
+   protected:
+    void TearDown() override {
+        bench_combos_use(0);
+    }
+};
+
+TEST_F(ComboKeyIndex, two_key_combo_fires) {
+    TestDriver driver;
+    KeymapKey  key_c(0, 0, 0, KC_C);
+    KeymapKey  key_d(0, 1, 0, KC_D);
+    set_keymap({key_c, key_d});
+
+    EXPECT_REPORT(driver, (KC_Z));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_c, key_d});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeyIndex, longer_overlapping_combo_wins) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_b(0, 1, 0, KC_B);
+    KeymapKey  key_c(0, 2, 0, KC_C);
+    set_keymap({key_a, key_b, key_c});
+
+    EXPECT_REPORT(driver, (KC_Y));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b, key_c});
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeyIndex, keys_outside_combos_pass_through) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_e(0, 1, 0, KC_E);
+    set_keymap({key_a, key_e});
+
+    EXPECT_REPORT(driver, (KC_E));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_e);
+    VERIFY_AND_CLEAR(driver);
+
+    /* A lone combo key is released after COMBO_TERM */
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a, COMBO_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeyIndex, BenchmarkPerEventCostAgainstComboCount) {
+    TestDriver driver;
+    KeymapKey  key_no(0, 9, 3, KC_NO);
+    set_keymap({key_no});
+
+    const int      events   = 20000;
+    const uint16_t counts[] = {8, 64, 256, BENCH_COMBOS_MAX};
+    uint32_t       calls_per_event[4];
+
+    for (int c = 0; c < 4; c++) {
+        uint16_t count = counts[c];
+        bench_combos_use(count);
+
+        keyrecord_t record = {};
+        record.event.key   = key_no.position;
+        record.event.type  = KEY_EVENT;
+
+        /* The first event rebuilds the index for the new combo set */
+        record.event.pressed = true;
+        process_combo(bench_combo_keycode(0, 0), &record);
+        record.event.pressed = false;
+        process_combo(bench_combo_keycode(0, 0), &record);
+
+        combo_get_calls = 0;
+        auto start      = std::chrono::steady_clock::now();
+        for (int i = 0; i < events / 2; i++) {
+            uint16_t keycode     = bench_combo_keycode((i * 7) % count, i & 1);
+            record.event.pressed = true;
+            record.event.time    = timer_read();
+            process_combo(keycode, &record);
+            record.event.pressed = false;
+            process_combo(keycode, &record);
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+
+        calls_per_event[c] = combo_get_calls / events;
+        std::cout << "[ BENCH    ] " << count << " combos: " << std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / events << " ns/event, " << calls_per_event[c] << " combos visited/event" << std::endl;
+    }
+
+    /* Work per event depends on how many combos contain the key, not on how many combos exist */
+    for (int c = 1; c < 4; c++) {
+        EXPECT_EQ(calls_per_event[c], calls_per_event[0]);
+    }
+
+    bench_combos_use(0);
+    idle_for(COMBO_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,17 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+enum combos { ab_combo, abc_combo, cd_combo };
+
+uint16_t const ab_keys[]  = {KC_A, KC_B, COMBO_END};
+uint16_t const abc_keys[] = {KC_A, KC_B, KC_C, COMBO_END};
+uint16_t const cd_keys[]  = {KC_C, KC_D, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [ab_combo]  = COMBO(ab_keys, KC_X),
+    [abc_combo] = COMBO(abc_keys, KC_Y),
+    [cd_combo]  = COMBO(cd_keys, KC_Z),
+};
+// clang-format on
@@ -0,0 +1,25 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+#define BENCH_COMBOS_MAX 512
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern uint32_t combo_get_calls;
+
+/* Switches combo_count()/combo_get() over to `count` synthetic combos, or back to key_combos when 0 */
+void bench_combos_use(uint16_t count);
+
+static inline uint16_t bench_combo_keycode(uint16_t combo, uint8_t key) {
+    return 0x5000 + combo * 2 + key;
+}
+
+#ifdef __cplusplus
+}
+#endif
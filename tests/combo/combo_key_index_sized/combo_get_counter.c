@@ -0,0 +1,12 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+#include "keymap_introspection.h"
+#include "test_combos_key_index_sized.h"
+
+uint32_t combo_get_calls = 0;
+
+combo_t *combo_get(uint16_t combo_idx) {
+    combo_get_calls++;
+    return combo_get_raw(combo_idx);
+}
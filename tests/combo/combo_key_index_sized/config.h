@@ -0,0 +1,11 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define TAPPING_TERM 200
+
+/* COMBO_KEY_INDEX_SIZE is left to default to the size of key_combos */
+#define COMBO_KEY_INDEX
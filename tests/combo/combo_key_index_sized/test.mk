@@ -0,0 +1,8 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+COMBO_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = test_combos_key_index_sized.c
+
+SRC += combo_get_counter.c
@@ -0,0 +1,53 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_combos_key_index_sized.h"
+
+using testing::_;
+
+class ComboKeyIndexSized : public TestFixture {};
+
+TEST_F(ComboKeyIndexSized, last_combo_fires) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, sized_combo_keycode(SIZED_COMBOS_COUNT - 1, 0));
+    KeymapKey  key_b(0, 1, 0, sized_combo_keycode(SIZED_COMBOS_COUNT - 1, 1));
+    set_keymap({key_a, key_b});
+
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeyIndexSized, index_holds_every_combo) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, sized_combo_keycode(SIZED_COMBOS_COUNT - 1, 0));
+    set_keymap({key_a});
+
+    keyrecord_t record   = {};
+    record.event.key     = key_a.position;
+    record.event.type    = KEY_EVENT;
+    record.event.time    = timer_read();
+    record.event.pressed = true;
+
+    /* The first event builds the index from all combos */
+    process_combo(key_a.code, &record);
+    record.event.pressed = false;
+    process_combo(key_a.code, &record);
+    idle_for(COMBO_TERM + 1);
+
+    /* With all combos indexed, an event visits only the one combo containing its key */
+    combo_get_calls      = 0;
+    record.event.time    = timer_read();
+    record.event.pressed = true;
+    process_combo(key_a.code, &record);
+    EXPECT_LT(combo_get_calls, 4u);
+
+    record.event.pressed = false;
+    process_combo(key_a.code, &record);
+    idle_for(COMBO_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,21 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+#include "test_combos_key_index_sized.h"
+
+/* Combo n is the two otherwise unused keycodes sized_combo_keycode(n, 0) and sized_combo_keycode(n, 1) */
+#define SIZED_KEYS(n) uint16_t const sized_keys_##n[] = {QK_UNICODE + (n) * 2, QK_UNICODE + (n) * 2 + 1, COMBO_END};
+#define SIZED_COMBO(n) [n] = COMBO(sized_keys_##n, KC_X),
+
+#define SIZED_TENS(M, d) M(d##0) M(d##1) M(d##2) M(d##3) M(d##4) M(d##5) M(d##6) M(d##7) M(d##8) M(d##9)
+#define SIZED_ALL(M) SIZED_TENS(M, ) SIZED_TENS(M, 1) SIZED_TENS(M, 2) SIZED_TENS(M, 3) SIZED_TENS(M, 4) SIZED_TENS(M, 5) SIZED_TENS(M, 6) SIZED_TENS(M, 7) SIZED_TENS(M, 8) SIZED_TENS(M, 9)
+
+SIZED_ALL(SIZED_KEYS)
+
+// clang-format off
+combo_t key_combos[] = {
+    SIZED_ALL(SIZED_COMBO)
+};
+// clang-format on
+
+_Static_assert(ARRAY_SIZE(key_combos) == SIZED_COMBOS_COUNT, "key_combos does not match SIZED_COMBOS_COUNT");
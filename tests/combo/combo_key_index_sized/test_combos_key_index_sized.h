@@ -0,0 +1,24 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "keycodes.h"
+
+/* More combos than the old fixed index size of 64 keys could hold */
+#define SIZED_COMBOS_COUNT 100
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern uint32_t combo_get_calls;
+
+static inline uint16_t sized_combo_keycode(uint16_t combo, uint8_t key) {
+    return QK_UNICODE + combo * 2 + key;
+}
+
+#ifdef __cplusplus
+}
+#endif
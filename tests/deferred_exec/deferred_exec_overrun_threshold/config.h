@@ -0,0 +1,9 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define DEFERRED_EXEC_STATS
+#define DEFERRED_EXEC_OVERRUN_THRESHOLD_MS 5
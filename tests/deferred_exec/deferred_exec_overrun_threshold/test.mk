@@ -0,0 +1,4 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+DEFERRED_EXEC_ENABLE = yes
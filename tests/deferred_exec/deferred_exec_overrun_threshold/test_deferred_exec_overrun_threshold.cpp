@@ -0,0 +1,99 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "deferred_exec.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+}
+
+struct overrun_t {
+    uint32_t lateness_ms;
+    uint32_t duration_ms;
+};
+
+static std::vector<overrun_t> overruns;
+
+extern "C" void deferred_exec_overrun_user(deferred_exec_callback callback, void *cb_arg, uint32_t lateness_ms, uint32_t duration_ms) {
+    overruns.push_back({lateness_ms, duration_ms});
+}
+
+struct job_t {
+    uint32_t repeat_ms;
+    uint32_t busy_ms;
+};
+
+static uint32_t job_callback(uint32_t trigger_time, void *cb_arg) {
+    job_t *job = (job_t *)cb_arg;
+    advance_time(job->busy_ms);
+    return job->repeat_ms;
+}
+
+class DeferredExecOverrunThreshold : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        overruns.clear();
+        deferred_exec_reset_stats();
+    }
+
+    void TearDown() override {
+        for (deferred_token token : tokens) {
+            cancel_deferred_exec(token);
+        }
+    }
+
+    void schedule(uint32_t delay_ms, job_t *job) {
+        tokens.push_back(defer_exec(delay_ms, job_callback, job));
+    }
+
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; ++i) {
+            advance_time(1);
+            deferred_exec_task();
+        }
+    }
+
+    std::vector<deferred_token> tokens;
+};
+
+TEST_F(DeferredExecOverrunThreshold, SmallOverrunsAreOnlyCounted) {
+    // Takes as long as the delay it asks for, and holds up the next callback by as much
+    job_t busy   = {3, 3};
+    job_t prompt = {0, 0};
+    schedule(3, &busy);
+    schedule(4, &prompt);
+    run_for(4);
+
+    deferred_exec_stats_t stats;
+    deferred_exec_get_stats(&stats);
+    EXPECT_GT(stats.overruns, 0);
+    EXPECT_GT(stats.late, 0);
+    EXPECT_LE(stats.max_lateness_ms, DEFERRED_EXEC_OVERRUN_THRESHOLD_MS);
+    EXPECT_TRUE(overruns.empty());
+}
+
+TEST_F(DeferredExecOverrunThreshold, LongOverrunsAreReported) {
+    job_t job = {5, 8};
+    schedule(5, &job);
+    run_for(5);
+    ASSERT_EQ(overruns.size(), 1);
+    EXPECT_EQ(overruns[0].lateness_ms, 0);
+    EXPECT_EQ(overruns[0].duration_ms, 8);
+}
+
+TEST_F(DeferredExecOverrunThreshold, CallbacksHeldUpPastTheThresholdAreReported) {
+    // The busy callback holds up the prompt one, which doesn't overrun itself
+    job_t busy   = {0, 7};
+    job_t prompt = {0, 0};
+    schedule(5, &busy);
+    schedule(6, &prompt);
+    run_for(6);
+    ASSERT_EQ(overruns.size(), 1);
+    EXPECT_EQ(overruns[0].lateness_ms, 7);
+    EXPECT_EQ(overruns[0].duration_ms, 0);
+}
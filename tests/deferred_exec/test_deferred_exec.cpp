@@ -0,0 +1,377 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <map>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "deferred_exec.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+}
+
+struct call_t {
+    int      id;
+    uint32_t trigger_time;
+    uint32_t now;
+};
+
+static std::vector<call_t> calls;
+
+struct overrun_t {
+    uint32_t lateness_ms;
+    uint32_t duration_ms;
+};
+
+static std::vector<overrun_t> overruns;
+
+extern "C" void deferred_exec_overrun_user(deferred_exec_callback callback, void *cb_arg, uint32_t lateness_ms, uint32_t duration_ms) {
+    overruns.push_back({lateness_ms, duration_ms});
+}
+
+// cb_arg points at one of these, so callbacks can be told what to do next
+struct job_t {
+    int            id;
+    uint32_t       repeat_ms;
+    uint32_t       busy_ms;
+    deferred_token requeue_token;
+};
+
+static uint32_t job_callback(uint32_t trigger_time, void *cb_arg) {
+    job_t *job = (job_t *)cb_arg;
+    calls.push_back({job->id, trigger_time, timer_read32()});
+    advance_time(job->busy_ms);
+    return job->repeat_ms;
+}
+
+static uint32_t requeue_callback(uint32_t trigger_time, void *cb_arg) {
+    job_t *job = (job_t *)cb_arg;
+    calls.push_back({job->id, trigger_time, timer_read32()});
+    cancel_deferred_exec(job->requeue_token);
+    job->requeue_token = defer_exec(5, job_callback, job);
+    return 1;
+}
+
+// A table of core entries, whose callbacks can reach into the user table and back
+static deferred_executor_t core_table[4];
+static uint32_t            core_last_check = 0;
+static deferred_token      core_held_back  = INVALID_DEFERRED_TOKEN;
+
+static uint32_t run_user_table_callback(uint32_t trigger_time, void *cb_arg) {
+    job_t *job = (job_t *)cb_arg;
+    calls.push_back({job->id, trigger_time, timer_read32()});
+    deferred_exec_task();
+    return 0;
+}
+
+static uint32_t cancel_core_callback(uint32_t trigger_time, void *cb_arg) {
+    job_t *job = (job_t *)cb_arg;
+    calls.push_back({job->id, trigger_time, timer_read32()});
+    cancel_deferred_exec_advanced(core_table, 4, core_held_back);
+    return 0;
+}
+
+class DeferredExec : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        calls.clear();
+        overruns.clear();
+        deferred_exec_reset_stats();
+    }
+
+    void TearDown() override {
+        for (deferred_token token : tokens) {
+            cancel_deferred_exec(token);
+        }
+    }
+
+    deferred_token schedule(uint32_t delay_ms, job_t *job) {
+        deferred_token token = defer_exec(delay_ms, job_callback, job);
+        tokens.push_back(token);
+        return token;
+    }
+
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; ++i) {
+            advance_time(1);
+            deferred_exec_task();
+        }
+    }
+
+    std::vector<int> called_ids(void) {
+        std::vector<int> ids;
+        for (const call_t &call : calls) {
+            ids.push_back(call.id);
+        }
+        return ids;
+    }
+
+    std::vector<deferred_token> tokens;
+};
+
+TEST_F(DeferredExec, RunsInTriggerOrder) {
+    job_t jobs[] = {{0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {3, 0, 0}};
+    schedule(30, &jobs[0]);
+    schedule(10, &jobs[1]);
+    schedule(40, &jobs[2]);
+    schedule(20, &jobs[3]);
+
+    run_for(9);
+    EXPECT_TRUE(calls.empty());
+    run_for(40);
+    EXPECT_EQ(called_ids(), std::vector<int>({1, 3, 0, 2}));
+    for (const call_t &call : calls) {
+        EXPECT_EQ(call.now, call.trigger_time);
+    }
+}
+
+TEST_F(DeferredExec, RepeatsRelativeToTriggerTime) {
+    job_t          job   = {0, 5, 0};
+    deferred_token token = schedule(5, &job);
+    uint32_t       start = timer_read32();
+
+    run_for(23);
+    ASSERT_EQ(calls.size(), 4);
+    for (size_t i = 0; i < calls.size(); ++i) {
+        EXPECT_EQ(calls[i].trigger_time, start + 5 * (i + 1));
+    }
+
+    EXPECT_TRUE(cancel_deferred_exec(token));
+    run_for(20);
+    EXPECT_EQ(calls.size(), 4);
+}
+
+TEST_F(DeferredExec, CancelAndExtend) {
+    job_t          jobs[]    = {{0, 0, 0}, {1, 0, 0}, {2, 0, 0}};
+    deferred_token cancelled = schedule(10, &jobs[0]);
+    deferred_token extended  = schedule(10, &jobs[1]);
+    schedule(20, &jobs[2]);
+
+    run_for(5);
+    EXPECT_TRUE(cancel_deferred_exec(cancelled));
+    EXPECT_FALSE(cancel_deferred_exec(cancelled));
+    EXPECT_TRUE(extend_deferred_exec(extended, 30));
+
+    run_for(20);
+    EXPECT_EQ(called_ids(), std::vector<int>({2}));
+    run_for(20);
+    EXPECT_EQ(called_ids(), std::vector<int>({2, 1}));
+    EXPECT_FALSE(extend_deferred_exec(extended, 10));
+}
+
+TEST_F(DeferredExec, FullTableRejectsNewEntries) {
+    job_t job = {0, 0, 0};
+    for (int i = 0; i < 32; ++i) {
+        ASSERT_NE(schedule(100 + i, &job), INVALID_DEFERRED_TOKEN) << i;
+    }
+    EXPECT_EQ(defer_exec(100, job_callback, &job), INVALID_DEFERRED_TOKEN);
+
+    EXPECT_TRUE(cancel_deferred_exec(tokens[7]));
+    deferred_token token = schedule(50, &job);
+    EXPECT_NE(token, INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(token, tokens[7]);
+    EXPECT_EQ(defer_exec(100, job_callback, &job), INVALID_DEFERRED_TOKEN);
+}
+
+TEST_F(DeferredExec, FinishedTokensAreNotReused) {
+    job_t          job   = {0, 0, 0};
+    deferred_token first = schedule(1, &job);
+    run_for(1);
+    ASSERT_EQ(calls.size(), 1);
+
+    // The same entry is reused, under a different token
+    deferred_token second = schedule(10, &job);
+    EXPECT_NE(second, first);
+    EXPECT_FALSE(cancel_deferred_exec(first));
+    EXPECT_FALSE(extend_deferred_exec(first, 10));
+    run_for(10);
+    EXPECT_EQ(calls.size(), 2);
+}
+
+TEST_F(DeferredExec, LateEntriesRunOncePerPass) {
+    job_t fast = {0, 1, 0};
+    job_t slow = {1, 0, 0};
+    schedule(1, &fast);
+    schedule(5, &slow);
+
+    // Both are well overdue by the time the task gets to run
+    advance_time(10);
+    deferred_exec_task();
+    EXPECT_EQ(called_ids(), std::vector<int>({0, 1}));
+
+    // The repeating entry catches up one trigger per pass
+    for (int i = 0; i < 3; ++i) {
+        calls.clear();
+        advance_time(1);
+        deferred_exec_task();
+        EXPECT_EQ(called_ids(), std::vector<int>({0}));
+    }
+}
+
+TEST_F(DeferredExec, CallbackCanRequeueOthers) {
+    job_t          job   = {0, 0, 0};
+    deferred_token token = defer_exec(1, requeue_callback, &job);
+    tokens.push_back(token);
+
+    run_for(12);
+    // Runs every millisecond, and keeps pushing back the job it queues
+    EXPECT_EQ(calls.size(), 12);
+    for (const call_t &call : calls) {
+        EXPECT_EQ(call.id, 0);
+    }
+    EXPECT_TRUE(cancel_deferred_exec(token));
+    run_for(5);
+    EXPECT_EQ(calls.size(), 13);
+    EXPECT_FALSE(cancel_deferred_exec(job.requeue_token));
+}
+
+TEST_F(DeferredExec, AdvancedTableMatchesReferenceModel) {
+    // An odd-sized table, exercised with random operations against a simple model of what should happen
+    static deferred_executor_t table[7] = {};
+    uint32_t                   last     = timer_read32();
+    std::mt19937               rng(1234);
+    job_t                      jobs[7];
+    std::map<deferred_token, std::pair<uint32_t, int>> expected; // token -> trigger time, job id
+    int                                                next_id = 0;
+
+    for (int step = 0; step < 5000; ++step) {
+        uint32_t now = timer_read32();
+        switch (rng() % 4) {
+            case 0: {
+                job_t *job = &jobs[next_id % 7];
+                *job       = {next_id, 0, 0};
+                uint32_t       delay = 1 + rng() % 20;
+                deferred_token token = defer_exec_advanced(table, 7, delay, job_callback, job);
+                if (expected.size() == 7) {
+                    ASSERT_EQ(token, INVALID_DEFERRED_TOKEN);
+                } else {
+                    ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+                    ASSERT_EQ(expected.count(token), 0);
+                    expected[token] = {now + delay, next_id++};
+                }
+                break;
+            }
+            case 1:
+                if (!expected.empty()) {
+                    auto it = std::next(expected.begin(), rng() % expected.size());
+                    ASSERT_TRUE(cancel_deferred_exec_advanced(table, 7, it->first));
+                    expected.erase(it);
+                }
+                break;
+            case 2:
+                if (!expected.empty()) {
+                    auto     it    = std::next(expected.begin(), rng() % expected.size());
+                    uint32_t delay = 1 + rng() % 20;
+                    ASSERT_TRUE(extend_deferred_exec_advanced(table, 7, it->first, delay));
+                    it->second.first = now + delay;
+                }
+                break;
+            default: {
+                advance_time(1 + rng() % 3);
+                calls.clear();
+                deferred_exec_advanced_task(table, 7, &last);
+                now = timer_read32();
+
+                std::multimap<uint32_t, int> due;
+                for (auto it = expected.begin(); it != expected.end();) {
+                    if (it->second.first <= now) {
+                        due.insert(it->second);
+                        it = expected.erase(it);
+                    } else {
+                        ++it;
+                    }
+                }
+                ASSERT_EQ(calls.size(), due.size()) << "step " << step;
+                auto it = due.begin();
+                for (size_t i = 0; i < calls.size(); ++i, ++it) {
+                    EXPECT_EQ(calls[i].trigger_time, it->first) << "step " << step;
+                }
+                break;
+            }
+        }
+    }
+
+    for (auto &entry : expected) {
+        EXPECT_TRUE(cancel_deferred_exec_advanced(table, 7, entry.first));
+    }
+}
+
+TEST_F(DeferredExec, StatisticsReportOverruns) {
+    job_t slow = {0, 5, 8};
+    schedule(5, &slow);
+
+    // Takes 8ms every time, but asks to be run every 5ms
+    run_for(5);
+    ASSERT_EQ(calls.size(), 1);
+    EXPECT_EQ(overruns.size(), 1);
+    EXPECT_EQ(overruns[0].lateness_ms, 0);
+    EXPECT_EQ(overruns[0].duration_ms, 8);
+
+    // Next time around it's late as well
+    run_for(1);
+    ASSERT_EQ(calls.size(), 2);
+    EXPECT_EQ(overruns[1].lateness_ms, 4);
+
+    deferred_exec_stats_t stats;
+    deferred_exec_get_stats(&stats);
+    EXPECT_EQ(stats.executions, 2);
+    EXPECT_EQ(stats.late, 1);
+    EXPECT_EQ(stats.max_lateness_ms, 4);
+    EXPECT_EQ(stats.overruns, 2);
+    EXPECT_EQ(stats.max_duration_ms, 8);
+
+    deferred_exec_reset_stats();
+    deferred_exec_get_stats(&stats);
+    EXPECT_EQ(stats.executions, 0);
+}
+
+TEST_F(DeferredExec, PromptCallbacksAreNotReported) {
+    job_t job = {0, 10, 1};
+    schedule(10, &job);
+    run_for(40);
+    EXPECT_GE(calls.size(), 3);
+    EXPECT_TRUE(overruns.empty());
+}
+
+TEST_F(DeferredExec, NestedTaskCanCancelHeldBackEntry) {
+    job_t repeating = {0, 1, 0};
+    job_t runner    = {1, 0, 0};
+    job_t canceller = {2, 0, 0};
+    core_held_back  = defer_exec_advanced(core_table, 4, 1, job_callback, &repeating);
+    ASSERT_NE(defer_exec_advanced(core_table, 4, 2, run_user_table_callback, &runner), INVALID_DEFERRED_TOKEN);
+    ASSERT_NE(defer_exec(1, cancel_core_callback, &canceller), INVALID_DEFERRED_TOKEN);
+
+    // The repeating entry is still due after it runs, so is held back while the user table cancels it
+    advance_time(10);
+    deferred_exec_advanced_task(core_table, 4, &core_last_check);
+    EXPECT_EQ(called_ids(), std::vector<int>({0, 1, 2}));
+    EXPECT_FALSE(cancel_deferred_exec_advanced(core_table, 4, core_held_back));
+
+    // Every entry of both tables is free again
+    calls.clear();
+    advance_time(10);
+    deferred_exec_advanced_task(core_table, 4, &core_last_check);
+    EXPECT_TRUE(calls.empty());
+
+    std::vector<deferred_token> core_tokens;
+    for (int i = 0; i < 4; ++i) {
+        core_tokens.push_back(defer_exec_advanced(core_table, 4, 5, job_callback, &repeating));
+        EXPECT_NE(core_tokens.back(), INVALID_DEFERRED_TOKEN);
+    }
+    EXPECT_EQ(defer_exec_advanced(core_table, 4, 5, job_callback, &repeating), INVALID_DEFERRED_TOKEN);
+    for (deferred_token token : core_tokens) {
+        EXPECT_TRUE(cancel_deferred_exec_advanced(core_table, 4, token));
+    }
+
+    job_t user_jobs[MAX_DEFERRED_EXECUTORS] = {};
+    for (int i = 0; i < MAX_DEFERRED_EXECUTORS; ++i) {
+        user_jobs[i].id = 10 + i;
+        EXPECT_NE(schedule(5, &user_jobs[i]), INVALID_DEFERRED_TOKEN);
+    }
+    run_for(5);
+    EXPECT_EQ(calls.size(), MAX_DEFERRED_EXECUTORS);
+}
@@ -0,0 +1,111 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycodes.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "eeprom_driver.h"
+#include "keymap_introspection.h"
+#include "nvm_dynamic_keymap.h"
+}
+
+class DynamicKeymapRamMirror : public TestFixture {
+   protected:
+    void SetUp() override {
+        dynamic_keymap_reset();
+        ASSERT_FALSE(dynamic_keymap_flush_pending());
+    }
+};
+
+TEST_F(DynamicKeymapRamMirror, ReadsAreServedFromMirror) {
+    dynamic_keymap_set_keycode(1, 2, 3, KC_Q);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), KC_Q);
+    EXPECT_EQ(keycode_at_keymap_location(1, 2, 3), KC_Q);
+    // Not yet written back
+    EXPECT_NE(nvm_dynamic_keymap_read_keycode(1, 2, 3), KC_Q);
+    EXPECT_TRUE(dynamic_keymap_flush_pending());
+}
+
+TEST_F(DynamicKeymapRamMirror, WritesAreFlushedAfterDelay) {
+    dynamic_keymap_set_keycode(0, 0, 0, KC_W);
+    dynamic_keymap_set_keycode(3, 3, 9, KC_E);
+
+    idle_for(DYNAMIC_KEYMAP_RAM_MIRROR_FLUSH_DELAY / 2);
+    EXPECT_TRUE(dynamic_keymap_flush_pending());
+
+    // Another write restarts the settle period
+    dynamic_keymap_set_keycode(2, 1, 4, KC_R);
+    idle_for(DYNAMIC_KEYMAP_RAM_MIRROR_FLUSH_DELAY / 2 + 1);
+    EXPECT_TRUE(dynamic_keymap_flush_pending());
+
+    idle_for(DYNAMIC_KEYMAP_RAM_MIRROR_FLUSH_DELAY);
+    EXPECT_FALSE(dynamic_keymap_flush_pending());
+    EXPECT_EQ(nvm_dynamic_keymap_read_keycode(0, 0, 0), KC_W);
+    EXPECT_EQ(nvm_dynamic_keymap_read_keycode(3, 3, 9), KC_E);
+    EXPECT_EQ(nvm_dynamic_keymap_read_keycode(2, 1, 4), KC_R);
+}
+
+TEST_F(DynamicKeymapRamMirror, RewritingSameKeycodeIsNotDirty) {
+    uint16_t keycode = dynamic_keymap_get_keycode(0, 1, 1);
+    dynamic_keymap_set_keycode(0, 1, 1, keycode);
+    EXPECT_FALSE(dynamic_keymap_flush_pending());
+}
+
+TEST_F(DynamicKeymapRamMirror, BufferRoundTrip) {
+    const uint16_t size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+    uint8_t        written[size];
+    uint8_t        read_back[size + 4];
+
+    for (uint16_t i = 0; i < size; i += 2) {
+        uint16_t keycode = KC_A + (i / 2) % 26;
+        written[i]       = keycode >> 8;
+        written[i + 1]   = keycode & 0xFF;
+    }
+
+    // VIA uploads in 28 byte pieces, with an odd-aligned tail
+    for (uint16_t offset = 0; offset < size; offset += 28) {
+        dynamic_keymap_set_buffer(offset, MIN(28, size - offset), &written[offset]);
+    }
+
+    dynamic_keymap_get_buffer(0, size + 4, read_back);
+    EXPECT_EQ(memcmp(written, read_back, size), 0);
+    // Reads past the end of the keymap are zero-filled
+    for (uint16_t i = size; i < size + 4; i++) {
+        EXPECT_EQ(read_back[i], 0);
+    }
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 1), KC_B);
+
+    dynamic_keymap_flush();
+    EXPECT_FALSE(dynamic_keymap_flush_pending());
+
+    nvm_dynamic_keymap_read_buffer(0, size, read_back);
+    EXPECT_EQ(memcmp(written, read_back, size), 0);
+}
+
+TEST_F(DynamicKeymapRamMirror, ResetIsPersistedImmediately) {
+    dynamic_keymap_set_keycode(1, 0, 0, KC_Z);
+    dynamic_keymap_reset();
+
+    EXPECT_FALSE(dynamic_keymap_flush_pending());
+    EXPECT_EQ(nvm_dynamic_keymap_read_keycode(1, 0, 0), dynamic_keymap_get_keycode(1, 0, 0));
+    EXPECT_NE(dynamic_keymap_get_keycode(1, 0, 0), KC_Z);
+}
+
+TEST_F(DynamicKeymapRamMirror, ResetAfterEraseRewritesEveryKey) {
+    // As eeconfig_init() does; the mirror still holds the defaults from SetUp()
+    eeprom_driver_erase();
+    dynamic_keymap_reset();
+
+    EXPECT_FALSE(dynamic_keymap_flush_pending());
+    // What the mirror would load on the next boot
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                EXPECT_EQ(nvm_dynamic_keymap_read_keycode(layer, row, column), keycode_at_keymap_location_raw(layer, row, column)) << "layer " << +layer << ", row " << +row << ", column " << +column;
+            }
+        }
+    }
+}
@@ -0,0 +1,127 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+#include "led_tables.h"
+}
+
+// The conversion as it was before the table-driven kernel, which it has to match exactly
+static rgb_t reference_hsv_to_rgb(hsv_t hsv, bool use_cie) {
+    rgb_t    rgb;
+    uint8_t  region, remainder, p, q, t;
+    uint16_t h, s, v;
+
+    v = use_cie ? CIE1931_CURVE[hsv.v] : hsv.v;
+    if (hsv.s == 0) {
+        rgb.r = rgb.g = rgb.b = v;
+        return rgb;
+    }
+
+    h = hsv.h;
+    s = hsv.s;
+
+    region    = h * 6 / 255;
+    remainder = (h * 2 - region * 85) * 3;
+
+    p = (v * (255 - s)) >> 8;
+    q = (v * (255 - ((s * remainder) >> 8))) >> 8;
+    t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+    switch (region) {
+        case 6:
+        case 0:
+            rgb.r = v;
+            rgb.g = t;
+            rgb.b = p;
+            break;
+        case 1:
+            rgb.r = q;
+            rgb.g = v;
+            rgb.b = p;
+            break;
+        case 2:
+            rgb.r = p;
+            rgb.g = v;
+            rgb.b = t;
+            break;
+        case 3:
+            rgb.r = p;
+            rgb.g = q;
+            rgb.b = v;
+            break;
+        case 4:
+            rgb.r = t;
+            rgb.g = p;
+            rgb.b = v;
+            break;
+        default:
+            rgb.r = v;
+            rgb.g = p;
+            rgb.b = q;
+            break;
+    }
+
+    return rgb;
+}
+
+static bool rgb_equal(rgb_t a, rgb_t b) {
+    return a.r == b.r && a.g == b.g && a.b == b.b;
+}
+
+class HsvToRgb : public ::testing::Test {
+   protected:
+    // Every hue and saturation at one value
+    static std::vector<hsv_t> plane(uint8_t v) {
+        std::vector<hsv_t> colors;
+        for (int h = 0; h < 256; h++) {
+            for (int s = 0; s < 256; s++) {
+                colors.push_back({(uint8_t)h, (uint8_t)s, v});
+            }
+        }
+        return colors;
+    }
+
+    // The batch count is 16 bits wide, so a whole plane goes through in rows
+    static void convert(void (*batch)(const hsv_t *, rgb_t *, uint16_t), const hsv_t *hsv, rgb_t *rgb, size_t count) {
+        for (size_t i = 0; i < count; i += 256) {
+            batch(hsv + i, rgb + i, 256);
+        }
+    }
+};
+
+TEST_F(HsvToRgb, SingleMatchesReferenceForEveryColor) {
+    for (int v = 0; v < 256; v++) {
+        for (const hsv_t &hsv : plane(v)) {
+            ASSERT_TRUE(rgb_equal(hsv_to_rgb(hsv), reference_hsv_to_rgb(hsv, true))) << "h=" << +hsv.h << " s=" << +hsv.s << " v=" << +hsv.v;
+            ASSERT_TRUE(rgb_equal(hsv_to_rgb_nocie(hsv), reference_hsv_to_rgb(hsv, false))) << "h=" << +hsv.h << " s=" << +hsv.s << " v=" << +hsv.v;
+        }
+    }
+}
+
+TEST_F(HsvToRgb, BatchMatchesReferenceForEveryColor) {
+    std::vector<rgb_t> rgb(256 * 256);
+    std::vector<rgb_t> rgb_nocie(256 * 256);
+    for (int v = 0; v < 256; v++) {
+        std::vector<hsv_t> hsv = plane(v);
+        convert(hsv_to_rgb_batch, hsv.data(), rgb.data(), hsv.size());
+        convert(hsv_to_rgb_batch_nocie, hsv.data(), rgb_nocie.data(), hsv.size());
+        for (size_t i = 0; i < hsv.size(); i++) {
+            ASSERT_TRUE(rgb_equal(rgb[i], reference_hsv_to_rgb(hsv[i], true))) << "h=" << +hsv[i].h << " s=" << +hsv[i].s << " v=" << +hsv[i].v;
+            ASSERT_TRUE(rgb_equal(rgb_nocie[i], reference_hsv_to_rgb(hsv[i], false))) << "h=" << +hsv[i].h << " s=" << +hsv[i].s << " v=" << +hsv[i].v;
+        }
+    }
+}
+
+TEST_F(HsvToRgb, BatchConvertsInPlace) {
+    std::vector<hsv_t> hsv = plane(200);
+    std::vector<hsv_t> converted(hsv);
+    convert(hsv_to_rgb_batch_nocie, converted.data(), reinterpret_cast<rgb_t *>(converted.data()), converted.size());
+    for (size_t i = 0; i < hsv.size(); i++) {
+        ASSERT_TRUE(rgb_equal(reinterpret_cast<rgb_t *>(converted.data())[i], reference_hsv_to_rgb(hsv[i], false)));
+    }
+}
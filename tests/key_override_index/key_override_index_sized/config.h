@@ -0,0 +1,9 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+/* KEY_OVERRIDE_INDEX_SIZE is left to default to the size of key_overrides */
+#define KEY_OVERRIDE_INDEX
@@ -0,0 +1,12 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+#include "keymap_introspection.h"
+#include "test_key_overrides_sized.h"
+
+uint32_t key_override_get_calls = 0;
+
+const key_override_t *key_override_get(uint16_t key_override_idx) {
+    key_override_get_calls++;
+    return key_override_get_raw(key_override_idx);
+}
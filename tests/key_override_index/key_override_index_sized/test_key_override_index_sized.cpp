@@ -0,0 +1,45 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_key_overrides_sized.h"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+class KeyOverrideIndexSized : public TestFixture {};
+
+TEST_F(KeyOverrideIndexSized, last_override_is_indexed) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_lsft(0, 0, 0, KC_LSFT);
+    KeymapKey  key_trigger(0, 1, 0, sized_override_trigger(SIZED_OVERRIDES_COUNT - 1));
+    set_keymap({key_lsft, key_trigger});
+
+    /* The first event builds the index from all overrides */
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_lsft.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* With all overrides indexed, the trigger visits only its own override */
+    key_override_get_calls = 0;
+    EXPECT_REPORT(driver, (KC_X));
+    key_trigger.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_LT(key_override_get_calls, 4u);
+
+    EXPECT_REPORT(driver, (KC_LSFT)).Times(AnyNumber());
+    key_trigger.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_lsft.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,21 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+#include "test_key_overrides_sized.h"
+
+/* Override n replaces shift + sized_override_trigger(n), an otherwise unused keycode, with KC_X */
+#define SIZED_OVERRIDE(n) const key_override_t sized_override_##n = ko_make_basic(MOD_MASK_SHIFT, QK_UNICODE + (n), KC_X);
+#define SIZED_ENTRY(n) &sized_override_##n,
+
+#define SIZED_TENS(M, d) M(d##0) M(d##1) M(d##2) M(d##3) M(d##4) M(d##5) M(d##6) M(d##7) M(d##8) M(d##9)
+#define SIZED_ALL(M) SIZED_TENS(M, ) SIZED_TENS(M, 1) SIZED_TENS(M, 2) SIZED_TENS(M, 3) SIZED_TENS(M, 4) SIZED_TENS(M, 5) SIZED_TENS(M, 6) SIZED_TENS(M, 7) SIZED_TENS(M, 8) SIZED_TENS(M, 9)
+
+SIZED_ALL(SIZED_OVERRIDE)
+
+// clang-format off
+const key_override_t *key_overrides[] = {
+    SIZED_ALL(SIZED_ENTRY)
+};
+// clang-format on
+
+_Static_assert(ARRAY_SIZE(key_overrides) == SIZED_OVERRIDES_COUNT, "key_overrides does not match SIZED_OVERRIDES_COUNT");
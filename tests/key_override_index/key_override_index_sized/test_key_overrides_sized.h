@@ -0,0 +1,24 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "keycodes.h"
+
+/* More overrides than the old fixed index size of 64 could hold */
+#define SIZED_OVERRIDES_COUNT 100
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern uint32_t key_override_get_calls;
+
+static inline uint16_t sized_override_trigger(uint16_t override) {
+    return QK_UNICODE + override;
+}
+
+#ifdef __cplusplus
+}
+#endif
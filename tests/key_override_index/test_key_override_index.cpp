@@ -0,0 +1,152 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+class KeyOverrideIndex : public TestFixture {};
+
+TEST_F(KeyOverrideIndex, trigger_with_mods_is_replaced) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_lsft(0, 0, 0, KC_LSFT);
+    KeymapKey  key_bspc(0, 1, 0, KC_BSPC);
+    set_keymap({key_lsft, key_bspc});
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_lsft.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_DEL));
+    key_bspc.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT)).Times(AnyNumber());
+    key_bspc.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_lsft.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndex, keys_without_overrides_pass_through) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_lsft(0, 0, 0, KC_LSFT);
+    KeymapKey  key_x(0, 1, 0, KC_X);
+    set_keymap({key_lsft, key_x});
+
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_x);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_X));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    key_lsft.press();
+    run_one_scan_loop();
+    tap_key(key_x);
+    key_lsft.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndex, mod_pressed_after_trigger_activates) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_lsft(0, 0, 0, KC_LSFT);
+    KeymapKey  key_bspc(0, 1, 0, KC_BSPC);
+    set_keymap({key_lsft, key_bspc});
+
+    EXPECT_REPORT(driver, (KC_BSPC));
+    key_bspc.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* The trigger is taken out at once, the replacement follows after the repeat delay */
+    EXPECT_REPORT(driver, (KC_LSFT, KC_BSPC)).Times(AnyNumber());
+    EXPECT_EMPTY_REPORT(driver).Times(AnyNumber());
+    key_lsft.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_DEL));
+    idle_for(500);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    key_bspc.release();
+    run_one_scan_loop();
+    key_lsft.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndex, mods_alone_activate_keyless_override) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_lctl(0, 0, 0, KC_LCTL);
+    KeymapKey  key_lalt(0, 1, 0, KC_LALT);
+    set_keymap({key_lctl, key_lalt});
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    key_lctl.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Both mods are suppressed, then the replacement follows after the repeat delay */
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_F13));
+    key_lalt.press();
+    idle_for(500);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    key_lalt.release();
+    run_one_scan_loop();
+    key_lctl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndex, first_matching_override_in_definition_order_wins) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_lsft(0, 0, 0, KC_LSFT);
+    KeymapKey  key_a(0, 1, 0, KC_A);
+    KeymapKey  key_a_layer_one(1, 1, 0, KC_A);
+    set_keymap({key_lsft, key_a, key_a_layer_one});
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_REPORT(driver, (KC_LSFT)).Times(AnyNumber());
+    key_lsft.press();
+    run_one_scan_loop();
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    layer_on(1);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_REPORT(driver, (KC_LSFT)).Times(AnyNumber());
+    tap_key(key_a_layer_one);
+    VERIFY_AND_CLEAR(driver);
+    layer_off(1);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_lsft.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,19 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+const key_override_t delete_override        = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+const key_override_t f13_override           = ko_make_basic(MOD_MASK_CA, KC_NO, KC_F13);
+const key_override_t layer_one_a_override   = ko_make_with_layers(MOD_MASK_SHIFT, KC_A, KC_B, 1 << 1);
+const key_override_t all_layers_a_override  = ko_make_basic(MOD_MASK_SHIFT, KC_A, KC_C);
+const key_override_t unreachable_a_override = ko_make_basic(MOD_MASK_SHIFT, KC_A, KC_D);
+
+// clang-format off
+const key_override_t *key_overrides[] = {
+    &delete_override,
+    &f13_override,
+    &layer_one_a_override,
+    &all_layers_a_override,
+    &unreachable_a_override,
+};
+// clang-format on
@@ -0,0 +1,210 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "latency_trace.h"
+#include "raw_hid.h"
+
+void advance_time_us(uint32_t us);
+
+/* Handlers take a fixed amount of time */
+bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    advance_time_us(25);
+    return true;
+}
+
+static bool    raw_hid_passed_on = false;
+static uint8_t raw_hid_reply[32];
+
+void raw_hid_receive(uint8_t *data, uint8_t length) {
+    raw_hid_passed_on = true;
+}
+
+static void send_raw_hid(uint8_t *data, uint8_t length) {
+    memcpy(raw_hid_reply, data, sizeof(raw_hid_reply));
+}
+}
+
+using testing::_;
+
+class LatencyTrace : public TestFixture {
+   protected:
+    void SetUp() override {
+        latency_trace_clear();
+    }
+
+    static uint32_t elapsed(const latency_trace_entry_t *entry, latency_trace_stage_t from, latency_trace_stage_t to) {
+        EXPECT_TRUE(entry->stages & (1 << from));
+        EXPECT_TRUE(entry->stages & (1 << to));
+        return entry->time[to] - entry->time[from];
+    }
+};
+
+TEST_F(LatencyTrace, PlainKeyReachesEveryStage) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 1, 2, KC_A);
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    const latency_trace_entry_t *entry = latency_trace_get(0);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->key.row, 2);
+    EXPECT_EQ(entry->key.col, 1);
+    EXPECT_TRUE(entry->pressed);
+    /* No raw matrix hook in the test matrix */
+    EXPECT_FALSE(entry->stages & (1 << LATENCY_TRACE_RAW));
+    EXPECT_EQ(elapsed(entry, LATENCY_TRACE_SCAN, LATENCY_TRACE_PROCESS), 0);
+    EXPECT_EQ(elapsed(entry, LATENCY_TRACE_PROCESS, LATENCY_TRACE_HANDLED), 25);
+    EXPECT_EQ(elapsed(entry, LATENCY_TRACE_SCAN, LATENCY_TRACE_REPORT), 25);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    entry = latency_trace_get(0);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_FALSE(entry->pressed);
+    EXPECT_TRUE(entry->stages & (1 << LATENCY_TRACE_REPORT));
+}
+
+TEST_F(LatencyTrace, TapHoldWaitIsAttributedToTapping) {
+    TestDriver driver;
+    KeymapKey  key_lt(0, 0, 0, LT(1, KC_B));
+    set_keymap({key_lt});
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    key_lt.press();
+    idle_for(50);
+    key_lt.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* The press sat in the tapping buffer until the release resolved it as a tap */
+    const latency_trace_entry_t *press = latency_trace_get(1);
+    ASSERT_NE(press, nullptr);
+    EXPECT_TRUE(press->pressed);
+    EXPECT_EQ(elapsed(press, LATENCY_TRACE_SCAN, LATENCY_TRACE_PROCESS), 50 * 1000);
+}
+
+TEST_F(LatencyTrace, RawChangeMarksDebounceStart) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    latency_trace_matrix_changed();
+    idle_for(5);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    const latency_trace_entry_t *press = latency_trace_get(1);
+    ASSERT_NE(press, nullptr);
+    EXPECT_EQ(elapsed(press, LATENCY_TRACE_RAW, LATENCY_TRACE_SCAN), 5 * 1000);
+}
+
+TEST_F(LatencyTrace, ReportOnlyMarksTheEventThatCausedIt) {
+    TestDriver driver;
+    KeymapKey  key_mo(0, 0, 0, MO(1));
+    KeymapKey  key_b(0, 1, 0, KC_B);
+    set_keymap({key_mo, key_b, KeymapKey(1, 0, 0, KC_TRNS), KeymapKey(1, 1, 0, KC_TRNS)});
+
+    /* The layer key changes nothing the host sees */
+    key_mo.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    key_b.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    const latency_trace_entry_t *layer = latency_trace_get(1);
+    ASSERT_NE(layer, nullptr);
+    EXPECT_TRUE(layer->stages & (1 << LATENCY_TRACE_HANDLED));
+    EXPECT_FALSE(layer->stages & (1 << LATENCY_TRACE_REPORT));
+
+    const latency_trace_entry_t *key = latency_trace_get(0);
+    ASSERT_NE(key, nullptr);
+    EXPECT_TRUE(key->stages & (1 << LATENCY_TRACE_REPORT));
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_b.release();
+    key_mo.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LatencyTrace, RingKeepsMostRecentEntries) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A)).Times(3);
+    EXPECT_EMPTY_REPORT(driver).Times(3);
+    tap_keys(key_a, key_a, key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    ASSERT_NE(latency_trace_get(LATENCY_TRACE_BUFFER_SIZE - 1), nullptr);
+    EXPECT_EQ(latency_trace_get(LATENCY_TRACE_BUFFER_SIZE), nullptr);
+    EXPECT_EQ(latency_trace_get(0)->trace_id - latency_trace_get(LATENCY_TRACE_BUFFER_SIZE - 1)->trace_id, LATENCY_TRACE_BUFFER_SIZE - 1);
+}
+
+TEST_F(LatencyTrace, RawHidReturnsEntries) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 3, 1, KC_A);
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    uint8_t data[32] = {LATENCY_TRACE_RAW_HID_ID, LATENCY_TRACE_RAW_HID_GET_ENTRY, 0};
+    ASSERT_TRUE(latency_trace_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[3], 0);
+    EXPECT_EQ(data[6], 1); // row
+    EXPECT_EQ(data[7], 3); // col
+    EXPECT_EQ(data[8], 1); // pressed
+    EXPECT_EQ(data[9], latency_trace_get(0)->stages);
+
+    uint8_t past_end[32] = {LATENCY_TRACE_RAW_HID_ID, LATENCY_TRACE_RAW_HID_GET_ENTRY, 1};
+    ASSERT_TRUE(latency_trace_raw_hid_receive(past_end, sizeof(past_end)));
+    EXPECT_EQ(past_end[3], 1);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LatencyTrace, RawHidDispatchRepliesToTraceRequests) {
+    host_driver_t driver = {};
+    driver.send_raw_hid  = send_raw_hid;
+    host_set_driver(&driver);
+    raw_hid_passed_on = false;
+    memset(raw_hid_reply, 0, sizeof(raw_hid_reply));
+
+    uint8_t clear[32] = {LATENCY_TRACE_RAW_HID_ID, LATENCY_TRACE_RAW_HID_CLEAR};
+    raw_hid_receive_quantum(clear, sizeof(clear));
+    EXPECT_FALSE(raw_hid_passed_on);
+    EXPECT_EQ(raw_hid_reply[0], LATENCY_TRACE_RAW_HID_ID);
+    EXPECT_EQ(raw_hid_reply[1], LATENCY_TRACE_RAW_HID_CLEAR);
+
+    uint8_t other[32] = {0x02};
+    raw_hid_receive_quantum(other, sizeof(other));
+    EXPECT_TRUE(raw_hid_passed_on);
+
+    host_set_driver(nullptr);
+}
@@ -0,0 +1,188 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iostream>
+#include "keycodes.h"
+#include "test_common.hpp"
+
+using testing::_;
+
+class LayerResolutionCache : public TestFixture {
+   protected:
+    /* Maps every key on every layer, with only layer 0 and `top_layer` being non-transparent. */
+    void set_mostly_transparent_keymap(uint8_t top_layer) {
+        keymap.clear();
+        layer_resolution_cache_invalidate();
+        for (uint8_t layer = 0; layer < MAX_LAYER; layer++) {
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    uint16_t keycode = (layer == 0 || layer == top_layer) ? KC_A + col : KC_TRNS;
+                    add_key(KeymapKey(layer, col, row, keycode));
+                }
+            }
+        }
+    }
+};
+
+TEST_F(LayerResolutionCache, ResolvesTopmostNonTransparentLayer) {
+    TestDriver driver;
+    KeymapKey  key_a    = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey  key_b    = KeymapKey(0, 1, 0, KC_B);
+    KeymapKey  key_trns = KeymapKey(1, 0, 0, KC_TRNS);
+    KeymapKey  key_c    = KeymapKey(1, 1, 0, KC_C);
+
+    set_keymap({key_a, key_b, key_trns, key_c});
+
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+    EXPECT_EQ(layer_switch_get_layer(key_b.position), 0);
+
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+    EXPECT_EQ(layer_switch_get_layer(key_b.position), 1);
+
+    layer_off(1);
+    EXPECT_EQ(layer_switch_get_layer(key_b.position), 0);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerResolutionCache, FollowsDirectLayerStateWrites) {
+    TestDriver driver;
+    KeymapKey  key_a = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey  key_b = KeymapKey(1, 0, 0, KC_B);
+
+    set_keymap({key_a, key_b});
+
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+
+    /* Split targets update layer_state without going through layer_state_set() */
+    layer_state = (layer_state_t)1 << 1;
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 1);
+
+    layer_state = 0;
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerResolutionCache, FollowsDefaultLayerChanges) {
+    TestDriver driver;
+    KeymapKey  key_a = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey  key_b = KeymapKey(1, 0, 0, KC_B);
+
+    set_keymap({key_a, key_b});
+
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+
+    default_layer_set((layer_state_t)1 << 1);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 1);
+
+    default_layer_set((layer_state_t)1 << 0);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerResolutionCache, KeyInvalidationPicksUpKeymapChange) {
+    TestDriver driver;
+    KeymapKey  key_a = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey  key_b = KeymapKey(1, 0, 0, KC_TRNS);
+
+    set_keymap({key_a, key_b});
+
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+
+    /* Same as what dynamic_keymap_set_keycode() does after writing the new keycode */
+    keymap.pop_back();
+    keymap.push_back(KeymapKey(1, 0, 0, KC_B));
+    layer_resolution_cache_invalidate_key(key_b.position);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 1);
+
+    layer_off(1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerResolutionCache, KeypressUsesResolvedLayer) {
+    TestDriver driver;
+    KeymapKey  key_layer = KeymapKey(0, 0, 0, MO(1));
+    KeymapKey  key_a     = KeymapKey(0, 1, 0, KC_A);
+    KeymapKey  key_trns  = KeymapKey(1, 0, 0, KC_TRNS);
+    KeymapKey  key_b     = KeymapKey(1, 1, 0, KC_B);
+
+    set_keymap({key_layer, key_a, key_trns, key_b});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    key_layer.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+
+    key_layer.release();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerResolutionCache, BenchmarkCachedVersusWalk) {
+    TestDriver driver;
+
+    /* 32 layers, all enabled, with only the base layer holding real keycodes */
+    set_mostly_transparent_keymap(0);
+    layer_state_set((layer_state_t)~0);
+
+    constexpr int iterations = 10;
+    using clock              = std::chrono::steady_clock;
+
+    uint32_t walk_layers   = 0;
+    uint32_t cached_layers = 0;
+
+    auto walk_start = clock::now();
+    for (int i = 0; i < iterations; i++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                layer_resolution_cache_invalidate();
+                walk_layers += layer_switch_get_layer(keypos_t{.col = col, .row = row});
+            }
+        }
+    }
+    auto walk_time = clock::now() - walk_start;
+
+    /* Warm the cache, so only table reads are timed */
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            layer_switch_get_layer(keypos_t{.col = col, .row = row});
+        }
+    }
+
+    auto cached_start = clock::now();
+    for (int i = 0; i < iterations; i++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                cached_layers += layer_switch_get_layer(keypos_t{.col = col, .row = row});
+            }
+        }
+    }
+    auto cached_time = clock::now() - cached_start;
+
+    EXPECT_EQ(walk_layers, 0);
+    EXPECT_EQ(cached_layers, 0);
+
+    const int lookups = iterations * MATRIX_ROWS * MATRIX_COLS;
+    std::cout << "[ BENCH    ] layer walk:   " << std::chrono::duration_cast<std::chrono::nanoseconds>(walk_time).count() / lookups << " ns/lookup" << std::endl;
+    std::cout << "[ BENCH    ] layer cached: " << std::chrono::duration_cast<std::chrono::nanoseconds>(cached_time).count() / lookups << " ns/lookup" << std::endl;
+
+    layer_clear();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,9 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define OLED_SKIP_UNCHANGED_BLOCKS
+#define OLED_UPDATE_MERGE_LIMIT 6
@@ -0,0 +1,161 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "oled_driver.h"
+
+extern uint8_t oled_buffer[OLED_MATRIX_SIZE];
+}
+
+struct transfer_t {
+    uint16_t address;
+    uint16_t length;
+
+    bool operator==(const transfer_t &other) const {
+        return address == other.address && length == other.length;
+    }
+};
+
+// A model of the SSD1306 display memory in horizontal addressing mode
+static uint8_t                 display_ram[OLED_DISPLAY_HEIGHT / 8][OLED_DISPLAY_WIDTH];
+static uint8_t                 window[4];
+static uint8_t                 column, page;
+static std::vector<transfer_t> transfers;
+
+extern "C" void oled_driver_init(void) {}
+
+extern "C" bool oled_send_cmd(const uint8_t *data, uint16_t size) {
+    // Only the window commands sent by the renderer are of interest
+    if (size == 7 && data[1] == 0x21 && data[4] == 0x22) {
+        window[0] = data[2];
+        window[1] = data[3];
+        window[2] = data[5];
+        window[3] = data[6];
+        column    = window[0];
+        page      = window[2];
+    }
+    return true;
+}
+
+extern "C" bool oled_send_data(const uint8_t *data, uint16_t size) {
+    transfers.push_back({(uint16_t)(page * OLED_DISPLAY_WIDTH + column), size});
+    for (uint16_t i = 0; i < size; ++i) {
+        display_ram[page][column] = data[i];
+        if (++column > window[1]) {
+            column = window[0];
+            if (++page > window[3]) {
+                page = window[2];
+            }
+        }
+    }
+    return true;
+}
+
+class OledRender : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        memset(display_ram, 0xAA, sizeof(display_ram));
+        ASSERT_TRUE(oled_init(OLED_ROTATION_0));
+        oled_render_dirty(true);
+        transfers.clear();
+    }
+
+    void dirty_blocks(uint8_t first, uint8_t count) {
+        for (uint8_t i = first; i < first + count; ++i) {
+            oled_write_raw_byte(i + 1, i * OLED_BLOCK_SIZE);
+        }
+    }
+
+    void expect_display_matches_buffer(void) {
+        EXPECT_EQ(memcmp(display_ram, oled_buffer, OLED_MATRIX_SIZE), 0);
+    }
+};
+
+TEST_F(OledRender, InitClearsWholeDisplay) {
+    memset(display_ram, 0xAA, sizeof(display_ram));
+    ASSERT_TRUE(oled_init(OLED_ROTATION_0));
+    oled_render_dirty(true);
+
+    // Six blocks at a time, with a run that starts mid-page split at the end of that page
+    EXPECT_EQ(transfers, std::vector<transfer_t>({{0, 192}, {192, 64}, {256, 128}, {384, 128}}));
+    expect_display_matches_buffer();
+}
+
+TEST_F(OledRender, NeighbouringBlocksShareATransfer) {
+    dirty_blocks(1, 2);
+    oled_render_dirty(true);
+
+    EXPECT_EQ(transfers, std::vector<transfer_t>({{32, 64}}));
+    expect_display_matches_buffer();
+}
+
+TEST_F(OledRender, TransfersStartingMidPageStopAtItsEnd) {
+    dirty_blocks(2, 6);
+    oled_render_dirty(true);
+
+    EXPECT_EQ(transfers, std::vector<transfer_t>({{64, 64}, {128, 128}}));
+    expect_display_matches_buffer();
+}
+
+TEST_F(OledRender, TransfersFromColumnZeroWrapOntoTheNextPage) {
+    dirty_blocks(4, 6);
+    oled_render_dirty(true);
+
+    EXPECT_EQ(transfers, std::vector<transfer_t>({{128, 192}}));
+    expect_display_matches_buffer();
+}
+
+TEST_F(OledRender, ProcessLimitCountsMergedUpdates) {
+    dirty_blocks(1, 2);
+    dirty_blocks(5, 1);
+
+    // The default limit of one update per call still sends neighbouring blocks together
+    oled_render();
+    EXPECT_EQ(transfers, std::vector<transfer_t>({{32, 64}}));
+    oled_render();
+    EXPECT_EQ(transfers, std::vector<transfer_t>({{32, 64}, {160, 32}}));
+    expect_display_matches_buffer();
+}
+
+TEST_F(OledRender, RedrawingTheSameContentIsSkipped) {
+    oled_write_ln("Layer: Base", false);
+    oled_render_dirty(true);
+    EXPECT_FALSE(transfers.empty());
+    transfers.clear();
+
+    oled_clear();
+    oled_write_ln("Layer: Base", false);
+    oled_render_dirty(true);
+    EXPECT_TRUE(transfers.empty());
+
+    oled_clear();
+    oled_write_ln("Layer: Nav", false);
+    oled_render_dirty(true);
+    EXPECT_FALSE(transfers.empty());
+    expect_display_matches_buffer();
+}
+
+TEST_F(OledRender, ScrollingForgetsWhatWasSent) {
+    ASSERT_TRUE(oled_scroll_left());
+    ASSERT_TRUE(oled_scroll_off());
+    oled_render_dirty(true);
+
+    EXPECT_EQ(transfers.size(), 4);
+    expect_display_matches_buffer();
+}
+
+TEST_F(OledRender, RotatedBlocksAreSentOneAtATime) {
+    ASSERT_TRUE(oled_init(OLED_ROTATION_90));
+    oled_write_ln("Hi", false);
+    oled_render_dirty(true);
+
+    EXPECT_EQ(transfers.size(), OLED_BLOCK_COUNT);
+    for (const transfer_t &transfer : transfers) {
+        EXPECT_EQ(transfer.length, OLED_BLOCK_SIZE);
+    }
+}
@@ -0,0 +1,9 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER 1
+#define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 32
@@ -0,0 +1,134 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "mock_qp_spi_display.h"
+#include <string.h>
+#include "qp_comms.h"
+
+mock_qp_spi_display_t mock_qp_spi_display;
+
+// Any comms operation waits for the background send to finish, so its buffer must not have changed before now
+static void mock_comms_complete_in_flight(void) {
+    if (mock_qp_spi_display.in_flight && memcmp(mock_qp_spi_display.in_flight, mock_qp_spi_display.in_flight_copy, mock_qp_spi_display.in_flight_bytes) != 0) {
+        mock_qp_spi_display.overwritten_in_flight++;
+    }
+    mock_qp_spi_display.in_flight = NULL;
+}
+
+static uint32_t mock_comms_record(const void *data, uint32_t byte_count, bool background) {
+    mock_comms_complete_in_flight();
+    if (mock_qp_spi_display.num_sends < MOCK_QP_SPI_MAX_SENDS) {
+        mock_qp_spi_display.sends[mock_qp_spi_display.num_sends++] = (mock_qp_spi_send_t){.data = data, .byte_count = byte_count, .background = background};
+    }
+    return byte_count;
+}
+
+static bool mock_comms_init(painter_device_t device) {
+    return true;
+}
+
+static bool mock_comms_start(painter_device_t device) {
+    return true;
+}
+
+static void mock_comms_stop(painter_device_t device) {
+    mock_comms_complete_in_flight();
+}
+
+static uint32_t mock_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
+    return mock_comms_record(data, byte_count, false);
+}
+
+static uint32_t mock_comms_send_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    mock_comms_record(data, byte_count, true);
+    mock_qp_spi_display.in_flight       = data;
+    mock_qp_spi_display.in_flight_bytes = byte_count;
+    memcpy(mock_qp_spi_display.in_flight_copy, data, byte_count);
+    return byte_count;
+}
+
+static const painter_comms_vtable_t mock_comms_vtable = {
+    .comms_init       = mock_comms_init,
+    .comms_start      = mock_comms_start,
+    .comms_stop       = mock_comms_stop,
+    .comms_send       = mock_comms_send,
+    .comms_send_async = mock_comms_send_async,
+};
+
+static bool mock_init(painter_device_t device, painter_rotation_t rotation) {
+    return true;
+}
+
+static bool mock_noop(painter_device_t device) {
+    return true;
+}
+
+static bool mock_power(painter_device_t device, bool power_on) {
+    return true;
+}
+
+static bool mock_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    uint16_t window[4] = {left, top, right, bottom};
+    qp_comms_send(device, window, sizeof(window));
+    return true;
+}
+
+static bool mock_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    uint32_t byte_count = native_pixel_count * 2;
+    if (mock_qp_spi_display.pixdata_bytes + byte_count <= MOCK_QP_SPI_MAX_BYTES) {
+        memcpy(&mock_qp_spi_display.pixdata[mock_qp_spi_display.pixdata_bytes], pixel_data, byte_count);
+        mock_qp_spi_display.pixdata_bytes += byte_count;
+    }
+    qp_comms_send(device, pixel_data, byte_count);
+    return true;
+}
+
+// Keeps the HSV value, so tests can tell which palette entry was drawn
+static bool mock_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    for (int16_t i = 0; i < palette_size; ++i) {
+        palette[i].rgb565 = 0x1000 | palette[i].hsv888.v;
+    }
+    return true;
+}
+
+static bool mock_append_pixels(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
+    uint16_t *buf = (uint16_t *)target_buffer;
+    for (uint32_t i = 0; i < pixel_count; ++i) {
+        buf[pixel_offset + i] = palette[palette_indices[i]].rgb565;
+    }
+    return true;
+}
+
+static bool mock_append_pixdata(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
+    target_buffer[pixdata_offset] = pixdata_byte;
+    return true;
+}
+
+static const painter_driver_vtable_t mock_qp_spi_display_vtable = {
+    .init            = mock_init,
+    .power           = mock_power,
+    .clear           = mock_noop,
+    .flush           = mock_noop,
+    .viewport        = mock_viewport,
+    .pixdata         = mock_pixdata,
+    .palette_convert = mock_palette_convert,
+    .append_pixels   = mock_append_pixels,
+    .append_pixdata  = mock_append_pixdata,
+};
+
+painter_device_t mock_qp_spi_display_make(uint16_t panel_width, uint16_t panel_height) {
+    memset(&mock_qp_spi_display, 0, sizeof(mock_qp_spi_display));
+    mock_qp_spi_display.base.driver_vtable         = &mock_qp_spi_display_vtable;
+    mock_qp_spi_display.base.comms_vtable          = &mock_comms_vtable;
+    mock_qp_spi_display.base.native_bits_per_pixel = 16;
+    mock_qp_spi_display.base.panel_width           = panel_width;
+    mock_qp_spi_display.base.panel_height          = panel_height;
+    return (painter_device_t)&mock_qp_spi_display;
+}
+
+void mock_qp_spi_display_reset(void) {
+    mock_qp_spi_display.num_sends             = 0;
+    mock_qp_spi_display.pixdata_bytes         = 0;
+    mock_qp_spi_display.in_flight             = NULL;
+    mock_qp_spi_display.overwritten_in_flight = 0;
+}
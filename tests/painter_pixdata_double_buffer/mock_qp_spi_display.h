@@ -0,0 +1,40 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "qp_internal.h"
+
+#define MOCK_QP_SPI_MAX_SENDS 256
+#define MOCK_QP_SPI_MAX_BYTES 4096
+
+typedef struct {
+    const void *data;
+    uint32_t    byte_count;
+    bool        background;
+} mock_qp_spi_send_t;
+
+// A 16bpp display whose comms record every send, and whether a background send's buffer was written to before it could
+// have finished going out
+typedef struct {
+    painter_driver_t base; // must be first, so it can be cast to/from the painter_device_t* type
+
+    mock_qp_spi_send_t sends[MOCK_QP_SPI_MAX_SENDS];
+    uint32_t           num_sends;
+
+    // Everything sent as pixel data, in order
+    uint8_t  pixdata[MOCK_QP_SPI_MAX_BYTES];
+    uint32_t pixdata_bytes;
+
+    // The background send still in progress, and what it contained when it started
+    const void *in_flight;
+    uint8_t     in_flight_copy[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+    uint32_t    in_flight_bytes;
+    uint32_t    overwritten_in_flight;
+} mock_qp_spi_display_t;
+
+extern mock_qp_spi_display_t mock_qp_spi_display;
+
+painter_device_t mock_qp_spi_display_make(uint16_t panel_width, uint16_t panel_height);
+void             mock_qp_spi_display_reset(void);
@@ -0,0 +1,8 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+QUANTUM_PAINTER_ENABLE = yes
+QUANTUM_PAINTER_DRIVERS = surface
+DEFERRED_EXEC_ENABLE = yes
+
+SRC += mock_qp_spi_display.c
@@ -0,0 +1,175 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qff.h"
+#include "qp_draw.h"
+#include "mock_qp_spi_display.h"
+}
+
+#define LINE_HEIGHT 8
+#define GLYPH_WIDTH 5
+
+static void append(std::vector<uint8_t> &v, const void *p, size_t n) {
+    v.insert(v.end(), (const uint8_t *)p, (const uint8_t *)p + n);
+}
+
+static qgf_block_header_v1_t block_header(uint8_t type_id, uint32_t length) {
+    qgf_block_header_v1_t header = {};
+    header.type_id               = type_id;
+    header.neg_type_id           = ~type_id;
+    header.length                = length;
+    return header;
+}
+
+static std::vector<uint8_t> glyph_pixels(char c) {
+    std::vector<uint8_t> pixels((GLYPH_WIDTH * LINE_HEIGHT) / 8);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = (uint8_t)(c * 37 + i * 91);
+    }
+    return pixels;
+}
+
+// An uncompressed 1bpp QFF font held in memory, so it is drawn through the palette decoder
+static std::vector<uint8_t> build_font(const std::string &chars) {
+    std::vector<uint8_t> font;
+
+    qff_font_descriptor_v1_t descriptor = {};
+    descriptor.header                   = block_header(QFF_FONT_DESCRIPTOR_TYPEID, sizeof(qff_font_descriptor_v1_t) - sizeof(qgf_block_header_v1_t));
+    descriptor.magic                    = QFF_MAGIC;
+    descriptor.qff_version              = 0x01;
+    descriptor.line_height              = LINE_HEIGHT;
+    descriptor.has_ascii_table          = false;
+    descriptor.num_unicode_glyphs       = chars.size();
+    descriptor.format                   = GRAYSCALE_1BPP;
+    descriptor.compression_scheme       = IMAGE_UNCOMPRESSED;
+    append(font, &descriptor, sizeof(descriptor));
+
+    std::vector<uint8_t> glyph_data;
+    qgf_block_header_v1_t unicode_header = block_header(QFF_UNICODE_GLYPH_DESCRIPTOR_TYPEID, chars.size() * sizeof(qff_unicode_glyph_v1_t));
+    append(font, &unicode_header, sizeof(unicode_header));
+    for (char c : chars) {
+        qff_unicode_glyph_v1_t glyph = {};
+        glyph.code_point             = c;
+        glyph.value                  = (glyph_data.size() << QFF_GLYPH_WIDTH_BITS) | GLYPH_WIDTH;
+        append(font, &glyph, sizeof(glyph));
+        std::vector<uint8_t> pixels = glyph_pixels(c);
+        append(glyph_data, pixels.data(), pixels.size());
+    }
+
+    qgf_block_header_v1_t data_header = block_header(0x04, glyph_data.size());
+    append(font, &data_header, sizeof(data_header));
+    append(font, glyph_data.data(), glyph_data.size());
+
+    qff_font_descriptor_v1_t *written = (qff_font_descriptor_v1_t *)font.data();
+    written->total_file_size          = font.size();
+    written->neg_total_file_size      = ~written->total_file_size;
+    return font;
+}
+
+// What the mock display should receive for the string, as drawn by mock_palette_convert()
+static std::vector<uint16_t> expected_pixdata(const std::string &text) {
+    std::vector<uint16_t> expected;
+    for (char c : text) {
+        std::vector<uint8_t> pixels = glyph_pixels(c);
+        for (uint16_t n = 0; n < GLYPH_WIDTH * LINE_HEIGHT; ++n) {
+            expected.push_back(((pixels[n / 8] >> (n % 8)) & 1) ? 0x10FF : 0x1000);
+        }
+    }
+    return expected;
+}
+
+class PainterPixdataDoubleBuffer : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        display = mock_qp_spi_display_make(64, LINE_HEIGHT);
+        ASSERT_TRUE(qp_init(display, QP_ROTATION_0));
+        font_data = build_font("ABC");
+        font      = qp_load_font_mem(font_data.data());
+        ASSERT_NE(font, nullptr);
+        mock_qp_spi_display_reset();
+    }
+
+    void TearDown() override {
+        qp_close_font(font);
+    }
+
+    std::vector<mock_qp_spi_send_t> background_sends(void) {
+        std::vector<mock_qp_spi_send_t> sends;
+        for (uint32_t i = 0; i < mock_qp_spi_display.num_sends; ++i) {
+            if (mock_qp_spi_display.sends[i].background) {
+                sends.push_back(mock_qp_spi_display.sends[i]);
+            }
+        }
+        return sends;
+    }
+
+    painter_device_t      display;
+    std::vector<uint8_t>  font_data;
+    painter_font_handle_t font;
+};
+
+TEST_F(PainterPixdataDoubleBuffer, DecodedPixelsArriveInOrder) {
+    EXPECT_EQ(qp_drawtext_recolor(display, 0, 0, font, "CAB", 0, 0, 255, 0, 0, 0), 3 * GLYPH_WIDTH);
+
+    std::vector<uint16_t> expected = expected_pixdata("CAB");
+    ASSERT_EQ(mock_qp_spi_display.pixdata_bytes, expected.size() * sizeof(uint16_t));
+    EXPECT_EQ(memcmp(mock_qp_spi_display.pixdata, expected.data(), mock_qp_spi_display.pixdata_bytes), 0);
+}
+
+TEST_F(PainterPixdataDoubleBuffer, DecodingAlternatesBetweenBuffers) {
+    EXPECT_EQ(qp_drawtext_recolor(display, 0, 0, font, "ABC", 0, 0, 255, 0, 0, 0), 3 * GLYPH_WIDTH);
+
+    // 40 pixels per glyph go out as 16 + 16 + 8
+    std::vector<mock_qp_spi_send_t> sends = background_sends();
+    ASSERT_EQ(sends.size(), 9);
+    std::set<const void *> buffers;
+    for (size_t i = 0; i < sends.size(); ++i) {
+        EXPECT_EQ(sends[i].byte_count, (i % 3 == 2) ? 16 : 32) << "send " << i;
+        if (i > 0) {
+            EXPECT_NE(sends[i].data, sends[i - 1].data) << "send " << i;
+        }
+        buffers.insert(sends[i].data);
+    }
+    EXPECT_EQ(buffers.size(), 2);
+}
+
+TEST_F(PainterPixdataDoubleBuffer, BufferInFlightIsNeverWritten) {
+    EXPECT_EQ(qp_drawtext_recolor(display, 0, 0, font, "ABCABC", 0, 0, 255, 0, 0, 0), 6 * GLYPH_WIDTH);
+    EXPECT_GT(background_sends().size(), 0);
+    EXPECT_EQ(mock_qp_spi_display.overwritten_in_flight, 0);
+    EXPECT_EQ(mock_qp_spi_display.in_flight, nullptr);
+}
+
+TEST_F(PainterPixdataDoubleBuffer, FillsAreSentInTheForeground) {
+    // A fill sends the same buffer repeatedly, so it can't be handed off
+    EXPECT_TRUE(qp_rect(display, 0, 0, 63, LINE_HEIGHT - 1, 0, 0, 255, true));
+    EXPECT_EQ(background_sends().size(), 0);
+    EXPECT_EQ(mock_qp_spi_display.pixdata_bytes, 64 * LINE_HEIGHT * 2);
+    for (uint32_t i = 0; i < mock_qp_spi_display.pixdata_bytes / 2; ++i) {
+        ASSERT_EQ(((uint16_t *)mock_qp_spi_display.pixdata)[i], 0x10FF) << i;
+    }
+}
+
+TEST_F(PainterPixdataDoubleBuffer, CommandsWaitForPixelData) {
+    EXPECT_EQ(qp_drawtext_recolor(display, 0, 0, font, "AB", 0, 0, 255, 0, 0, 0), 2 * GLYPH_WIDTH);
+
+    // The second glyph's viewport follows the first glyph's last block, which has to have been sent by then
+    uint32_t last_background = 0;
+    for (uint32_t i = 0; i < mock_qp_spi_display.num_sends; ++i) {
+        if (mock_qp_spi_display.sends[i].background) {
+            last_background = i;
+        } else if (last_background > 0) {
+            EXPECT_EQ(mock_qp_spi_display.sends[i].byte_count, 8) << "send " << i;
+            break;
+        }
+    }
+    EXPECT_EQ(mock_qp_spi_display.overwritten_in_flight, 0);
+}
@@ -0,0 +1,9 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define QUANTUM_PAINTER_FONT_GLYPH_CACHE_ENTRIES 2
+#define QUANTUM_PAINTER_FONT_GLYPH_CACHE_BYTES 4
@@ -0,0 +1,238 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qff.h"
+#include "qp_surface.h"
+#include "qp_surface_internal.h"
+}
+
+#define LINE_HEIGHT 8
+
+static surface_painter_device_t surface_storage;
+static uint8_t                  surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(64, LINE_HEIGHT, 16)];
+
+// A 1bpp QFF font held in memory, with a distinct bit pattern for each glyph
+struct test_font_t {
+    std::vector<uint8_t>       data;
+    std::map<uint32_t, size_t> glyph_data; // where each glyph's pixel data starts in `data`
+};
+
+static void append(std::vector<uint8_t> &v, const void *p, size_t n) {
+    v.insert(v.end(), (const uint8_t *)p, (const uint8_t *)p + n);
+}
+
+static qgf_block_header_v1_t block_header(uint8_t type_id, uint32_t length) {
+    qgf_block_header_v1_t header = {};
+    header.type_id               = type_id;
+    header.neg_type_id           = ~type_id;
+    header.length                = length;
+    return header;
+}
+
+static std::vector<uint8_t> glyph_pixels(uint32_t code_point, uint8_t width) {
+    std::vector<uint8_t> pixels((width * LINE_HEIGHT) / 8);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = (uint8_t)((code_point >> ((i % 3) * 8)) ^ (0x5A + i));
+    }
+    return pixels;
+}
+
+// Glyphs are written in the order given, so tests can build unsorted tables
+static test_font_t build_font(const std::vector<uint32_t> &code_points, uint8_t width, painter_compression_t compression) {
+    std::vector<uint8_t>  glyph_data;
+    std::vector<uint32_t> glyph_offsets;
+    for (uint32_t code_point : code_points) {
+        std::vector<uint8_t> pixels = glyph_pixels(code_point, width);
+        glyph_offsets.push_back(glyph_data.size());
+        if (compression == IMAGE_COMPRESSED_RLE) {
+            // A single non-repeating run
+            glyph_data.push_back(127 + pixels.size());
+        }
+        append(glyph_data, pixels.data(), pixels.size());
+    }
+
+    test_font_t font;
+
+    qff_font_descriptor_v1_t descriptor = {};
+    descriptor.header                   = block_header(QFF_FONT_DESCRIPTOR_TYPEID, sizeof(qff_font_descriptor_v1_t) - sizeof(qgf_block_header_v1_t));
+    descriptor.magic                    = QFF_MAGIC;
+    descriptor.qff_version              = 0x01;
+    descriptor.line_height              = LINE_HEIGHT;
+    descriptor.has_ascii_table          = false;
+    descriptor.num_unicode_glyphs       = code_points.size();
+    descriptor.format                   = GRAYSCALE_1BPP;
+    descriptor.compression_scheme       = compression;
+    append(font.data, &descriptor, sizeof(descriptor));
+
+    qgf_block_header_v1_t unicode_header = block_header(QFF_UNICODE_GLYPH_DESCRIPTOR_TYPEID, code_points.size() * sizeof(qff_unicode_glyph_v1_t));
+    append(font.data, &unicode_header, sizeof(unicode_header));
+    for (size_t i = 0; i < code_points.size(); ++i) {
+        qff_unicode_glyph_v1_t glyph = {};
+        glyph.code_point             = code_points[i];
+        glyph.value                  = (glyph_offsets[i] << QFF_GLYPH_WIDTH_BITS) | width;
+        append(font.data, &glyph, sizeof(glyph));
+    }
+
+    qgf_block_header_v1_t data_header = block_header(0x04, glyph_data.size());
+    append(font.data, &data_header, sizeof(data_header));
+    for (size_t i = 0; i < code_points.size(); ++i) {
+        font.glyph_data[code_points[i]] = font.data.size() + glyph_offsets[i] + (compression == IMAGE_COMPRESSED_RLE ? 1 : 0);
+    }
+    append(font.data, glyph_data.data(), glyph_data.size());
+
+    qff_font_descriptor_v1_t *written = (qff_font_descriptor_v1_t *)font.data.data();
+    written->total_file_size          = font.data.size();
+    written->neg_total_file_size      = ~written->total_file_size;
+    return font;
+}
+
+static std::string utf8(uint32_t code_point) {
+    std::string s;
+    if (code_point < 0x80) {
+        s += (char)code_point;
+    } else if (code_point < 0x800) {
+        s += (char)(0xC0 | (code_point >> 6));
+        s += (char)(0x80 | (code_point & 0x3F));
+    } else {
+        s += (char)(0xE0 | (code_point >> 12));
+        s += (char)(0x80 | ((code_point >> 6) & 0x3F));
+        s += (char)(0x80 | (code_point & 0x3F));
+    }
+    return s;
+}
+
+class PainterQffGlyphLookup : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        memset(&surface_storage, 0, sizeof(surface_storage));
+        surface = qp_make_rgb565_surface_advanced(&surface_storage, 1, 64, LINE_HEIGHT, surface_buffer);
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    }
+
+    void TearDown() override {
+        if (font) {
+            qp_close_font(font);
+        }
+    }
+
+    void load(const test_font_t &built) {
+        test_font = built;
+        font      = qp_load_font_mem(test_font.data.data());
+        ASSERT_NE(font, nullptr);
+    }
+
+    // Checks the glyph at x against what it should look like, or what its (possibly modified) font data says
+    void expect_glyph_at(uint16_t x, uint32_t code_point, uint8_t width, const uint8_t *pixels) {
+        for (uint16_t y = 0; y < LINE_HEIGHT; ++y) {
+            for (uint16_t gx = 0; gx < width; ++gx) {
+                uint16_t n        = y * width + gx;
+                bool     expected = (pixels[n / 8] >> (n % 8)) & 1;
+                ASSERT_EQ(surface_storage.u16buffer[y * 64 + x + gx] != 0, expected) << "code point " << code_point << " x=" << gx << " y=" << y;
+            }
+        }
+    }
+
+    void expect_glyph_at(uint16_t x, uint32_t code_point, uint8_t width) {
+        std::vector<uint8_t> pixels = glyph_pixels(code_point, width);
+        expect_glyph_at(x, code_point, width, pixels.data());
+    }
+
+    painter_device_t      surface;
+    painter_font_handle_t font = nullptr;
+    test_font_t           test_font;
+};
+
+TEST_F(PainterQffGlyphLookup, SortedTableFindsEveryGlyph) {
+    std::vector<uint32_t> code_points;
+    for (uint32_t i = 0; i < 400; ++i) {
+        code_points.push_back(0x4E00 + i * 3);
+    }
+    load(build_font(code_points, 4, IMAGE_UNCOMPRESSED));
+
+    for (uint32_t code_point : code_points) {
+        ASSERT_EQ(qp_textwidth(font, utf8(code_point).c_str()), 4) << code_point;
+    }
+
+    std::string text = utf8(code_points.front()) + utf8(code_points[200]) + utf8(code_points.back());
+    EXPECT_EQ(qp_drawtext(surface, 0, 0, font, text.c_str()), 12);
+    expect_glyph_at(0, code_points.front(), 4);
+    expect_glyph_at(4, code_points[200], 4);
+    expect_glyph_at(8, code_points.back(), 4);
+}
+
+TEST_F(PainterQffGlyphLookup, MissingGlyphIsRejected) {
+    load(build_font({0x41, 0x4E00, 0x4E02}, 4, IMAGE_UNCOMPRESSED));
+    EXPECT_EQ(qp_textwidth(font, utf8(0x4E01).c_str()), 0);
+    EXPECT_EQ(qp_textwidth(font, utf8(0x40).c_str()), 0);
+    EXPECT_EQ(qp_textwidth(font, utf8(0x4E03).c_str()), 0);
+}
+
+TEST_F(PainterQffGlyphLookup, UnsortedTableIsSearchedLinearly) {
+    load(build_font({0x4E10, 0x4E00, 0x263A, 0x4E05}, 4, IMAGE_UNCOMPRESSED));
+    std::string text = utf8(0x263A) + utf8(0x4E05) + utf8(0x4E10);
+    EXPECT_EQ(qp_drawtext(surface, 0, 0, font, text.c_str()), 12);
+    expect_glyph_at(0, 0x263A, 4);
+    expect_glyph_at(4, 0x4E05, 4);
+    expect_glyph_at(8, 0x4E10, 4);
+}
+
+TEST_F(PainterQffGlyphLookup, CachedGlyphIsDrawnFromRam) {
+    load(build_font({0x4E00, 0x4E01}, 4, IMAGE_COMPRESSED_RLE));
+    std::string text = utf8(0x4E00);
+    EXPECT_EQ(qp_drawtext(surface, 0, 0, font, text.c_str()), 4);
+
+    // The font data changing underneath doesn't matter once the glyph is cached
+    memset(&test_font.data[test_font.glyph_data[0x4E00]], 0, 4);
+    EXPECT_EQ(qp_drawtext(surface, 8, 0, font, text.c_str()), 4);
+    expect_glyph_at(8, 0x4E00, 4);
+}
+
+TEST_F(PainterQffGlyphLookup, CacheReplacesOldestGlyph) {
+    load(build_font({0x4E00, 0x4E01, 0x4E02}, 4, IMAGE_UNCOMPRESSED));
+    std::string text = utf8(0x4E00) + utf8(0x4E01) + utf8(0x4E02);
+    EXPECT_EQ(qp_drawtext(surface, 0, 0, font, text.c_str()), 12);
+
+    // Only two entries, so the first glyph was pushed out by the third
+    uint8_t blank[4] = {0};
+    memset(&test_font.data[test_font.glyph_data[0x4E00]], 0, 4);
+    memset(&test_font.data[test_font.glyph_data[0x4E02]], 0, 4);
+    EXPECT_EQ(qp_drawtext(surface, 16, 0, font, utf8(0x4E02).c_str()), 4);
+    EXPECT_EQ(qp_drawtext(surface, 20, 0, font, utf8(0x4E00).c_str()), 4);
+    expect_glyph_at(16, 0x4E02, 4);
+    expect_glyph_at(20, 0x4E00, 4, blank);
+}
+
+TEST_F(PainterQffGlyphLookup, LargeGlyphsAreNotCached) {
+    load(build_font({0x4E00}, 8, IMAGE_UNCOMPRESSED));
+    std::string text = utf8(0x4E00);
+    EXPECT_EQ(qp_drawtext(surface, 0, 0, font, text.c_str()), 8);
+    expect_glyph_at(0, 0x4E00, 8);
+
+    uint8_t blank[8] = {0};
+    memset(&test_font.data[test_font.glyph_data[0x4E00]], 0, 8);
+    EXPECT_EQ(qp_drawtext(surface, 8, 0, font, text.c_str()), 8);
+    expect_glyph_at(8, 0x4E00, 8, blank);
+}
+
+TEST_F(PainterQffGlyphLookup, ReloadingFontClearsCache) {
+    load(build_font({0x4E00}, 4, IMAGE_UNCOMPRESSED));
+    std::string text = utf8(0x4E00);
+    EXPECT_EQ(qp_drawtext(surface, 0, 0, font, text.c_str()), 4);
+    qp_close_font(font);
+    font = nullptr;
+
+    uint8_t blank[4] = {0};
+    memset(&test_font.data[test_font.glyph_data[0x4E00]], 0, 4);
+    font = qp_load_font_mem(test_font.data.data());
+    ASSERT_NE(font, nullptr);
+    EXPECT_EQ(qp_drawtext(surface, 8, 0, font, text.c_str()), 4);
+    expect_glyph_at(8, 0x4E00, 4, blank);
+}
@@ -0,0 +1,92 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "mock_qp_display.h"
+#include <string.h>
+#include "qp_comms_dummy.h"
+
+mock_qp_display_t mock_qp_display;
+
+static bool mock_init(painter_device_t device, painter_rotation_t rotation) {
+    memset(mock_qp_display.pixels, 0, sizeof(mock_qp_display.pixels));
+    return true;
+}
+
+static bool mock_noop(painter_device_t device) {
+    return true;
+}
+
+static bool mock_power(painter_device_t device, bool power_on) {
+    return true;
+}
+
+static bool mock_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    mock_qp_display.viewport_l = left;
+    mock_qp_display.viewport_t = top;
+    mock_qp_display.viewport_r = right;
+    mock_qp_display.viewport_b = bottom;
+    mock_qp_display.pixdata_x  = left;
+    mock_qp_display.pixdata_y  = top;
+    mock_qp_display.viewports++;
+    return true;
+}
+
+static bool mock_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    const uint8_t *data = (const uint8_t *)pixel_data;
+    for (uint32_t i = 0; i < native_pixel_count; ++i) {
+        uint16_t value;
+        if (mock_qp_display.base.native_bits_per_pixel == 16) {
+            value = ((const uint16_t *)pixel_data)[i];
+        } else {
+            value = (data[i / 8] >> (i % 8)) & 1;
+        }
+        mock_qp_display.pixels[mock_qp_display.pixdata_y * mock_qp_display.base.panel_width + mock_qp_display.pixdata_x] = value;
+
+        if (++mock_qp_display.pixdata_x > mock_qp_display.viewport_r) {
+            mock_qp_display.pixdata_x = mock_qp_display.viewport_l;
+            mock_qp_display.pixdata_y++;
+        }
+    }
+    mock_qp_display.pixdata_bytes += (native_pixel_count * mock_qp_display.base.native_bits_per_pixel + 7) / 8;
+    return true;
+}
+
+// Only drawn to through qp_surface_draw(), so nothing is ever converted
+static bool mock_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    return false;
+}
+
+static bool mock_append_pixels(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
+    return false;
+}
+
+static bool mock_append_pixdata(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
+    return false;
+}
+
+static const painter_driver_vtable_t mock_qp_display_vtable = {
+    .init            = mock_init,
+    .power           = mock_power,
+    .clear           = mock_noop,
+    .flush           = mock_noop,
+    .viewport        = mock_viewport,
+    .pixdata         = mock_pixdata,
+    .palette_convert = mock_palette_convert,
+    .append_pixels   = mock_append_pixels,
+    .append_pixdata  = mock_append_pixdata,
+};
+
+painter_device_t mock_qp_display_make(uint16_t panel_width, uint16_t panel_height, uint8_t bits_per_pixel) {
+    memset(&mock_qp_display, 0, sizeof(mock_qp_display));
+    mock_qp_display.base.driver_vtable         = &mock_qp_display_vtable;
+    mock_qp_display.base.comms_vtable          = &dummy_comms_vtable;
+    mock_qp_display.base.native_bits_per_pixel = bits_per_pixel;
+    mock_qp_display.base.panel_width           = panel_width;
+    mock_qp_display.base.panel_height          = panel_height;
+    return (painter_device_t)&mock_qp_display;
+}
+
+void mock_qp_display_reset_counters(void) {
+    mock_qp_display.viewports     = 0;
+    mock_qp_display.pixdata_bytes = 0;
+}
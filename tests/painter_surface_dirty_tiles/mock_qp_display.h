@@ -0,0 +1,30 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "qp_internal.h"
+
+#define MOCK_QP_DISPLAY_MAX_PIXELS (512 * 512)
+
+// A display that records what it is sent, as if over SPI
+typedef struct {
+    painter_driver_t base; // must be first, so it can be cast to/from the painter_device_t* type
+
+    uint16_t viewport_l;
+    uint16_t viewport_t;
+    uint16_t viewport_r;
+    uint16_t viewport_b;
+    uint16_t pixdata_x;
+    uint16_t pixdata_y;
+
+    uint32_t viewports;
+    uint32_t pixdata_bytes;
+    uint16_t pixels[MOCK_QP_DISPLAY_MAX_PIXELS];
+} mock_qp_display_t;
+
+extern mock_qp_display_t mock_qp_display;
+
+painter_device_t mock_qp_display_make(uint16_t panel_width, uint16_t panel_height, uint8_t bits_per_pixel);
+void             mock_qp_display_reset_counters(void);
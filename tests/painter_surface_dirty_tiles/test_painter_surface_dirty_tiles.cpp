@@ -0,0 +1,152 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+#include "qp_surface_internal.h"
+#include "mock_qp_display.h"
+}
+
+static surface_painter_device_t surface_storage;
+static uint8_t                  surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(512, 512, 16)];
+
+class PainterSurfaceDirtyTiles : public ::testing::Test {
+   protected:
+    void make(uint16_t width, uint16_t height, uint8_t bpp) {
+        memset(&surface_storage, 0, sizeof(surface_storage));
+        if (bpp == 16) {
+            surface = qp_make_rgb565_surface_advanced(&surface_storage, 1, width, height, surface_buffer);
+        } else {
+            surface = qp_make_mono1bpp_surface_advanced(&surface_storage, 1, width, height, surface_buffer);
+        }
+        display = mock_qp_display_make(width, height, bpp);
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(display, QP_ROTATION_0));
+
+        // Get the initial full-surface transfer out of the way
+        ASSERT_TRUE(qp_surface_draw(surface, display, 0, 0, false));
+        mock_qp_display_reset_counters();
+    }
+
+    uint16_t surface_pixel(uint16_t x, uint16_t y) {
+        uint32_t pixel_num = y * surface_storage.base.panel_width + x;
+        if (surface_storage.base.native_bits_per_pixel == 16) {
+            return surface_storage.u16buffer[pixel_num];
+        }
+        return (surface_storage.u8buffer[pixel_num / 8] >> (pixel_num % 8)) & 1;
+    }
+
+    void expect_display_matches_surface(void) {
+        for (uint16_t y = 0; y < surface_storage.base.panel_height; ++y) {
+            for (uint16_t x = 0; x < surface_storage.base.panel_width; ++x) {
+                ASSERT_EQ(mock_qp_display.pixels[y * surface_storage.base.panel_width + x], surface_pixel(x, y)) << "x=" << x << " y=" << y;
+            }
+        }
+    }
+
+    painter_device_t surface;
+    painter_device_t display;
+};
+
+TEST_F(PainterSurfaceDirtyTiles, InitialDrawSendsEverything) {
+    memset(&surface_storage, 0, sizeof(surface_storage));
+    surface = qp_make_rgb565_surface_advanced(&surface_storage, 1, 240, 240, surface_buffer);
+    display = mock_qp_display_make(240, 240, 16);
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    ASSERT_TRUE(qp_init(display, QP_ROTATION_0));
+
+    EXPECT_TRUE(qp_surface_draw(surface, display, 0, 0, false));
+    EXPECT_EQ(mock_qp_display.viewports, 1);
+    EXPECT_EQ(mock_qp_display.pixdata_bytes, 240 * 240 * 2);
+}
+
+TEST_F(PainterSurfaceDirtyTiles, UnchangedSurfaceSendsNothing) {
+    make(240, 240, 16);
+    qp_setpixel(surface, 10, 10, 0, 0, 0);
+    EXPECT_TRUE(qp_surface_draw(surface, display, 0, 0, false));
+    EXPECT_EQ(mock_qp_display.viewports, 0);
+    EXPECT_EQ(mock_qp_display.pixdata_bytes, 0);
+}
+
+TEST_F(PainterSurfaceDirtyTiles, OppositeCornersAreSentSeparately) {
+    make(240, 240, 16);
+    qp_rect(surface, 2, 2, 9, 9, 0, 255, 255, true);
+    qp_rect(surface, 230, 230, 237, 237, 85, 255, 255, true);
+
+    EXPECT_TRUE(qp_surface_draw(surface, display, 0, 0, false));
+    EXPECT_EQ(mock_qp_display.viewports, 2);
+    // One tile each, clipped to the dirty bounding box, instead of the 236x236 box between them
+    EXPECT_EQ(mock_qp_display.pixdata_bytes, 2 * (14 * 14) * 2);
+    expect_display_matches_surface();
+}
+
+TEST_F(PainterSurfaceDirtyTiles, AdjacentTilesAreMerged) {
+    make(240, 240, 16);
+    // Spans a 3x2 block of tiles
+    qp_rect(surface, 8, 8, 40, 20, 170, 255, 255, true);
+
+    EXPECT_TRUE(qp_surface_draw(surface, display, 0, 0, false));
+    EXPECT_EQ(mock_qp_display.viewports, 1);
+    EXPECT_EQ(mock_qp_display.pixdata_bytes, 33 * 13 * 2);
+    expect_display_matches_surface();
+}
+
+TEST_F(PainterSurfaceDirtyTiles, IrregularShapeIsSplitIntoRectangles) {
+    make(240, 240, 16);
+    // An L of three tiles: two across the top, one below the left
+    qp_rect(surface, 0, 0, 31, 0, 0, 255, 255, true);
+    qp_rect(surface, 0, 16, 0, 31, 0, 255, 255, true);
+
+    EXPECT_TRUE(qp_surface_draw(surface, display, 0, 0, false));
+    EXPECT_EQ(mock_qp_display.viewports, 2);
+    expect_display_matches_surface();
+}
+
+TEST_F(PainterSurfaceDirtyTiles, EntireSurfaceIgnoresTiles) {
+    make(240, 240, 16);
+    qp_setpixel(surface, 100, 100, 0, 255, 255);
+
+    EXPECT_TRUE(qp_surface_draw(surface, display, 0, 0, true));
+    EXPECT_EQ(mock_qp_display.viewports, 1);
+    EXPECT_EQ(mock_qp_display.pixdata_bytes, 240 * 240 * 2);
+}
+
+TEST_F(PainterSurfaceDirtyTiles, DrawClearsTiles) {
+    make(240, 240, 16);
+    qp_setpixel(surface, 3, 3, 0, 255, 255);
+    EXPECT_TRUE(qp_surface_draw(surface, display, 0, 0, false));
+
+    mock_qp_display_reset_counters();
+    qp_setpixel(surface, 200, 200, 0, 255, 255);
+    EXPECT_TRUE(qp_surface_draw(surface, display, 0, 0, false));
+    EXPECT_EQ(mock_qp_display.viewports, 1);
+    EXPECT_EQ(mock_qp_display.pixdata_bytes, 2);
+    expect_display_matches_surface();
+}
+
+TEST_F(PainterSurfaceDirtyTiles, Mono1bppSendsChangedTiles) {
+    make(128, 64, 1);
+    qp_rect(surface, 1, 1, 10, 5, 0, 0, 255, true);
+    qp_rect(surface, 120, 60, 126, 62, 0, 0, 255, true);
+
+    EXPECT_TRUE(qp_surface_draw(surface, display, 0, 0, false));
+    EXPECT_EQ(mock_qp_display.viewports, 2);
+    expect_display_matches_surface();
+}
+
+TEST_F(PainterSurfaceDirtyTiles, LargePanelsUseLargerTiles) {
+    // 32x32 tiles of 16 pixels don't fit, so they double to 32 pixels
+    make(512, 512, 1);
+    EXPECT_EQ(surface_storage.dirty_tiles.shift, 5);
+    EXPECT_EQ(surface_storage.dirty_tiles.columns, 16);
+
+    // Two tiles apart at 16 pixels, but neighbours at 32
+    qp_setpixel(surface, 0, 0, 0, 0, 255);
+    qp_setpixel(surface, 40, 0, 0, 0, 255);
+    EXPECT_TRUE(qp_surface_draw(surface, display, 0, 0, false));
+    EXPECT_EQ(mock_qp_display.viewports, 1);
+    expect_display_matches_surface();
+}
@@ -0,0 +1,12 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define RGB_MATRIX_LED_COUNT 4
+#define RGB_MATRIX_DIRTY_TRACKING
+#define RGB_MATRIX_KEYPRESSES
+#define ENABLE_RGB_MATRIX_CYCLE_ALL
+#define ENABLE_RGB_MATRIX_SOLID_REACTIVE_SIMPLE
@@ -0,0 +1,61 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "mock_rgb_matrix_driver.h"
+#include <string.h>
+#include "rgb_matrix.h"
+
+#define __ NO_LED
+
+// clang-format off
+led_config_t g_led_config = {
+    {
+        {  0,  1,  2,  3, __, __, __, __, __, __ },
+        { __, __, __, __, __, __, __, __, __, __ },
+        { __, __, __, __, __, __, __, __, __, __ },
+        { __, __, __, __, __, __, __, __, __, __ },
+    },
+    { {0, 0}, {74, 0}, {150, 0}, {224, 0} },
+    { 4, 4, 4, 1 },
+};
+// clang-format on
+
+mock_rgb_matrix_driver_t mock_rgb_matrix;
+
+void mock_rgb_matrix_reset_counters(void) {
+    mock_rgb_matrix.set_color_calls = 0;
+    mock_rgb_matrix.flushes         = 0;
+    mock_rgb_matrix.dirty_at_flush  = 0;
+}
+
+static void mock_init(void) {
+    memset(&mock_rgb_matrix, 0, sizeof(mock_rgb_matrix));
+}
+
+static void mock_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    mock_rgb_matrix.set_color_calls++;
+    mock_rgb_matrix.leds[index] = (rgb_t){red, green, blue};
+}
+
+static void mock_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        mock_set_color(i, red, green, blue);
+    }
+}
+
+static void mock_flush(void) {
+    mock_rgb_matrix.flushes++;
+    mock_rgb_matrix.dirty_at_flush = 0;
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        if (rgb_matrix_is_led_dirty(i)) {
+            mock_rgb_matrix.dirty_at_flush++;
+        }
+    }
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = mock_init,
+    .flush         = mock_flush,
+    .set_color     = mock_set_color,
+    .set_color_all = mock_set_color_all,
+};
@@ -0,0 +1,19 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "color.h"
+
+typedef struct {
+    uint32_t set_color_calls;
+    uint32_t flushes;
+    // LEDs that were marked dirty at the time of the last flush
+    uint8_t dirty_at_flush;
+    rgb_t   leds[RGB_MATRIX_LED_COUNT];
+} mock_rgb_matrix_driver_t;
+
+extern mock_rgb_matrix_driver_t mock_rgb_matrix;
+
+void mock_rgb_matrix_reset_counters(void);
@@ -0,0 +1,159 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "mock_rgb_matrix_driver.h"
+
+static bool indicator_on = false;
+
+bool rgb_matrix_indicators_user(void) {
+    if (indicator_on) {
+        rgb_matrix_set_color(3, 255, 0, 0);
+    }
+    return true;
+}
+}
+
+using testing::_;
+
+class RgbMatrixDirtyTracking : public TestFixture {
+   protected:
+    void SetUp() override {
+        indicator_on = false;
+    }
+
+    /* Switches effect and lets a few complete frames go out */
+    void start_effect(uint8_t mode) {
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(0, 255, 100);
+        rgb_matrix_set_speed_noeeprom(255);
+        rgb_matrix_mode_noeeprom(mode);
+        idle_for(300);
+        mock_rgb_matrix_reset_counters();
+    }
+
+    rgb_t base_color() {
+        return hsv_to_rgb(rgb_matrix_get_hsv());
+    }
+};
+
+TEST_F(RgbMatrixDirtyTracking, StaticEffectIsNotRedrawn) {
+    TestDriver driver;
+
+    start_effect(RGB_MATRIX_SOLID_COLOR);
+    EXPECT_EQ(mock_rgb_matrix.leds[0].r, base_color().r);
+
+    idle_for(500);
+    EXPECT_EQ(mock_rgb_matrix.set_color_calls, 0);
+    EXPECT_EQ(mock_rgb_matrix.flushes, 0);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RgbMatrixDirtyTracking, ConfigChangeRedrawsStaticEffect) {
+    TestDriver driver;
+
+    start_effect(RGB_MATRIX_SOLID_COLOR);
+
+    rgb_matrix_sethsv_noeeprom(0, 255, 50);
+    idle_for(500);
+    EXPECT_EQ(mock_rgb_matrix.set_color_calls, RGB_MATRIX_LED_COUNT);
+    EXPECT_EQ(mock_rgb_matrix.flushes, 1);
+    EXPECT_EQ(mock_rgb_matrix.dirty_at_flush, RGB_MATRIX_LED_COUNT);
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        EXPECT_EQ(mock_rgb_matrix.leds[i].r, base_color().r);
+    }
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RgbMatrixDirtyTracking, AnimatedEffectKeepsFlushing) {
+    TestDriver driver;
+
+    start_effect(RGB_MATRIX_CYCLE_ALL);
+
+    idle_for(500);
+    EXPECT_GT(mock_rgb_matrix.flushes, 10);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RgbMatrixDirtyTracking, ReactiveEffectOnlyFlushesWhileFading) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    start_effect(RGB_MATRIX_SOLID_REACTIVE_SIMPLE);
+    EXPECT_EQ(mock_rgb_matrix.leds[0].r, 0);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    idle_for(50);
+    EXPECT_GT(mock_rgb_matrix.flushes, 0);
+    /* Only the LED under the key changes */
+    EXPECT_EQ(mock_rgb_matrix.dirty_at_flush, 1);
+    EXPECT_GT(mock_rgb_matrix.leds[0].r, 0);
+    EXPECT_EQ(mock_rgb_matrix.leds[1].r, 0);
+
+    /* The fade takes 65535 / (speed + 1) ms */
+    idle_for(500);
+    EXPECT_EQ(mock_rgb_matrix.leds[0].r, 0);
+
+    mock_rgb_matrix_reset_counters();
+    idle_for(500);
+    EXPECT_EQ(mock_rgb_matrix.set_color_calls, 0);
+    EXPECT_EQ(mock_rgb_matrix.flushes, 0);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RgbMatrixDirtyTracking, IndicatorIsClearedFromStaticEffect) {
+    TestDriver driver;
+
+    indicator_on = true;
+    start_effect(RGB_MATRIX_SOLID_COLOR);
+    EXPECT_EQ(mock_rgb_matrix.leds[3].r, 255);
+    EXPECT_EQ(mock_rgb_matrix.leds[3].g, 0);
+
+    /* Indicators keep the effect rendering, but identical frames are not flushed */
+    idle_for(500);
+    EXPECT_EQ(mock_rgb_matrix.flushes, 0);
+
+    indicator_on = false;
+    idle_for(100);
+    EXPECT_EQ(mock_rgb_matrix.flushes, 1);
+    EXPECT_EQ(mock_rgb_matrix.dirty_at_flush, 1);
+    EXPECT_EQ(mock_rgb_matrix.leds[3].r, base_color().r);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RgbMatrixDirtyTracking, InvalidateRestoresDirectDriverWrites) {
+    TestDriver driver;
+
+    start_effect(RGB_MATRIX_SOLID_COLOR);
+
+    /* Bypass rgb_matrix_set_color(), as a keyboard writing to its LED driver would */
+    rgb_matrix_driver.set_color_all(0, 0, 255);
+    rgb_matrix_invalidate_frame();
+    idle_for(100);
+    EXPECT_EQ(mock_rgb_matrix.flushes, 1);
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        EXPECT_EQ(mock_rgb_matrix.leds[i].r, base_color().r);
+        EXPECT_EQ(mock_rgb_matrix.leds[i].b, base_color().b);
+    }
+
+    /* Then it settles down again */
+    mock_rgb_matrix_reset_counters();
+    idle_for(500);
+    EXPECT_EQ(mock_rgb_matrix.set_color_calls, 0);
+    EXPECT_EQ(mock_rgb_matrix.flushes, 0);
+
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,50 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "rgb_matrix.h"
+
+#define __ NO_LED
+
+// clang-format off
+led_config_t g_led_config = {
+    {
+        {  0,  1,  2,  3, __, __, __, __, __, __ },
+        { __, __, __, __, __, __, __, __, __, __ },
+        { __, __, __, __, __, __, __, __, __, __ },
+        { __, __, __, __, __, __, __, __, __, __ },
+    },
+    { {0, 0}, {74, 10}, {150, 64}, {224, 64} },
+    { 4, 4, 4, 4 },
+};
+
+// As emitted by `qmk generate-keyboard-c` for the layout above
+const led_geometry_t g_rgb_matrix_led_geometry[RGB_MATRIX_LED_COUNT] PROGMEM = {
+  {-112, -32, 116, 143}, {-38, -22, 43, 152}, {38, 32, 49, 30}, {112, 32, 116, 15},
+};
+// clang-format on
+
+rgb_t mock_leds[RGB_MATRIX_LED_COUNT];
+
+static void mock_init(void) {
+    memset(mock_leds, 0, sizeof(mock_leds));
+}
+
+static void mock_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    mock_leds[index] = (rgb_t){red, green, blue};
+}
+
+static void mock_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        mock_set_color(i, red, green, blue);
+    }
+}
+
+static void mock_flush(void) {}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = mock_init,
+    .flush         = mock_flush,
+    .set_color     = mock_set_color,
+    .set_color_all = mock_set_color_all,
+};
@@ -0,0 +1,77 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "lib/lib8tion/lib8tion.h"
+
+extern rgb_t mock_leds[RGB_MATRIX_LED_COUNT];
+}
+
+using testing::_;
+
+class RgbMatrixLedGeometry : public TestFixture {
+   protected:
+    void SetUp() override {
+        g_led_config.point[2] = {150, 64};
+        rgb_matrix_init();
+    }
+
+    /* Renders a few frames with the animation stopped, so time is always 0 */
+    void render(uint8_t mode) {
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+        rgb_matrix_set_speed_noeeprom(0);
+        rgb_matrix_mode_noeeprom(mode);
+        idle_for(100);
+    }
+
+    void expect_hue(uint8_t index, uint8_t hue) {
+        rgb_t expected = hsv_to_rgb({hue, 255, 255});
+        EXPECT_EQ(mock_leds[index].r, expected.r) << "LED " << (int)index;
+        EXPECT_EQ(mock_leds[index].g, expected.g) << "LED " << (int)index;
+        EXPECT_EQ(mock_leds[index].b, expected.b) << "LED " << (int)index;
+    }
+
+    void expect_pinwheel_and_spiral() {
+        render(RGB_MATRIX_CYCLE_PINWHEEL);
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            int16_t dx = g_led_config.point[i].x - 112;
+            int16_t dy = g_led_config.point[i].y - 32;
+            expect_hue(i, atan2_8(dy, dx));
+        }
+
+        render(RGB_MATRIX_CYCLE_SPIRAL);
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            int16_t dx = g_led_config.point[i].x - 112;
+            int16_t dy = g_led_config.point[i].y - 32;
+            expect_hue(i, sqrt16(dx * dx + dy * dy) - atan2_8(dy, dx));
+        }
+    }
+};
+
+TEST_F(RgbMatrixLedGeometry, GeneratedTableIsUsed) {
+    TestDriver driver;
+
+    EXPECT_TRUE(g_rgb_matrix_led_geometry_valid);
+    expect_pinwheel_and_spiral();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RgbMatrixLedGeometry, MismatchedTableFallsBackToRuntime) {
+    TestDriver driver;
+
+    /* As if g_led_config had been overridden in code */
+    g_led_config.point[2] = {100, 10};
+    rgb_matrix_init();
+
+    EXPECT_FALSE(g_rgb_matrix_led_geometry_valid);
+    expect_pinwheel_and_spiral();
+
+    VERIFY_AND_CLEAR(driver);
+}
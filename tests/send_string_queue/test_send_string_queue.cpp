@@ -0,0 +1,215 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "send_string.h"
+#include "timer.h"
+
+static int records = 0;
+
+bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    ++records;
+    return true;
+}
+}
+
+using testing::_;
+using testing::InSequence;
+using testing::Invoke;
+
+class SendStringQueue : public TestFixture {
+   protected:
+    void SetUp() override {
+        records = 0;
+        report_times.clear();
+    }
+
+    void TearDown() override {
+        send_string_queue_clear();
+    }
+
+    // Records the time of every keyboard report, on top of whatever is expected
+    void record_report_times(TestDriver &driver) {
+        ON_CALL(driver, send_keyboard_mock(_)).WillByDefault(Invoke([this](report_keyboard_t &) { report_times.push_back(timer_read32()); }));
+    }
+
+    std::vector<uint32_t> report_times;
+};
+
+TEST_F(SendStringQueue, TypesOneReportPerScan) {
+    TestDriver driver;
+    InSequence s;
+    record_report_times(driver);
+
+    EXPECT_NO_REPORT(driver);
+    EXPECT_TRUE(send_string_queued("aB"));
+    EXPECT_TRUE(send_string_queue_is_busy());
+    VERIFY_AND_CLEAR(driver);
+
+    record_report_times(driver);
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_B));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_FALSE(send_string_queue_is_busy());
+    ASSERT_EQ(report_times.size(), 6);
+    for (size_t i = 1; i < report_times.size(); ++i) {
+        EXPECT_EQ(report_times[i] - report_times[i - 1], 1);
+    }
+}
+
+TEST_F(SendStringQueue, IntervalSpacesOutReports) {
+    TestDriver driver;
+    InSequence s;
+    record_report_times(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_TRUE(send_string_queued_with_delay("ab", 10));
+    idle_for(40);
+    VERIFY_AND_CLEAR(driver);
+
+    ASSERT_EQ(report_times.size(), 4);
+    for (size_t i = 1; i < report_times.size(); ++i) {
+        EXPECT_EQ(report_times[i] - report_times[i - 1], 10);
+    }
+}
+
+TEST_F(SendStringQueue, MatrixKeepsScanningDuringMacro) {
+    TestDriver driver;
+    KeymapKey  key_no(0, 0, 0, KC_NO);
+    set_keymap({key_no});
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(8);
+    EXPECT_TRUE(send_string_queued("abcd"));
+    run_one_scan_loop();
+    run_one_scan_loop();
+
+    // The key is processed while the macro is still being typed
+    key_no.press();
+    run_one_scan_loop();
+    EXPECT_EQ(records, 1);
+    EXPECT_TRUE(send_string_queue_is_busy());
+    key_no.release();
+    run_one_scan_loop();
+    EXPECT_EQ(records, 2);
+
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringQueue, WaitsForHostToTakeReports) {
+    TestDriver driver;
+    InSequence s;
+
+    driver.set_keyboard_ready(false);
+    EXPECT_NO_REPORT(driver);
+    EXPECT_TRUE(send_string_queued("a"));
+    idle_for(5);
+    VERIFY_AND_CLEAR(driver);
+
+    driver.set_keyboard_ready(true);
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringQueue, DelayDoesNotBlock) {
+    TestDriver driver;
+    KeymapKey  key_no(0, 0, 0, KC_NO);
+    set_keymap({key_no});
+    InSequence s;
+    record_report_times(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_TRUE(send_string_queued("a" SS_DELAY(20) "b"));
+    idle_for(5);
+    tap_key(key_no);
+    idle_for(30);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(records, 2);
+    ASSERT_EQ(report_times.size(), 4);
+    EXPECT_EQ(report_times[2] - report_times[1], 21);
+}
+
+TEST_F(SendStringQueue, TapCodesAreQueued) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL, KC_C));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_TRUE(send_string_queued(SS_LCTL("c")));
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringQueue, BlockingSendStringGoesAfterQueue) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_TRUE(send_string_queued("a"));
+    send_string("b");
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_FALSE(send_string_queue_is_busy());
+}
+
+TEST_F(SendStringQueue, FullQueueRejectsWholeString) {
+    TestDriver driver;
+
+    // The interval and terminating NUL take up two bytes of the 32
+    EXPECT_NO_REPORT(driver);
+    EXPECT_FALSE(send_string_queued("abcdefghijklmnopqrstuvwxyzabcde"));
+    EXPECT_FALSE(send_string_queue_is_busy());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(60);
+    EXPECT_TRUE(send_string_queued("abcdefghijklmnopqrstuvwxyzabcd"));
+    EXPECT_FALSE(send_string_queued("a"));
+    idle_for(70);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringQueue, ClearReleasesHeldKeys) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_A));
+    EXPECT_TRUE(send_string_queued("AB"));
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_queue_clear();
+    EXPECT_FALSE(send_string_queue_is_busy());
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+}
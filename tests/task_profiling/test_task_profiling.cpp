@@ -0,0 +1,144 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "task_profiling.h"
+#include "raw_hid.h"
+
+void advance_time_us(uint32_t us);
+
+/* Each processed key takes a fixed amount of time inside the matrix stage */
+bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    advance_time_us(1000);
+    return true;
+}
+
+void housekeeping_task_user(void) {
+    advance_time_us(40);
+}
+
+static uint8_t raw_hid_received = 0;
+static uint8_t raw_hid_sent[32];
+
+void raw_hid_receive(uint8_t *data, uint8_t length) {
+    raw_hid_received++;
+}
+
+static void send_raw_hid(uint8_t *data, uint8_t length) {
+    memcpy(raw_hid_sent, data, sizeof(raw_hid_sent));
+}
+}
+
+using testing::_;
+
+class TaskProfiling : public TestFixture {
+   protected:
+    void SetUp() override {
+        task_profiling_reset();
+    }
+};
+
+TEST_F(TaskProfiling, IdleScansCostNothing) {
+    TestDriver driver;
+
+    idle_for(100);
+
+    task_profiling_stats_t stats;
+    ASSERT_TRUE(task_profiling_get_stats(TASK_PROFILING_MATRIX, &stats));
+    EXPECT_EQ(stats.count, 100);
+    EXPECT_EQ(stats.max, 0);
+
+    ASSERT_TRUE(task_profiling_get_stats(TASK_PROFILING_QUANTUM, &stats));
+    EXPECT_EQ(stats.count, 100);
+
+    /* Stages that are not compiled in never record anything */
+    ASSERT_TRUE(task_profiling_get_stats(TASK_PROFILING_RGB_MATRIX, &stats));
+    EXPECT_EQ(stats.count, 0);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TaskProfiling, KeyEventsStayWithinBudget) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    idle_for(98);
+    VERIFY_AND_CLEAR(driver);
+
+    task_profiling_stats_t stats;
+    ASSERT_TRUE(task_profiling_get_stats(TASK_PROFILING_MATRIX, &stats));
+    EXPECT_EQ(stats.count, 100);
+    EXPECT_EQ(stats.min, 0);
+    /* Press and release each cost one process_record_user() call */
+    EXPECT_EQ(stats.max, 1000);
+    EXPECT_EQ(stats.avg, 20);
+    /* 2 of 100 samples are slow, so the 99th percentile lands in the slow bucket */
+    EXPECT_GT(stats.p99, 0);
+    EXPECT_LE(stats.p99, 1000);
+}
+
+TEST_F(TaskProfiling, HousekeepingIsRecorded) {
+    for (int i = 0; i < 10; i++) {
+        housekeeping_task();
+    }
+
+    task_profiling_stats_t stats;
+    ASSERT_TRUE(task_profiling_get_stats(TASK_PROFILING_HOUSEKEEPING, &stats));
+    EXPECT_EQ(stats.count, 10);
+    EXPECT_EQ(stats.min, 40);
+    EXPECT_EQ(stats.max, 40);
+    EXPECT_EQ(stats.avg, 40);
+    EXPECT_EQ(stats.p99, 40);
+}
+
+TEST_F(TaskProfiling, RawHidReportsStats) {
+    task_profiling_record(TASK_PROFILING_OLED, 10);
+    task_profiling_record(TASK_PROFILING_OLED, 30);
+
+    uint8_t data[32] = {TASK_PROFILING_RAW_HID_ID, TASK_PROFILING_RAW_HID_GET_STATS, TASK_PROFILING_OLED};
+    ASSERT_TRUE(task_profiling_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[3], 0);
+    EXPECT_EQ(data[4], 2);   // count
+    EXPECT_EQ(data[8], 10);  // min
+    EXPECT_EQ(data[12], 20); // avg
+    EXPECT_EQ(data[16], 30); // max
+
+    uint8_t other[32] = {0x01};
+    EXPECT_FALSE(task_profiling_raw_hid_receive(other, sizeof(other)));
+
+    uint8_t reset[32] = {TASK_PROFILING_RAW_HID_ID, TASK_PROFILING_RAW_HID_RESET};
+    ASSERT_TRUE(task_profiling_raw_hid_receive(reset, sizeof(reset)));
+
+    task_profiling_stats_t stats;
+    task_profiling_get_stats(TASK_PROFILING_OLED, &stats);
+    EXPECT_EQ(stats.count, 0);
+}
+
+TEST_F(TaskProfiling, RawHidRequestsAreAnsweredBeforeUserCode) {
+    host_driver_t driver = {};
+    driver.send_raw_hid  = send_raw_hid;
+    host_set_driver(&driver);
+    raw_hid_received = 0;
+    memset(raw_hid_sent, 0, sizeof(raw_hid_sent));
+    task_profiling_record(TASK_PROFILING_OLED, 10);
+
+    uint8_t data[32] = {TASK_PROFILING_RAW_HID_ID, TASK_PROFILING_RAW_HID_GET_STATS, TASK_PROFILING_OLED};
+    raw_hid_receive_quantum(data, sizeof(data));
+    EXPECT_EQ(raw_hid_received, 0);
+    EXPECT_EQ(raw_hid_sent[0], TASK_PROFILING_RAW_HID_ID);
+    EXPECT_EQ(raw_hid_sent[4], 1); // count
+
+    uint8_t other[32] = {0x01};
+    raw_hid_receive_quantum(other, sizeof(other));
+    EXPECT_EQ(raw_hid_received, 1);
+
+    host_set_driver(nullptr);
+}
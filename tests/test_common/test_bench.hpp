@@ -0,0 +1,124 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include "gtest/gtest.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+#    define BENCH_CYCLE_COUNTER
+#endif
+
+extern "C" {
+#include "host.h"
+#include "keyboard.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+}
+
+/* Each benchmark is measured this many times, and the fastest run is reported */
+#define BENCH_REPEATS 3
+
+/* Iteration counts are kept small so that the benchmarks double as smoke tests
+ * under `make test:all`; `qmk test-bench` scales them up through QMK_BENCH_SCALE. */
+inline uint32_t bench_scale(void) {
+    const char *scale = std::getenv("QMK_BENCH_SCALE");
+    if (scale == nullptr || std::atoi(scale) < 1) {
+        return 1;
+    }
+    return std::atoi(scale);
+}
+
+inline uint64_t bench_cycles(void) {
+#ifdef BENCH_CYCLE_COUNTER
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/* Runs one pass of the main loop, without the test logger bookkeeping of TestFixture::run_one_scan_loop() */
+inline void bench_scan_loop(void) {
+    keyboard_task();
+    housekeeping_task();
+    advance_time(1);
+}
+
+/* Swallows host reports for as long as it's in scope, so neither the mock driver nor the test log are measured */
+class BenchHostDriver {
+   public:
+    BenchHostDriver() : m_previous(host_get_driver()), m_driver{} {
+        m_driver.keyboard_leds  = []() -> uint8_t { return 0; };
+        m_driver.send_keyboard  = [](report_keyboard_t *) {};
+        m_driver.send_nkro      = [](report_nkro_t *) {};
+        m_driver.send_mouse     = [](report_mouse_t *) {};
+        m_driver.send_extra     = [](report_extra_t *) {};
+        m_driver.keyboard_ready = []() { return true; };
+        host_set_driver(&m_driver);
+    }
+
+    ~BenchHostDriver() {
+        host_set_driver(m_previous);
+    }
+
+   private:
+    host_driver_t *m_previous;
+    host_driver_t  m_driver;
+};
+
+/**
+ * \brief Times `body(i)` over a (scaled) number of iterations.
+ *
+ * The result goes to stdout as a "[ BENCH    ]" line, and onto the current
+ * test as the `iterations`, `ns_per_op` and `cycles_per_op` properties, which
+ * googletest includes in its XML and JSON output.
+ */
+template <typename Body>
+void bench_run(uint32_t iterations, Body body) {
+    iterations *= bench_scale();
+
+    double best_ns     = 0;
+    double best_cycles = 0;
+    for (int repeat = 0; repeat < BENCH_REPEATS; ++repeat) {
+        auto     start        = std::chrono::steady_clock::now();
+        uint64_t start_cycles = bench_cycles();
+        for (uint32_t i = 0; i < iterations; ++i) {
+            body(i);
+        }
+        uint64_t cycles  = bench_cycles() - start_cycles;
+        auto     elapsed = std::chrono::steady_clock::now() - start;
+
+        double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / iterations;
+        if (repeat == 0 || ns < best_ns) {
+            best_ns     = ns;
+            best_cycles = (double)cycles / iterations;
+        }
+    }
+
+    const ::testing::TestInfo *info = ::testing::UnitTest::GetInstance()->current_test_info();
+    std::cout << "[ BENCH    ] " << info->test_suite_name() << "." << info->name() << ": " << std::fixed << std::setprecision(1) << best_ns << " ns/op";
+#ifdef BENCH_CYCLE_COUNTER
+    std::cout << ", " << best_cycles << " cycles/op";
+#endif
+    std::cout << std::defaultfloat << " (" << iterations << " iterations)" << std::endl;
+
+    // RecordProperty() only takes strings and integers
+    auto format = [](double value) {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(1) << value;
+        return out.str();
+    };
+    ::testing::Test::RecordProperty("iterations", iterations);
+    ::testing::Test::RecordProperty("ns_per_op", format(best_ns));
+#ifdef BENCH_CYCLE_COUNTER
+    ::testing::Test::RecordProperty("cycles_per_op", format(best_cycles));
+#endif
+}
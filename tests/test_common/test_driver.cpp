@@ -32,11 +32,16 @@ uint8_t hex_digit_to_keycode(uint8_t digit) {
 } // namespace
 
 TestDriver::TestDriver() : m_driver{&TestDriver::keyboard_leds, &TestDriver::send_keyboard, &TestDriver::send_nkro, &TestDriver::send_mouse, &TestDriver::send_extra} {
+    m_driver.keyboard_ready = &TestDriver::keyboard_ready;
     host_set_driver(&m_driver);
     m_this = this;
 }
 
 TestDriver::~TestDriver() {
+    // Don't leave the host pointing at a driver that no longer exists
+    if (host_get_driver() == &m_driver) {
+        host_set_driver(nullptr);
+    }
     m_this = nullptr;
 }
 
@@ -44,6 +49,10 @@ uint8_t TestDriver::keyboard_leds(void) {
     return m_this->m_leds;
 }
 
+bool TestDriver::keyboard_ready(void) {
+    return m_this->m_keyboard_ready;
+}
+
 void TestDriver::send_keyboard(report_keyboard_t* report) {
     test_logger.trace() << *report;
     m_this->send_keyboard_mock(*report);
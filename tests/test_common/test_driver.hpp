@@ -32,6 +32,9 @@ class TestDriver {
     void set_leds(uint8_t leds) {
         m_leds = leds;
     }
+    void set_keyboard_ready(bool ready) {
+        m_keyboard_ready = ready;
+    }
 
     MOCK_METHOD1(send_keyboard_mock, void(report_keyboard_t&));
     MOCK_METHOD1(send_nkro_mock, void(report_nkro_t&));
@@ -40,12 +43,14 @@ class TestDriver {
 
    private:
     static uint8_t     keyboard_leds(void);
+    static bool        keyboard_ready(void);
     static void        send_keyboard(report_keyboard_t* report);
     static void        send_nkro(report_nkro_t* report);
     static void        send_mouse(report_mouse_t* report);
     static void        send_extra(report_extra_t* report);
     host_driver_t      m_driver;
-    uint8_t            m_leds = 0;
+    uint8_t            m_leds           = 0;
+    bool               m_keyboard_ready = true;
     static TestDriver* m_this;
 };
 
@@ -104,6 +104,7 @@ void TestFixture::add_key(KeymapKey key) {
     }
 
     this->keymap.push_back(key);
+    layer_resolution_cache_invalidate_key(key.position);
 }
 
 void TestFixture::tap_key(KeymapKey key, unsigned delay_ms) {
@@ -131,6 +132,7 @@ void TestFixture::tap_combo(const std::vector<KeymapKey>& chord_keys, unsigned d
 
 void TestFixture::set_keymap(std::initializer_list<KeymapKey> keys) {
     this->keymap.clear();
+    layer_resolution_cache_invalidate();
     for (auto& key : keys) {
         add_key(key);
     }
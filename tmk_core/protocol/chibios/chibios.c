@@ -64,6 +64,7 @@ void send_nkro(report_nkro_t *report);
 void send_mouse(report_mouse_t *report);
 void send_extra(report_extra_t *report);
 void send_raw_hid(uint8_t *data, uint8_t length);
+bool keyboard_ready(void);
 
 /* host struct */
 host_driver_t chibios_driver = {
@@ -75,6 +76,7 @@ host_driver_t chibios_driver = {
 #ifdef RAW_ENABLE
     .send_raw_hid = send_raw_hid,
 #endif
+    .keyboard_ready = keyboard_ready,
 };
 
 #ifdef VIRTSER_ENABLE
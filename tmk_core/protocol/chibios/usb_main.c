@@ -443,6 +443,16 @@ void send_keyboard(report_keyboard_t *report) {
     }
 }
 
+bool keyboard_ready(void) {
+#ifdef NKRO_ENABLE
+    // Matches the choice made by send_keyboard_report()
+    if (host_can_send_nkro() && keymap_config.nkro) {
+        return usb_endpoint_in_is_inactive(&usb_endpoints_in[USB_ENDPOINT_IN_SHARED]);
+    }
+#endif
+    return usb_endpoint_in_is_inactive(&usb_endpoints_in[USB_ENDPOINT_IN_KEYBOARD]);
+}
+
 void send_nkro(report_nkro_t *report) {
 #ifdef NKRO_ENABLE
     send_report(USB_ENDPOINT_IN_SHARED, report, sizeof(report_nkro_t));
@@ -517,7 +527,7 @@ void send_raw_hid(uint8_t *data, uint8_t length) {
 void raw_hid_task(void) {
     uint8_t buffer[RAW_EPSIZE];
     while (receive_report(USB_ENDPOINT_OUT_RAW, buffer, sizeof(buffer))) {
-        raw_hid_receive(buffer, sizeof(buffer));
+        raw_hid_receive_quantum(buffer, sizeof(buffer));
     }
 }
 
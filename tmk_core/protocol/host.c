@@ -22,6 +22,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "util.h"
 #include "debug.h"
 #include "usb_device_state.h"
+#include "latency_trace.h"
 
 #ifdef DIGITIZER_ENABLE
 #    include "digitizer.h"
@@ -133,6 +134,13 @@ led_t host_keyboard_led_state(void) {
     return (led_t)host_keyboard_leds();
 }
 
+bool host_keyboard_ready(void) {
+    host_driver_t *driver = host_get_active_driver();
+    if (!driver || !driver->keyboard_ready) return true;
+
+    return (*driver->keyboard_ready)();
+}
+
 /* send report */
 void host_keyboard_send(report_keyboard_t *report) {
     host_driver_t *driver = host_get_active_driver();
@@ -142,6 +150,7 @@ void host_keyboard_send(report_keyboard_t *report) {
     report->report_id = REPORT_ID_KEYBOARD;
 #endif
     (*driver->send_keyboard)(report);
+    LATENCY_TRACE_REPORT_SENT();
 
     if (debug_keyboard) {
         dprintf("keyboard_report: %02X | ", report->mods);
@@ -158,6 +167,7 @@ void host_nkro_send(report_nkro_t *report) {
 
     report->report_id = REPORT_ID_NKRO;
     (*driver->send_nkro)(report);
+    LATENCY_TRACE_REPORT_SENT();
 
     if (debug_keyboard) {
         dprintf("nkro_report: %02X | ", report->mods);
@@ -34,6 +34,7 @@ host_driver_t *host_get_driver(void);
 /* host driver interface */
 bool    host_can_send_nkro(void);
 uint8_t host_keyboard_leds(void);
+bool    host_keyboard_ready(void);
 led_t   host_keyboard_led_state(void);
 void    host_keyboard_send(report_keyboard_t *report);
 void    host_nkro_send(report_nkro_t *report);
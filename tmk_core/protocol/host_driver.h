@@ -18,6 +18,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "report.h"
 #ifdef MIDI_ENABLE
 #    include "midi.h"
@@ -32,6 +33,7 @@ typedef struct {
 #ifdef RAW_ENABLE
     void (*send_raw_hid)(uint8_t *, uint8_t);
 #endif
+    bool (*keyboard_ready)(void); // optional, true once the host has taken the last keyboard report
 } host_driver_t;
 
 void send_joystick(report_joystick_t *report);
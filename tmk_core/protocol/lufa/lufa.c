@@ -64,6 +64,10 @@
 #    include "raw_hid.h"
 #endif
 
+#ifdef NKRO_ENABLE
+#    include "keycode_config.h"
+#endif
+
 #ifdef WAIT_FOR_USB
 // TODO: Remove backwards compatibility with old define
 #    define USB_WAIT_FOR_ENUMERATION
@@ -79,6 +83,7 @@ static void send_extra(report_extra_t *report);
 #ifdef RAW_ENABLE
 static void send_raw_hid(uint8_t *data, uint8_t length);
 #endif
+static bool keyboard_ready(void);
 
 host_driver_t lufa_driver = {
     .keyboard_leds = usb_device_state_get_leds,
@@ -89,6 +94,7 @@ host_driver_t lufa_driver = {
 #ifdef RAW_ENABLE
     .send_raw_hid = send_raw_hid,
 #endif
+    .keyboard_ready = keyboard_ready,
 };
 
 void send_report(uint8_t endpoint, void *report, size_t size) {
@@ -173,7 +179,7 @@ void raw_hid_task(void) {
         Endpoint_ClearOUT();
 
         if (data_read) {
-            raw_hid_receive(data, sizeof(data));
+            raw_hid_receive_quantum(data, sizeof(data));
         }
     }
 }
@@ -523,6 +529,25 @@ static void send_keyboard(report_keyboard_t *report) {
     keyboard_report_sent = *report;
 }
 
+/** \brief Keyboard Ready
+ *
+ * Whether the endpoint keyboard reports currently go out on can take another one without waiting for the host to poll it
+ */
+static bool keyboard_ready(void) {
+    if (USB_DeviceState != DEVICE_STATE_Configured) return true;
+
+    uint8_t ep = Endpoint_GetCurrentEndpoint();
+#ifdef NKRO_ENABLE
+    // Matches the choice made by send_keyboard_report()
+    Endpoint_SelectEndpoint((host_can_send_nkro() && keymap_config.nkro) ? SHARED_IN_EPNUM : KEYBOARD_IN_EPNUM);
+#else
+    Endpoint_SelectEndpoint(KEYBOARD_IN_EPNUM);
+#endif
+    bool ready = Endpoint_IsReadWriteAllowed();
+    Endpoint_SelectEndpoint(ep);
+    return ready;
+}
+
 /** \brief Send NKRO
  *
  * FIXME: Needs doc
@@ -37,6 +37,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "raw_hid.h"
 #endif
 
+#ifdef NKRO_ENABLE
+#    include "keycode_config.h"
+#endif
+
 #ifdef JOYSTICK_ENABLE
 #    include "joystick.h"
 #endif
@@ -161,7 +165,7 @@ void raw_hid_task(void) {
     }
 
     if (raw_output_received_bytes == RAW_BUFFER_SIZE) {
-        raw_hid_receive(raw_output_buffer, RAW_BUFFER_SIZE);
+        raw_hid_receive_quantum(raw_output_buffer, RAW_BUFFER_SIZE);
         raw_output_received_bytes = 0;
     }
 }
@@ -211,6 +215,7 @@ static void send_extra(report_extra_t *report);
 #ifdef RAW_ENABLE
 static void send_raw_hid(uint8_t *data, uint8_t length);
 #endif
+static bool keyboard_ready(void);
 
 static host_driver_t driver = {
     .keyboard_leds = usb_device_state_get_leds,
@@ -221,6 +226,7 @@ static host_driver_t driver = {
 #ifdef RAW_ENABLE
     .send_raw_hid = send_raw_hid,
 #endif
+    .keyboard_ready = keyboard_ready,
 };
 
 host_driver_t *vusb_driver(void) {
@@ -237,6 +243,16 @@ static void send_keyboard(report_keyboard_t *report) {
     keyboard_report_sent = *report;
 }
 
+static bool keyboard_ready(void) {
+#ifdef NKRO_ENABLE
+    // Matches the choice made by send_keyboard_report()
+    if (host_can_send_nkro() && keymap_config.nkro) {
+        return !usbConfiguration || usbInterruptIsReady3();
+    }
+#endif
+    return !usbConfiguration || usbInterruptIsReady();
+}
+
 #ifndef KEYBOARD_SHARED_EP
 #    define MOUSE_IN_EPNUM 3
 #    define SHARED_IN_EPNUM 3